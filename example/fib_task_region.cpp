@@ -24,8 +24,8 @@ int fib_task_region(int n)
   if (n == 0) return 0;
   if (n == 1) return 1;
 
-  int n1;
-  int n2;
+  int n1 = 0;
+  int n2 = 0;
 
   task_region([&](task_region_handle& trh)
       {
@@ -50,8 +50,8 @@ int fib_task_region_gen( Ex& ex, int n)
   if (n == 0) return 0;
   if (n == 1) return 1;
 
-  int n1;
-  int n2;
+  int n1 = 0;
+  int n2 = 0;
 
   task_region(ex, [&](task_region_handle_gen<Ex>& trh)
       {
@@ -67,6 +67,34 @@ int fib_task_region_gen( Ex& ex, int n)
 }
 #endif
 
+#if defined BOOST_THREAD_PROVIDES_EXECUTORS && ! defined BOOST_NO_CXX11_THREAD_LOCAL
+// The whole recursion runs on the same pool: the tasks are forked on the deque of the worker running the region,
+// which runs them while it waits.
+int fib_work_stealing(boost::work_stealing_thread_pool& ex, int n)
+{
+  using boost::experimental::parallel::task_region;
+  using boost::experimental::parallel::task_region_handle_gen;
+
+  if (n == 0) return 0;
+  if (n == 1) return 1;
+
+  int n1 = 0;
+  int n2 = 0;
+
+  task_region(ex, [&](task_region_handle_gen<boost::work_stealing_thread_pool>& trh)
+      {
+        trh.run([&]
+            {
+              n1 = fib_work_stealing(ex, n - 1);
+            });
+
+        n2 = fib_work_stealing(ex, n - 2);
+      });
+
+  return n1 + n2;
+}
+#endif
+
 int main()
 {
   for (int i = 0; i<10; ++i) {
@@ -80,6 +108,13 @@ int main()
     std::cout << fib_task_region_gen(tp,i) << " ";
   }
   std::cout << std::endl;
+#endif
+#if defined BOOST_THREAD_PROVIDES_EXECUTORS && ! defined BOOST_NO_CXX11_THREAD_LOCAL
+  boost::work_stealing_thread_pool wsp;
+  for (int i = 0; i<20; ++i) {
+    std::cout << fib_work_stealing(wsp,i) << " ";
+  }
+  std::cout << std::endl;
 #endif
   return 0;
 }
@@ -0,0 +1,78 @@
+//  (C) Copyright 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Compares boost::mutex, boost::adaptive_mutex and boost::mcs_mutex protecting a very short critical section
+// under contention: the throughput and the 99th percentile of the time spent waiting for the mutex.
+
+#define BOOST_THREAD_USES_CHRONO
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <boost/thread/lock_guard.hpp>
+#include <boost/thread/thread_only.hpp>
+#include <boost/chrono/chrono_io.hpp>
+
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/adaptive_mutex.hpp>
+#include <boost/thread/mcs_mutex.hpp>
+
+using namespace boost;
+
+typedef chrono::high_resolution_clock Clock;
+const int cycles = 100000;
+long counter = 0;
+
+template <class Mutex>
+void contend(Mutex* mtx, std::vector<Clock::duration>* waits)
+{
+  waits->reserve(cycles);
+  for (int cycle = 0; cycle < cycles; ++cycle)
+  {
+    Clock::time_point s = Clock::now();
+    lock_guard<Mutex> lock(*mtx);
+    waits->push_back(Clock::now() - s);
+    ++counter;
+  }
+}
+
+template <class Mutex>
+void bench(const char* name, unsigned nthreads)
+{
+  Mutex mtx;
+  std::vector<std::vector<Clock::duration> > waits(nthreads);
+  std::vector<thread*> threads;
+  Clock::time_point s = Clock::now();
+  for (unsigned i = 0; i < nthreads; ++i) threads.push_back(new thread(&contend<Mutex>, &mtx, &waits[i]));
+  for (unsigned i = 0; i < nthreads; ++i)
+  {
+    threads[i]->join();
+    delete threads[i];
+  }
+  Clock::duration elapsed = Clock::now() - s;
+
+  std::vector<Clock::duration> all;
+  for (unsigned i = 0; i < nthreads; ++i) all.insert(all.end(), waits[i].begin(), waits[i].end());
+  std::vector<Clock::duration>::iterator p99 = all.begin() + all.size() * 99 / 100;
+  std::nth_element(all.begin(), p99, all.end());
+
+  std::cout << name << " " << nthreads << " threads: "
+            << chrono::duration_cast<chrono::nanoseconds>(elapsed) / (long(cycles) * nthreads) << "/cycle, p99 wait "
+            << chrono::duration_cast<chrono::nanoseconds>(*p99) << std::endl;
+}
+
+int main()
+{
+  unsigned const hc = (std::max)(thread::hardware_concurrency(), 1u);
+  unsigned const nthreads[] = { 2, hc, 2 * hc };
+  for (unsigned i = 0; i < sizeof(nthreads) / sizeof(nthreads[0]); ++i)
+  {
+    bench<mutex>("mutex         ", nthreads[i]);
+    bench<adaptive_mutex>("adaptive_mutex", nthreads[i]);
+    bench<mcs_mutex>("mcs_mutex     ", nthreads[i]);
+  }
+  return 0;
+}
@@ -31,6 +31,10 @@ namespace concurrent
   {
   };
 
+  struct BOOST_SYMBOL_VISIBLE sync_queue_is_full : std::exception
+  {
+  };
+
 }
 
 #ifndef BOOST_THREAD_QUEUE_DEPRECATE_OLD
@@ -40,6 +44,7 @@ namespace concurrent
 
   using concurrent::queue_op_status;
   using concurrent::sync_queue_is_closed;
+  using concurrent::sync_queue_is_full;
 
 }
 
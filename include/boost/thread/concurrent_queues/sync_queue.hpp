@@ -58,6 +58,8 @@ namespace concurrent
     inline queue_op_status try_push(BOOST_THREAD_RV_REF(value_type) x);
     inline queue_op_status nonblocking_push(BOOST_THREAD_RV_REF(value_type) x);
     inline queue_op_status wait_push(BOOST_THREAD_RV_REF(value_type) x);
+    template <class InputIterator>
+    void push_bulk(InputIterator first, InputIterator last);
 
     // Observers/Modifiers
     inline void pull(value_type&);
@@ -294,6 +296,21 @@ namespace concurrent
       push(boost::move(elem), lk);
   }
 
+  // Moves all the elements of [first, last) in under a single lock and notifies the waiting pullers once.
+  template <class ValueType, class Container>
+  template <class InputIterator>
+  void sync_queue<ValueType, Container>::push_bulk(InputIterator first, InputIterator last)
+  {
+      unique_lock<mutex> lk(super::mtx_);
+      super::throw_if_closed(lk);
+      if (first == last) return;
+      for (; first != last; ++first)
+      {
+        super::data_.push_back(boost::move(*first));
+      }
+      super::notify_elem_added(lk);
+  }
+
   template <class ValueType, class Container>
   sync_queue<ValueType, Container>& operator<<(sync_queue<ValueType, Container>& sbq, BOOST_THREAD_RV_REF(ValueType) elem)
   {
@@ -0,0 +1,88 @@
+#ifndef BOOST_THREAD_DETAIL_BACKOFF_HPP
+#define BOOST_THREAD_DETAIL_BACKOFF_HPP
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/thread/detail/config.hpp>
+#if defined(BOOST_MSVC) && (defined(_M_IX86) || defined(_M_X64))
+#include <intrin.h>
+#endif
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+  namespace detail
+  {
+    /**
+     * Tells the processor that the calling thread is spinning, which lets the other hardware thread of the core run
+     * and avoids the memory order violation when the spin loop exits.
+     */
+    inline void cpu_relax() BOOST_NOEXCEPT
+    {
+#if defined(BOOST_MSVC) && (defined(_M_IX86) || defined(_M_X64))
+      _mm_pause();
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__i386__) || defined(__x86_64__))
+      __asm__ __volatile__("pause" ::: "memory");
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__aarch64__) || (defined(__arm__) && defined(__ARM_ARCH) && __ARM_ARCH >= 7))
+      __asm__ __volatile__("yield" ::: "memory");
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__powerpc__) || defined(__ppc__))
+      __asm__ __volatile__("or 27,27,27" ::: "memory");
+#endif
+    }
+
+    /**
+     * Exponential backoff: each call to pause() spins twice as long as the previous one, up to a limit.
+     *
+     * A spin loop polls the shared state between two pauses, so that the cache line is requested less often the
+     * longer it is contended.
+     */
+    class spin_backoff
+    {
+      unsigned pauses_;
+      unsigned limit_;
+
+    public:
+      /**
+       * \b Effects: Constructs a backoff whose pauses last at most \c limit calls to cpu_relax().
+       */
+      explicit spin_backoff(unsigned limit = 64) BOOST_NOEXCEPT :
+        pauses_(1), limit_(limit == 0 ? 1 : limit)
+      {
+      }
+
+      /**
+       * \b Effects: Spins for the current pause length, then doubles it up to the limit.
+       *
+       * \b Returns: The number of calls to cpu_relax() done.
+       */
+      unsigned pause() BOOST_NOEXCEPT
+      {
+        unsigned const n = pauses_;
+        for (unsigned i = 0; i < n; ++i) cpu_relax();
+        if (pauses_ < limit_) pauses_ = (pauses_ * 2 < limit_) ? pauses_ * 2 : limit_;
+        return n;
+      }
+
+      /**
+       * \b Returns: Whether the pauses have reached their limit.
+       */
+      bool saturated() const BOOST_NOEXCEPT
+      {
+        return pauses_ >= limit_;
+      }
+
+      void reset() BOOST_NOEXCEPT
+      {
+        pauses_ = 1;
+      }
+    };
+  }
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
@@ -356,6 +356,51 @@
 #define BOOST_THREAD_PROVIDES_INTERRUPTIONS
 #endif
 
+// CONTINUATION_FUSION
+// An executor continuation launched by a job of the same executor is run by that job instead of being submitted.
+// Not provided by default: the continuation is no more run concurrently with the rest of the job.
+#if defined BOOST_THREAD_PROVIDES_CONTINUATION_FUSION
+#if ! defined BOOST_THREAD_PROVIDES_EXECUTORS || defined BOOST_NO_CXX11_THREAD_LOCAL \
+ || defined BOOST_THREAD_DONT_PROVIDE_CONTINUATION_FUSION
+#undef BOOST_THREAD_PROVIDES_CONTINUATION_FUSION
+#endif
+#endif
+
+// Maximum number of continuations run by a single executor job
+#if ! defined BOOST_THREAD_CONTINUATION_FUSION_BUDGET
+#define BOOST_THREAD_CONTINUATION_FUSION_BUDGET 16
+#endif
+
+// Executor jobs nested deeper than this on a thread don't fuse their continuations
+#if ! defined BOOST_THREAD_CONTINUATION_FUSION_DEPTH
+#define BOOST_THREAD_CONTINUATION_FUSION_DEPTH 4
+#endif
+
+// HELP_WHILE_WAITING
+// A worker of basic_thread_pool waiting for a future runs the closures queued on its pool instead of blocking.
+// Not provided by default: the closures are run on the stack of the waiting closure, with the locks it holds.
+#if defined BOOST_THREAD_PROVIDES_HELP_WHILE_WAITING
+#if ! defined BOOST_THREAD_PROVIDES_EXECUTORS || defined BOOST_NO_CXX11_THREAD_LOCAL || ! defined BOOST_THREAD_USES_CHRONO
+#undef BOOST_THREAD_PROVIDES_HELP_WHILE_WAITING
+#endif
+#endif
+
+// Waits nested deeper than this on a worker thread block instead of running other closures
+#if ! defined BOOST_THREAD_HELP_WHILE_WAITING_DEPTH
+#define BOOST_THREAD_HELP_WHILE_WAITING_DEPTH 8
+#endif
+
+// COROUTINES
+// Awaitable futures, schedule() and task<T> are provided when the compiler supports C++20 coroutines
+#if ! defined BOOST_THREAD_PROVIDES_COROUTINES \
+ && ! defined BOOST_THREAD_DONT_PROVIDE_COROUTINES
+#if defined __cpp_impl_coroutine && defined __has_include
+#if __cpp_impl_coroutine >= 201902L && __has_include(<coroutine>)
+#define BOOST_THREAD_PROVIDES_COROUTINES
+#endif
+#endif
+#endif
+
 // CORRELATIONS
 
 // EXPLICIT_LOCK_CONVERSION.
@@ -0,0 +1,33 @@
+#ifndef BOOST_THREAD_DETAIL_MIX_HASH_HPP
+#define BOOST_THREAD_DETAIL_MIX_HASH_HPP
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/thread/detail/config.hpp>
+#include <cstddef>
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+  namespace detail
+  {
+    /**
+     * Returns: \c h with its high bits folded into its low ones, so that it can be reduced by a modulo or a mask.
+     *
+     * boost::hash of an integer is the integer itself, and the keys and the thread identifiers are often multiples of
+     * a power of two, which would otherwise land on a few buckets.
+     */
+    inline std::size_t mix_hash(std::size_t h) BOOST_NOEXCEPT
+    {
+      return h ^ (h >> 7) ^ (h >> 13) ^ (h >> 21);
+    }
+  }
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
@@ -0,0 +1,126 @@
+#ifndef BOOST_THREAD_DETAIL_THREAD_SLOTS_HPP
+#define BOOST_THREAD_DETAIL_THREAD_SLOTS_HPP
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/thread/detail/config.hpp>
+#include <boost/thread/detail/delete.hpp>
+#include <boost/thread/detail/mix_hash.hpp>
+#include <boost/thread/thread_only.hpp>
+#include <boost/assert.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/scoped_array.hpp>
+#include <boost/functional/hash.hpp>
+#include <cstddef>
+#include <new>
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+  namespace detail
+  {
+    /**
+     * Array of slots, each one on its own cache line, in which the threads are spread by hashing their identifier.
+     *
+     * The threads mapped to different slots don't share any written cache line. The number of slots is a power of
+     * two, so that the slot of a thread is selected by a mask.
+     *
+     * @param Slot the slot type, default constructible.
+     */
+    template <typename Slot>
+    class thread_slots
+    {
+    private:
+      struct BOOST_ALIGNMENT(64) padded_slot
+      {
+        Slot slot;
+      };
+
+      // the array is aligned by hand, as new doesn't align on a cache line before C++17.
+      scoped_array<char> storage_;
+      padded_slot* slots_;
+      std::size_t mask_;
+
+      static std::size_t rounded(unsigned count)
+      {
+        if (count == 0) count = 2 * thread::hardware_concurrency();
+        std::size_t n = 1;
+        while (n < count) n <<= 1;
+        return n;
+      }
+
+    public:
+      BOOST_THREAD_NO_COPYABLE(thread_slots)
+
+      /**
+       * Effects: Constructs @c count slots, rounded to the next power of two, or twice as many slots as there are
+       * hardware threads if @c count is 0.
+       */
+      explicit thread_slots(unsigned count = 0) :
+        storage_(new char[rounded(count) * sizeof(padded_slot) + 64]),
+        slots_(0),
+        mask_(rounded(count) - 1)
+      {
+        uintptr_t const address = reinterpret_cast<uintptr_t>(storage_.get());
+        padded_slot* const slots = reinterpret_cast<padded_slot*>((address + 63) & ~static_cast<uintptr_t>(63));
+        std::size_t i = 0;
+        try
+        {
+          for (; i <= mask_; ++i) new (&slots[i]) padded_slot();
+        }
+        catch (...)
+        {
+          while (i > 0) slots[--i].~padded_slot();
+          throw;
+        }
+        slots_ = slots;
+      }
+
+      ~thread_slots()
+      {
+        for (std::size_t i = 0; i <= mask_; ++i) slots_[i].~padded_slot();
+      }
+
+      std::size_t size() const BOOST_NOEXCEPT
+      {
+        return mask_ + 1;
+      }
+
+      Slot& operator[](std::size_t i)
+      {
+        BOOST_ASSERT(i <= mask_);
+        return slots_[i].slot;
+      }
+      Slot const& operator[](std::size_t i) const
+      {
+        BOOST_ASSERT(i <= mask_);
+        return slots_[i].slot;
+      }
+
+      /**
+       * Returns: The index of the slot of the calling thread.
+       */
+      std::size_t this_thread_index() const
+      {
+        // the thread identifiers are often aligned addresses.
+        return mix_hash(hash_value(this_thread::get_id())) & mask_;
+      }
+
+      /**
+       * Returns: The slot of the calling thread.
+       */
+      Slot& this_thread_slot()
+      {
+        return slots_[this_thread_index()].slot;
+      }
+    };
+  }
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
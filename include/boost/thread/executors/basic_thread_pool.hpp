@@ -18,6 +18,7 @@
 #include <boost/thread/thread.hpp>
 #include <boost/thread/concurrent_queues/sync_queue.hpp>
 #include <boost/thread/executors/work.hpp>
+#include <boost/thread/executors/detail/current_worker.hpp>
 #include <boost/thread/csbl/vector.hpp>
 
 #include <boost/config/abi_prefix.hpp>
@@ -40,6 +41,10 @@ namespace executors
     thread_vector threads;
     /// the thread safe work queue
     concurrent::sync_queue<work > work_queue;
+#if defined BOOST_THREAD_PROVIDES_HELP_WHILE_WAITING
+    /// the waits of the workers helping while they wait, notified when closures are queued
+    detail::work_waiters helpers;
+#endif
 
   public:
     /**
@@ -83,6 +88,9 @@ namespace executors
      */
     void worker_thread()
     {
+#if defined BOOST_THREAD_PROVIDES_HELP_WHILE_WAITING
+      detail::current_worker worker(*this, helpers);
+#endif
       try
       {
         for(;;)
@@ -301,6 +309,9 @@ namespace executors
      */
     void submit(BOOST_THREAD_RV_REF(work) closure)  {
       work_queue.push(boost::move(closure));
+#if defined BOOST_THREAD_PROVIDES_HELP_WHILE_WAITING
+      helpers.notify();
+#endif
     }
 
 #if defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
@@ -323,6 +334,21 @@ namespace executors
       submit(boost::move(w));
     }
 
+    /**
+     * \b Effects: The closures in [first, last) are enqueued under a single lock of the work queue
+     * and the idle worker threads are woken up once.
+     *
+     * \b Throws: \c sync_queue_is_closed if the thread pool is closed.
+     * Whatever exception that can be throw while storing the closures.
+     */
+    void submit_bulk(work* first, work* last)
+    {
+      work_queue.push_bulk(first, last);
+#if defined BOOST_THREAD_PROVIDES_HELP_WHILE_WAITING
+      helpers.notify();
+#endif
+    }
+
     /**
      * \b Requires: This must be called from an scheduled task.
      *
@@ -341,6 +367,11 @@ namespace executors
     }
 
   };
+
+  inline void submit_bulk(basic_thread_pool& ex, basic_thread_pool::work* first, basic_thread_pool::work* last)
+  {
+    ex.submit_bulk(first, last);
+  }
 }
 using executors::basic_thread_pool;
 
@@ -0,0 +1,370 @@
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_THREAD_EXECUTORS_BOUNDED_THREAD_POOL_HPP
+#define BOOST_THREAD_EXECUTORS_BOUNDED_THREAD_POOL_HPP
+
+#include <boost/thread/detail/config.hpp>
+#if defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION && defined BOOST_THREAD_PROVIDES_EXECUTORS && defined BOOST_THREAD_USES_MOVE
+
+#include <exception> // std::terminate
+#include <boost/throw_exception.hpp>
+#include <boost/thread/detail/delete.hpp>
+#include <boost/thread/detail/move.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/concurrent_queues/sync_bounded_queue.hpp>
+#include <boost/thread/executors/work.hpp>
+#include <boost/thread/csbl/vector.hpp>
+#include <boost/core/scoped_enum.hpp>
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+namespace executors
+{
+  /// What a bounded_thread_pool does with a closure submitted while its queue is full.
+  BOOST_SCOPED_ENUM_DECLARE_BEGIN(overflow_policy)
+  {
+    /// the submitter waits until the queue is no longer full.
+    block,
+    /// the closure is run by the submitter.
+    caller_runs,
+    /// the closure is rejected.
+    reject,
+    /// the oldest closure of the queue is discarded to make room.
+    drop_oldest
+  }
+  BOOST_SCOPED_ENUM_DECLARE_END(overflow_policy)
+
+  /**
+   * Thread pool whose queue holds at most a given number of closures, so that a producer faster than the workers
+   * is slowed down, or loses closures, instead of making the queue grow without limit.
+   */
+  class bounded_thread_pool
+  {
+  public:
+    /// type-erasure to store the works to do
+    typedef  executors::work work;
+  private:
+    typedef thread thread_t;
+    /// A move aware vector type
+    typedef csbl::vector<thread_t> thread_vector;
+
+    /// A move aware vector
+    thread_vector threads;
+    /// the thread safe bounded work queue
+    concurrent::sync_bounded_queue<work > work_queue;
+    overflow_policy policy_;
+
+    /**
+     * The main loop of the worker threads
+     */
+    void worker_thread()
+    {
+      try
+      {
+        for(;;)
+        {
+          work task;
+          try
+          {
+            queue_op_status st = work_queue.wait_pull_front(task);
+            if (st == queue_op_status::closed) {
+              return;
+            }
+            task();
+          }
+          catch (boost::thread_interrupted&)
+          {
+            return;
+          }
+        }
+      }
+      catch (...)
+      {
+        std::terminate();
+        return;
+      }
+    }
+
+    static void run_inline(work& closure)
+    {
+      try
+      {
+        closure();
+      }
+      catch (...)
+      {
+        std::terminate();
+      }
+    }
+
+  public:
+    /// bounded_thread_pool is not copyable.
+    BOOST_THREAD_NO_COPYABLE(bounded_thread_pool)
+
+    /**
+     * \b Requires: \c max_queued > 0.
+     *
+     * \b Effects: creates a thread pool that runs closures on \c thread_count threads, keeps at most \c max_queued
+     * closures waiting for a thread and applies \c policy to the closures submitted beyond.
+     *
+     * \b Throws: Whatever exception is thrown while initializing the needed resources.
+     */
+    bounded_thread_pool(std::size_t max_queued, overflow_policy policy = overflow_policy::block,
+        unsigned const thread_count = thread::hardware_concurrency()+1)
+    : work_queue(max_queued), policy_(policy)
+    {
+      try
+      {
+        threads.reserve(thread_count);
+        for (unsigned i = 0; i < thread_count; ++i)
+        {
+          thread th (&bounded_thread_pool::worker_thread, this);
+          threads.push_back(thread_t(boost::move(th)));
+        }
+      }
+      catch (...)
+      {
+        close();
+        join();
+        throw;
+      }
+    }
+    /**
+     * \b Effects: Destroys the thread pool.
+     *
+     * \b Synchronization: The completion of all the closures happen before the completion of the \c bounded_thread_pool destructor.
+     */
+    ~bounded_thread_pool()
+    {
+      // signal to all the worker threads that there will be no more submissions.
+      close();
+      // the workers run the remaining closures before exiting.
+      join();
+    }
+
+    /**
+     * \b Effects: join all the threads.
+     */
+    void join()
+    {
+      for (unsigned i = 0; i < threads.size(); ++i)
+      {
+        if (threads[i].joinable()) threads[i].join();
+      }
+    }
+
+    /**
+     * \b Effects: close the \c bounded_thread_pool for submissions.
+     * The worker threads will work until there is no more closures to run.
+     * The submitters blocked on a full queue are woken up and throw \c sync_queue_is_closed.
+     */
+    void close()
+    {
+      work_queue.close();
+    }
+
+    /**
+     * \b Returns: whether the pool is closed for submissions.
+     */
+    bool closed()
+    {
+      return work_queue.closed();
+    }
+
+    /**
+     * \b Returns: the overflow policy of the pool.
+     */
+    overflow_policy policy() const
+    {
+      return policy_;
+    }
+
+    /**
+     * \b Returns: the maximum number of closures waiting for a thread.
+     */
+    std::size_t capacity() const
+    {
+      return work_queue.capacity();
+    }
+
+    /**
+     * \b Returns: the number of closures waiting for a thread.
+     */
+    std::size_t size() const
+    {
+      return work_queue.size();
+    }
+
+    /**
+     * Effects: try to execute one task.
+     * Returns: whether a task has been executed.
+     * Throws: whatever the current task constructor throws or the task() throws.
+     */
+    bool try_executing_one()
+    {
+      try
+      {
+        work task;
+        if (work_queue.try_pull_front(task) == queue_op_status::success)
+        {
+          task();
+          return true;
+        }
+        return false;
+      }
+      catch (...)
+      {
+        std::terminate();
+      }
+    }
+
+    /**
+     * Effects: schedule one task or yields
+     * Throws: whatever the current task constructor throws or the task() throws.
+     */
+    void schedule_one_or_yield()
+    {
+        if ( ! try_executing_one())
+        {
+          this_thread::yield();
+        }
+    }
+
+    /**
+     * \b Effects: Enqueues \c closure. If the queue is full, applies the overflow policy of the pool:
+     * - \c block: waits until the queue is no longer full,
+     * - \c caller_runs: runs \c closure on the calling thread,
+     * - \c reject: returns \c queue_op_status::full, \c closure being discarded,
+     * - \c drop_oldest: discards the oldest closure of the queue and enqueues \c closure.
+     *
+     * \b Returns: \c queue_op_status::success if the closure has been enqueued or run, \c queue_op_status::full if
+     * it has been rejected and \c queue_op_status::closed if the pool is closed.
+     *
+     * \b Throws: Whatever exception that can be throw while storing the closure.
+     */
+    queue_op_status try_submit(BOOST_THREAD_RV_REF(work) closure)
+    {
+      if (policy_ == overflow_policy::block)
+      {
+        try
+        {
+          return work_queue.wait_push_back(boost::move(closure));
+        }
+        catch (sync_queue_is_closed&)
+        {
+          return queue_op_status::closed;
+        }
+      }
+      queue_op_status st = work_queue.try_push_back(boost::move(closure));
+      if (st != queue_op_status::full) return st;
+      if (policy_ == overflow_policy::caller_runs)
+      {
+        run_inline(closure);
+        return queue_op_status::success;
+      }
+      if (policy_ == overflow_policy::drop_oldest)
+      {
+        do
+        {
+          // The queue can have been emptied by the workers in between.
+          work oldest;
+          work_queue.try_pull_front(oldest);
+          st = work_queue.try_push_back(boost::move(closure));
+        } while (st == queue_op_status::full);
+      }
+      return st;
+    }
+
+#if defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+    template <typename Closure>
+    queue_op_status try_submit(Closure & closure)
+    {
+      return try_submit(work(closure));
+    }
+#endif
+    queue_op_status try_submit(void (*closure)())
+    {
+      return try_submit(work(closure));
+    }
+
+    template <typename Closure>
+    queue_op_status try_submit(BOOST_THREAD_FWD_REF(Closure) closure)
+    {
+      work w((boost::forward<Closure>(closure)));
+      return try_submit(boost::move(w));
+    }
+
+    /**
+     * \b Requires: \c Closure is a model of \c Callable(void()) and a model of \c CopyConstructible/MoveConstructible.
+     *
+     * \b Effects: As try_submit(closure).
+     * If invoked closure throws an exception the \c bounded_thread_pool will call \c std::terminate, as is the case with threads.
+     *
+     * \b Throws: \c sync_queue_is_closed if the thread pool is closed.
+     * \c sync_queue_is_full if the queue is full and the policy is \c reject.
+     * Whatever exception that can be throw while storing the closure.
+     */
+    void submit(BOOST_THREAD_RV_REF(work) closure)
+    {
+      queue_op_status st = try_submit(boost::move(closure));
+      if (st == queue_op_status::closed)
+      {
+        throw_exception( sync_queue_is_closed() );
+      }
+      if (st == queue_op_status::full)
+      {
+        throw_exception( sync_queue_is_full() );
+      }
+    }
+
+#if defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+    template <typename Closure>
+    void submit(Closure & closure)
+    {
+      submit(work(closure));
+    }
+#endif
+    void submit(void (*closure)())
+    {
+      submit(work(closure));
+    }
+
+    template <typename Closure>
+    void submit(BOOST_THREAD_FWD_REF(Closure) closure)
+    {
+      work w((boost::forward<Closure>(closure)));
+      submit(boost::move(w));
+    }
+
+    /**
+     * \b Requires: This must be called from an scheduled task.
+     *
+     * \b Effects: reschedule functions until pred()
+     */
+    template <typename Pred>
+    bool reschedule_until(Pred const& pred)
+    {
+      do {
+        if ( ! try_executing_one())
+        {
+          return false;
+        }
+      } while (! pred());
+      return true;
+    }
+  };
+}
+using executors::bounded_thread_pool;
+using executors::overflow_policy;
+
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
+#endif
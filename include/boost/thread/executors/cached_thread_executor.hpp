@@ -0,0 +1,293 @@
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_THREAD_CACHED_THREAD_EXECUTOR_HPP
+#define BOOST_THREAD_CACHED_THREAD_EXECUTOR_HPP
+
+#include <boost/thread/detail/config.hpp>
+#if defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION && defined BOOST_THREAD_PROVIDES_EXECUTORS && defined BOOST_THREAD_USES_MOVE
+
+#include <exception> // std::terminate
+#include <boost/throw_exception.hpp>
+#include <boost/thread/detail/delete.hpp>
+#include <boost/thread/detail/move.hpp>
+#include <boost/thread/executors/work.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/lock_guard.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/thread_only.hpp>
+#include <boost/thread/csbl/vector.hpp>
+#include <boost/thread/concurrent_queues/queue_op_status.hpp>
+#include <boost/chrono/system_clocks.hpp>
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+namespace executors
+{
+  /**
+   * Executor running each closure on its own thread, as \c thread_executor does, but where a thread that has completed
+   * its closure is parked for some time to run the next submitted one, and exits if none comes.
+   * The threads that have exited are joined by the next submission, so that the number of threads stays proportional
+   * to the number of closures running at the same time.
+   */
+  class cached_thread_executor
+  {
+  public:
+    /// type-erasure to store the works to do
+    typedef  executors::work work;
+    typedef chrono::steady_clock clock;
+  private:
+    struct worker
+    {
+      thread th;
+      work closure; // protected by mtx_
+      bool has_work; // protected by mtx_
+      bool finished; // protected by mtx_
+      condition_variable cv;
+
+      worker() : has_work(false), finished(false) {}
+    };
+
+    clock::duration idle_timeout_;
+    csbl::vector<worker*> workers_; // protected by mtx_
+    /// the parked workers, the last parked at the back.
+    csbl::vector<worker*> idle_; // protected by mtx_
+    std::size_t finished_; // protected by mtx_
+    bool closed_; // protected by mtx_
+    mutable mutex mtx_;
+
+    void worker_thread(worker* w)
+    {
+      unique_lock<mutex> lk(mtx_);
+      for(;;)
+      {
+        work task = boost::move(w->closure);
+        w->has_work = false;
+        lk.unlock();
+        try
+        {
+          task();
+        }
+        catch (...)
+        {
+          std::terminate();
+        }
+        // the closure is destroyed before the thread is made available.
+        task = work();
+        lk.lock();
+        if (closed_) break;
+        idle_.push_back(w);
+        clock::time_point deadline = clock::now() + idle_timeout_;
+        while (! w->has_work && ! closed_)
+        {
+          if (w->cv.wait_until(lk, deadline) == cv_status::timeout) break;
+        }
+        if (! w->has_work)
+        {
+          for (std::size_t i = 0; i < idle_.size(); ++i)
+          {
+            if (idle_[i] == w)
+            {
+              idle_.erase(idle_.begin() + i);
+              break;
+            }
+          }
+          break;
+        }
+      }
+      // The worker can be joined and destroyed as soon as the lock is released.
+      w->finished = true;
+      ++finished_;
+    }
+
+    // Removes the finished workers from workers_ and moves them to reaped.
+    void take_finished(csbl::vector<worker*>& reaped, lock_guard<mutex>&)
+    {
+      if (finished_ == 0) return;
+      std::size_t j = 0;
+      for (std::size_t i = 0; i < workers_.size(); ++i)
+      {
+        if (workers_[i]->finished) reaped.push_back(workers_[i]);
+        else workers_[j++] = workers_[i];
+      }
+      workers_.resize(j);
+      finished_ = 0;
+    }
+
+    static void join_and_delete(csbl::vector<worker*>& reaped)
+    {
+      for (std::size_t i = 0; i < reaped.size(); ++i)
+      {
+        if (reaped[i]->th.joinable()) reaped[i]->th.join();
+        delete reaped[i];
+      }
+    }
+
+  public:
+    /// cached_thread_executor is not copyable.
+    BOOST_THREAD_NO_COPYABLE(cached_thread_executor)
+
+    /**
+     * \b Effects: creates an executor whose threads exit once they have been parked for \c idle_timeout.
+     *
+     * \b Throws: Nothing.
+     */
+    explicit cached_thread_executor(clock::duration idle_timeout = chrono::seconds(60))
+    : idle_timeout_(idle_timeout), finished_(0), closed_(false)
+    {
+    }
+    /**
+     * \b Effects: Waits for closures (if any) to complete, then joins and destroys the threads.
+     *
+     * \b Synchronization: The completion of all the closures happen before the completion of the \c cached_thread_executor destructor.
+     */
+    ~cached_thread_executor()
+    {
+      // signal to all the worker threads that there will be no more submissions.
+      close();
+      // no other thread accesses workers_ once closed.
+      join_and_delete(workers_);
+    }
+
+    /**
+     * \b Effects: close the \c cached_thread_executor for submissions.
+     * The parked threads exit, and the other ones exit once they have completed their closure.
+     */
+    void close()
+    {
+      lock_guard<mutex> lk(mtx_);
+      closed_ = true;
+      for (std::size_t i = 0; i < idle_.size(); ++i)
+      {
+        idle_[i]->cv.notify_one();
+      }
+      idle_.clear();
+    }
+
+    /**
+     * \b Returns: whether the executor is closed for submissions.
+     */
+    bool closed()
+    {
+      lock_guard<mutex> lk(mtx_);
+      return closed_;
+    }
+
+    /**
+     * \b Returns: the number of threads that haven't been joined yet, running or parked.
+     */
+    std::size_t num_threads() const
+    {
+      lock_guard<mutex> lk(mtx_);
+      return workers_.size() - finished_;
+    }
+
+    /**
+     * \b Returns: the number of parked threads.
+     */
+    std::size_t num_idle_threads() const
+    {
+      lock_guard<mutex> lk(mtx_);
+      return idle_.size();
+    }
+
+    /**
+     * Effects: none.
+     * Returns: false, as the closures are never queued.
+     */
+    bool try_executing_one()
+    {
+      return false;
+    }
+
+    /**
+     * \b Requires: \c Closure is a model of \c Callable(void()) and a model of \c CopyConstructible/MoveConstructible.
+     *
+     * \b Effects: The specified \c closure is handed to the last parked thread, if any, or to a new thread.
+     * The threads which have exited since the last submission are joined.
+     * If invoked closure throws an exception the \c cached_thread_executor will call \c std::terminate, as is the case with threads.
+     *
+     * \b Throws: \c sync_queue_is_closed if the executor is closed.
+     * Whatever exception that can be throw while storing the closure or creating the thread.
+     */
+    void submit(BOOST_THREAD_RV_REF(work) closure)
+    {
+      csbl::vector<worker*> reaped;
+      {
+        lock_guard<mutex> lk(mtx_);
+        if (closed_)  BOOST_THROW_EXCEPTION( sync_queue_is_closed() );
+        take_finished(reaped, lk);
+        if (! idle_.empty())
+        {
+          worker* w = idle_.back();
+          idle_.pop_back();
+          w->closure = boost::move(closure);
+          w->has_work = true;
+          w->cv.notify_one();
+        }
+        else
+        {
+          workers_.reserve(workers_.size() + 1);
+          worker* w = new worker();
+          w->closure = boost::move(closure);
+          w->has_work = true;
+          try
+          {
+            thread th(&cached_thread_executor::worker_thread, this, w);
+            w->th = boost::move(th);
+          }
+          catch (...)
+          {
+            delete w;
+            join_and_delete(reaped);
+            throw;
+          }
+          workers_.push_back(w);
+        }
+      }
+      join_and_delete(reaped);
+    }
+
+#if defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+    template <typename Closure>
+    void submit(Closure & closure)
+    {
+      submit(work(closure));
+    }
+#endif
+    void submit(void (*closure)())
+    {
+      submit(work(closure));
+    }
+
+    template <typename Closure>
+    void submit(BOOST_THREAD_FWD_REF(Closure) closure)
+    {
+      work w((boost::forward<Closure>(closure)));
+      submit(boost::move(w));
+    }
+
+    /**
+     * \b Requires: This must be called from an scheduled task.
+     *
+     * \b Effects: reschedule functions until pred()
+     */
+    template <typename Pred>
+    bool reschedule_until(Pred const&)
+    {
+      return false;
+    }
+
+  };
+}
+using executors::cached_thread_executor;
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
+#endif
@@ -0,0 +1,469 @@
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_THREAD_EXECUTORS_DEADLINE_THREAD_POOL_HPP
+#define BOOST_THREAD_EXECUTORS_DEADLINE_THREAD_POOL_HPP
+
+#include <boost/thread/detail/config.hpp>
+#if defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION && defined BOOST_THREAD_PROVIDES_EXECUTORS && defined BOOST_THREAD_USES_MOVE
+
+#include <exception> // std::terminate
+#include <algorithm>
+#include <boost/assert.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/thread/detail/delete.hpp>
+#include <boost/thread/detail/move.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/concurrent_queues/queue_op_status.hpp>
+#include <boost/thread/executors/work.hpp>
+#include <boost/thread/csbl/vector.hpp>
+#include <boost/chrono/system_clocks.hpp>
+#include <boost/cstdint.hpp>
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+namespace executors
+{
+  /**
+   * Configuration of a quality of service class of a deadline_thread_pool.
+   */
+  struct qos_class
+  {
+    /// the time allowed to complete a closure of the class, counted from its submission.
+    chrono::steady_clock::duration deadline;
+    /// the maximum number of closures of the class run at the same time, or 0 for no limit.
+    unsigned max_concurrency;
+
+    explicit qos_class(chrono::steady_clock::duration deadline, unsigned max_concurrency = 0)
+    : deadline(deadline), max_concurrency(max_concurrency)
+    {
+    }
+  };
+
+  /**
+   * Metrics of a quality of service class of a deadline_thread_pool.
+   */
+  struct qos_stats
+  {
+    /// the number of closures waiting for a thread.
+    std::size_t queued;
+    /// the number of closures being run.
+    std::size_t running;
+    /// the number of closures submitted since the creation of the pool.
+    uintmax_t submitted;
+    /// the number of closures completed since the creation of the pool.
+    uintmax_t completed;
+    /// the number of closures completed after their deadline.
+    uintmax_t missed_deadlines;
+    /// the sum of the times the started closures have waited for a thread.
+    chrono::steady_clock::duration total_wait;
+    /// the longest time a started closure has waited for a thread.
+    chrono::steady_clock::duration max_wait;
+
+    qos_stats()
+    : queued(0), running(0), submitted(0), completed(0), missed_deadlines(0),
+      total_wait(chrono::steady_clock::duration::zero()), max_wait(chrono::steady_clock::duration::zero())
+    {
+    }
+  };
+
+  /**
+   * Thread pool ordering the closures by deadline.
+   * Each closure belongs to a quality of service class, and is given a deadline either explicitly or as its submission
+   * time plus the deadline of its class. The workers run the closure with the earliest deadline among the classes that
+   * haven't reached their concurrency cap.
+   */
+  class deadline_thread_pool
+  {
+  public:
+    /// type-erasure to store the works to do
+    typedef  executors::work work;
+    typedef chrono::steady_clock clock;
+  private:
+    typedef thread thread_t;
+    /// A move aware vector type
+    typedef csbl::vector<thread_t> thread_vector;
+
+    struct item
+    {
+      clock::time_point deadline;
+      clock::time_point enqueued;
+      uintmax_t seq;
+      work closure;
+    };
+
+    // Orders the heap of a class so that its front is the earliest deadline, the first submitted on ties.
+    struct later
+    {
+      bool operator()(item const& x, item const& y) const
+      {
+        return x.deadline > y.deadline || (x.deadline == y.deadline && x.seq > y.seq);
+      }
+    };
+
+    struct class_state
+    {
+      qos_class config;
+      csbl::vector<item> heap;
+      qos_stats stats;
+
+      explicit class_state(qos_class const& c) : config(c) {}
+    };
+
+    /// A move aware vector
+    thread_vector threads;
+    mutable mutex mtx_;
+    condition_variable not_empty_;
+    csbl::vector<class_state> classes_; // protected by mtx_
+    std::size_t queued_; // protected by mtx_
+    uintmax_t seq_; // protected by mtx_
+    bool closed_; // protected by mtx_
+
+    // Returns: whether a closure can be run, and its class.
+    bool pick(unsigned& qos, unique_lock<mutex>&) const
+    {
+      bool found = false;
+      for (unsigned c = 0; c < classes_.size(); ++c)
+      {
+        class_state const& s = classes_[c];
+        if (s.heap.empty()) continue;
+        if (s.config.max_concurrency != 0 && s.stats.running >= s.config.max_concurrency) continue;
+        if (! found || s.heap.front().deadline < classes_[qos].heap.front().deadline)
+        {
+          qos = c;
+          found = true;
+        }
+      }
+      return found;
+    }
+
+    // Runs the closure of class qos with the earliest deadline, with lk unlocked.
+    void run_one(unsigned qos, unique_lock<mutex>& lk)
+    {
+      class_state& s = classes_[qos];
+      std::pop_heap(s.heap.begin(), s.heap.end(), later());
+      item it = boost::move(s.heap.back());
+      s.heap.pop_back();
+      --queued_;
+      clock::duration waited = clock::now() - it.enqueued;
+      s.stats.total_wait += waited;
+      if (waited > s.stats.max_wait) s.stats.max_wait = waited;
+      ++s.stats.running;
+      lk.unlock();
+      try
+      {
+        it.closure();
+      }
+      catch (...)
+      {
+        std::terminate();
+      }
+      clock::time_point done = clock::now();
+      lk.lock();
+      class_state& cs = classes_[qos];
+      --cs.stats.running;
+      ++cs.stats.completed;
+      if (done > it.deadline) ++cs.stats.missed_deadlines;
+      // A closure of a capped class may be waiting for this one to complete.
+      if (cs.config.max_concurrency != 0 && ! cs.heap.empty()) not_empty_.notify_one();
+    }
+
+    /**
+     * The main loop of the worker threads
+     */
+    void worker_thread()
+    {
+      unique_lock<mutex> lk(mtx_);
+      for(;;)
+      {
+        unsigned qos = 0;
+        if (pick(qos, lk))
+        {
+          run_one(qos, lk);
+          continue;
+        }
+        if (closed_ && queued_ == 0) return;
+        not_empty_.wait(lk);
+      }
+    }
+
+    void push(unsigned qos, BOOST_THREAD_RV_REF(work) closure, clock::time_point enqueued, clock::time_point deadline)
+    {
+      BOOST_ASSERT(qos < classes_.size());
+      {
+        lock_guard<mutex> lk(mtx_);
+        if (closed_)
+        {
+          throw_exception( sync_queue_is_closed() );
+        }
+        class_state& s = classes_[qos];
+        item it;
+        it.deadline = deadline;
+        it.enqueued = enqueued;
+        it.seq = seq_++;
+        it.closure = boost::move(closure);
+        s.heap.push_back(boost::move(it));
+        std::push_heap(s.heap.begin(), s.heap.end(), later());
+        ++queued_;
+        ++s.stats.submitted;
+      }
+      not_empty_.notify_one();
+    }
+
+    void start(unsigned thread_count)
+    {
+      try
+      {
+        threads.reserve(thread_count);
+        for (unsigned i = 0; i < thread_count; ++i)
+        {
+          thread th (&deadline_thread_pool::worker_thread, this);
+          threads.push_back(thread_t(boost::move(th)));
+        }
+      }
+      catch (...)
+      {
+        close();
+        join();
+        throw;
+      }
+    }
+
+  public:
+    /// deadline_thread_pool is not copyable.
+    BOOST_THREAD_NO_COPYABLE(deadline_thread_pool)
+
+    /**
+     * \b Requires: \c classes is not empty and the deadlines of the classes are not negative.
+     *
+     * \b Effects: creates a thread pool with the quality of service classes \c classes, numbered from 0 in order,
+     * that runs closures on \c thread_count threads.
+     *
+     * \b Throws: Whatever exception is thrown while initializing the needed resources.
+     */
+    explicit deadline_thread_pool(csbl::vector<qos_class> const& classes,
+        unsigned const thread_count = thread::hardware_concurrency()+1)
+    : queued_(0), seq_(0), closed_(false)
+    {
+      BOOST_ASSERT(! classes.empty());
+      classes_.reserve(classes.size());
+      for (std::size_t i = 0; i < classes.size(); ++i)
+      {
+        classes_.push_back(class_state(classes[i]));
+      }
+      start(thread_count);
+    }
+
+    /**
+     * \b Effects: Destroys the thread pool.
+     *
+     * \b Synchronization: The completion of all the closures happen before the completion of the \c deadline_thread_pool destructor.
+     */
+    ~deadline_thread_pool()
+    {
+      // signal to all the worker threads that there will be no more submissions.
+      close();
+      // the workers run the remaining closures before exiting.
+      join();
+    }
+
+    /**
+     * \b Effects: join all the threads.
+     */
+    void join()
+    {
+      for (unsigned i = 0; i < threads.size(); ++i)
+      {
+        if (threads[i].joinable()) threads[i].join();
+      }
+    }
+
+    /**
+     * \b Effects: close the \c deadline_thread_pool for submissions.
+     * The worker threads will work until there is no more closures to run.
+     */
+    void close()
+    {
+      {
+        lock_guard<mutex> lk(mtx_);
+        closed_ = true;
+      }
+      not_empty_.notify_all();
+    }
+
+    /**
+     * \b Returns: whether the pool is closed for submissions.
+     */
+    bool closed()
+    {
+      lock_guard<mutex> lk(mtx_);
+      return closed_;
+    }
+
+    /**
+     * \b Returns: the number of quality of service classes.
+     */
+    unsigned num_classes() const
+    {
+      return static_cast<unsigned>(classes_.size());
+    }
+
+    /**
+     * \b Requires: <c>qos < num_classes()</c>.
+     *
+     * \b Returns: a snapshot of the metrics of the class \c qos.
+     */
+    qos_stats stats(unsigned qos) const
+    {
+      BOOST_ASSERT(qos < classes_.size());
+      lock_guard<mutex> lk(mtx_);
+      qos_stats res = classes_[qos].stats;
+      res.queued = classes_[qos].heap.size();
+      return res;
+    }
+
+    /**
+     * Effects: try to execute the closure with the earliest deadline, if its class hasn't reached its concurrency cap.
+     * Returns: whether a task has been executed.
+     * Throws: whatever the current task constructor throws or the task() throws.
+     */
+    bool try_executing_one()
+    {
+      unique_lock<mutex> lk(mtx_);
+      unsigned qos = 0;
+      if (! pick(qos, lk)) return false;
+      run_one(qos, lk);
+      return true;
+    }
+
+    /**
+     * Effects: schedule one task or yields
+     * Throws: whatever the current task constructor throws or the task() throws.
+     */
+    void schedule_one_or_yield()
+    {
+        if ( ! try_executing_one())
+        {
+          this_thread::yield();
+        }
+    }
+
+    /**
+     * \b Requires: <c>qos < num_classes()</c>. \c Closure is a model of \c Callable(void()) and a model of
+     * \c CopyConstructible/MoveConstructible.
+     *
+     * \b Effects: Enqueues \c closure in the class \c qos with the deadline \c deadline.
+     * If invoked closure throws an exception the \c deadline_thread_pool will call \c std::terminate, as is the case with threads.
+     *
+     * \b Throws: \c sync_queue_is_closed if the thread pool is closed.
+     * Whatever exception that can be throw while storing the closure.
+     */
+    template <class Duration>
+    void submit_before(unsigned qos, BOOST_THREAD_RV_REF(work) closure, chrono::time_point<clock, Duration> const& deadline)
+    {
+      push(qos, boost::move(closure), clock::now(), chrono::time_point_cast<clock::duration>(deadline));
+    }
+
+    template <typename Closure, class Duration>
+    void submit_before(unsigned qos, BOOST_THREAD_FWD_REF(Closure) closure, chrono::time_point<clock, Duration> const& deadline)
+    {
+      work w((boost::forward<Closure>(closure)));
+      submit_before(qos, boost::move(w), deadline);
+    }
+
+    /**
+     * \b Requires: <c>qos < num_classes()</c>. \c Closure is a model of \c Callable(void()) and a model of
+     * \c CopyConstructible/MoveConstructible.
+     *
+     * \b Effects: Enqueues \c closure in the class \c qos, with its submission time plus the deadline of the class as deadline.
+     *
+     * \b Throws: \c sync_queue_is_closed if the thread pool is closed.
+     * Whatever exception that can be throw while storing the closure.
+     */
+    void submit(unsigned qos, BOOST_THREAD_RV_REF(work) closure)
+    {
+      BOOST_ASSERT(qos < classes_.size());
+      clock::time_point now = clock::now();
+      push(qos, boost::move(closure), now, now + classes_[qos].config.deadline);
+    }
+
+#if defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+    template <typename Closure>
+    void submit(unsigned qos, Closure & closure)
+    {
+      submit(qos, work(closure));
+    }
+#endif
+    void submit(unsigned qos, void (*closure)())
+    {
+      submit(qos, work(closure));
+    }
+
+    template <typename Closure>
+    void submit(unsigned qos, BOOST_THREAD_FWD_REF(Closure) closure)
+    {
+      work w((boost::forward<Closure>(closure)));
+      submit(qos, boost::move(w));
+    }
+
+    /**
+     * \b Effects: As submit(0, closure).
+     */
+    void submit(BOOST_THREAD_RV_REF(work) closure)
+    {
+      submit(0u, boost::move(closure));
+    }
+
+#if defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+    template <typename Closure>
+    void submit(Closure & closure)
+    {
+      submit(work(closure));
+    }
+#endif
+    void submit(void (*closure)())
+    {
+      submit(work(closure));
+    }
+
+    template <typename Closure>
+    void submit(BOOST_THREAD_FWD_REF(Closure) closure)
+    {
+      work w((boost::forward<Closure>(closure)));
+      submit(boost::move(w));
+    }
+
+    /**
+     * \b Requires: This must be called from an scheduled task.
+     *
+     * \b Effects: reschedule functions until pred()
+     */
+    template <typename Pred>
+    bool reschedule_until(Pred const& pred)
+    {
+      do {
+        if ( ! try_executing_one())
+        {
+          return false;
+        }
+      } while (! pred());
+      return true;
+    }
+  };
+}
+using executors::deadline_thread_pool;
+using executors::qos_class;
+using executors::qos_stats;
+
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
+#endif
@@ -0,0 +1,187 @@
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_THREAD_EXECUTORS_DETAIL_CURRENT_WORKER_HPP
+#define BOOST_THREAD_EXECUTORS_DETAIL_CURRENT_WORKER_HPP
+
+#include <boost/thread/detail/config.hpp>
+#if defined BOOST_THREAD_PROVIDES_HELP_WHILE_WAITING
+
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/lock_guard.hpp>
+#include <boost/atomic.hpp>
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+namespace executors
+{
+namespace detail
+{
+  // Wait of a worker which has found no closure to run, woken up when a closure is queued on its executor.
+  class work_waiter
+  {
+    friend class work_waiters;
+    work_waiter* prev_;
+    work_waiter* next_;
+
+  public:
+    work_waiter() : prev_(0), next_(0) {}
+    // Called when a closure is queued, with the list of the waiters locked.
+    virtual void on_work() = 0;
+  protected:
+    ~work_waiter() {}
+  };
+
+  // Waiters of the workers of an executor, notified by the executor each time it queues closures.
+  class work_waiters
+  {
+    mutex mtx_;
+    work_waiter* head_;
+    atomic<unsigned> count_;
+
+    work_waiters(work_waiters const&);
+    work_waiters& operator=(work_waiters const&);
+
+  public:
+    work_waiters() : head_(0), count_(0) {}
+
+    void add(work_waiter& w)
+    {
+      lock_guard<mutex> lk(mtx_);
+      w.prev_ = 0;
+      w.next_ = head_;
+      if (head_) head_->prev_ = &w;
+      head_ = &w;
+      count_.fetch_add(1, memory_order_seq_cst);
+    }
+
+    void remove(work_waiter& w)
+    {
+      lock_guard<mutex> lk(mtx_);
+      if (w.prev_) w.prev_->next_ = w.next_;
+      else head_ = w.next_;
+      if (w.next_) w.next_->prev_ = w.prev_;
+      count_.fetch_sub(1, memory_order_relaxed);
+    }
+
+    // Called by the executor once it has queued closures. Costs a load when no worker waits.
+    void notify()
+    {
+      // Either the waiter registered before sees the closure queued, or the closure queued before sees the waiter.
+      atomic_thread_fence(memory_order_seq_cst);
+      if (count_.load(memory_order_relaxed) == 0) return;
+      lock_guard<mutex> lk(mtx_);
+      for (work_waiter* w = head_; w != 0; w = w->next_)
+      {
+        w->on_work();
+      }
+    }
+  };
+
+  // Opened by the worker threads of an executor around their scheduling loop, so that a closure waiting for a future
+  // can run the other closures queued on the executor instead of blocking the worker.
+  class current_worker
+  {
+    void* executor_;
+    bool (*try_executing_one_)(void*);
+    work_waiters* waiters_;
+    current_worker* outer_;
+    unsigned depth_;
+
+    static current_worker*& current()
+    {
+      static thread_local current_worker* worker = 0;
+      return worker;
+    }
+
+    template <class Executor>
+    static bool try_executing_one_of(void* ex)
+    {
+      return static_cast<Executor*>(ex)->try_executing_one();
+    }
+
+    current_worker(current_worker const&);
+    current_worker& operator=(current_worker const&);
+
+  public:
+    template <class Executor>
+    current_worker(Executor& ex, work_waiters& waiters) :
+      executor_(&ex),
+      try_executing_one_(&try_executing_one_of<Executor>),
+      waiters_(&waiters),
+      outer_(current()),
+      depth_(0)
+    {
+      current() = this;
+    }
+
+    ~current_worker()
+    {
+      current() = outer_;
+    }
+
+    // Returns: the worker scope of the calling thread, if any.
+    static current_worker* get()
+    {
+      return current();
+    }
+
+    // Returns: whether the calling thread is a worker of the executor whose identity is \c identity.
+    bool works_for(void const* identity) const
+    {
+      return executor_ == identity;
+    }
+
+    // Returns: whether a new wait may run closures, the waits already doing it being nested less than the limit.
+    bool can_help() const
+    {
+      return depth_ < BOOST_THREAD_HELP_WHILE_WAITING_DEPTH;
+    }
+
+    bool try_executing_one()
+    {
+      return try_executing_one_(executor_);
+    }
+
+    // Effects: Registers \c w, notified by the executor each time it queues closures until it is unregistered.
+    void wait_for_work(work_waiter& w)
+    {
+      waiters_->add(w);
+    }
+    void stop_waiting_for_work(work_waiter& w)
+    {
+      waiters_->remove(w);
+    }
+
+    // Counts a wait running closures for the lifetime of the guard.
+    class helping
+    {
+      current_worker& worker_;
+
+      helping(helping const&);
+      helping& operator=(helping const&);
+
+    public:
+      explicit helping(current_worker& worker) : worker_(worker)
+      {
+        ++worker_.depth_;
+      }
+      ~helping()
+      {
+        --worker_.depth_;
+      }
+    };
+  };
+}
+}
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
+#endif
@@ -107,6 +107,31 @@ namespace boost
       submit(boost::move(w));
     }
 
+    /**
+     * \par Effects
+     * The closures in [first, last) are moved into the executor as a single submission.
+     * The default implementation submits them one by one; executors able to enqueue several
+     * closures under a single lock and wake up their workers once override it.
+     *
+     * \par Throws
+     * \c sync_queue_is_closed if the executor is closed.
+     * Whatever exception that can be throw while storing the closures.
+     */
+    virtual void submit_bulk(work* first, work* last)
+    {
+      for (; first != last; ++first)
+      {
+        submit(boost::move(*first));
+      }
+    }
+
+    /**
+     * \par Returns
+     * The address of the executor the closures are finally submitted to.
+     * Type-erased wrappers referring to the same executor return the same address.
+     */
+    virtual void const* identity() const { return this; }
+
     /**
      * \par Effects
      * Try to execute one task.
@@ -140,6 +165,40 @@ namespace boost
     }
   };
 
+  /**
+   * \par Effects
+   * Submits the closures in [first, last) to \c ex.
+   * Executors providing a cheaper bulk submission overload this function; the generic version submits the closures one by one.
+   */
+  template <typename Executor>
+  void submit_bulk(Executor& ex, executor::work* first, executor::work* last)
+  {
+    for (; first != last; ++first)
+    {
+      ex.submit(boost::move(*first));
+    }
+  }
+
+  inline void submit_bulk(executor& ex, executor::work* first, executor::work* last)
+  {
+    ex.submit_bulk(first, last);
+  }
+
+  namespace detail
+  {
+    // Pointer overloads: a pointer to an executor is a better match than a pointer to void,
+    // so wrapping an executor forwards to its own identity.
+    inline void const* identity_of(executor const* ex) { return ex->identity(); }
+    inline void const* identity_of(void const* ex) { return ex; }
+
+    // Qualified entry point used by the wrappers, whose own submit_bulk member would otherwise hide the overloads found by ADL.
+    template <typename Executor>
+    void submit_bulk_to(Executor& ex, executor::work* first, executor::work* last)
+    {
+      submit_bulk(ex, first, last);
+    }
+  }
+
   }
   using executors::executor;
 }
@@ -120,6 +120,16 @@ namespace executors
       submit(boost::move(w));
     }
 
+    /**
+     * \b Effects: the closures in [first, last) are submitted to the underlying executor as a single submission.
+     */
+    void submit_bulk(work* first, work* last)
+    {
+      executors::detail::submit_bulk_to(ex, first, last);
+    }
+
+    void const* identity() const { return executors::detail::identity_of(&ex); }
+
     /**
      * Effects: try to execute one task.
      * Returns: whether a task has been executed.
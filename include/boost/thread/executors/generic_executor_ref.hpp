@@ -76,6 +76,19 @@ namespace boost
 //      ex.submit(closure);
 //    }
 
+    /**
+     * \par Effects
+     * The closures in [first, last) are submitted to the referenced executor as a single submission.
+     */
+    void submit_bulk(work* first, work* last) {
+      executors::detail::submit_bulk_to(ex, first, last);
+    }
+
+    /**
+     * \par Returns
+     * The address of the referenced executor.
+     */
+    void const* identity() const { return executors::detail::identity_of(&ex); }
 
     /**
      * \par Effects
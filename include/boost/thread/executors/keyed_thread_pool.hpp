@@ -0,0 +1,274 @@
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_THREAD_EXECUTORS_KEYED_THREAD_POOL_HPP
+#define BOOST_THREAD_EXECUTORS_KEYED_THREAD_POOL_HPP
+
+#include <boost/thread/detail/config.hpp>
+#if defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION && defined BOOST_THREAD_PROVIDES_EXECUTORS && defined BOOST_THREAD_USES_MOVE
+
+#include <boost/thread/detail/delete.hpp>
+#include <boost/thread/detail/move.hpp>
+#include <boost/thread/detail/mix_hash.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/concurrent_queues/sync_queue.hpp>
+#include <boost/thread/executors/work.hpp>
+#include <boost/thread/csbl/vector.hpp>
+#include <boost/functional/hash.hpp>
+#include <boost/atomic.hpp>
+#include <boost/scoped_array.hpp>
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+namespace executors
+{
+  /**
+   * Thread pool partitioned by key.
+   * Each worker owns a queue, and the closures submitted with the same key are pushed on the queue of the same worker,
+   * so that they are run one after the other in submission order while the closures of other keys run in parallel.
+   * As the state of a key is only accessed by its worker, it stays in the cache of the core running this worker.
+   */
+  class keyed_thread_pool
+  {
+  public:
+    /// type-erasure to store the works to do
+    typedef  executors::work work;
+  private:
+    typedef thread thread_t;
+    /// A move aware vector type
+    typedef csbl::vector<thread_t> thread_vector;
+
+    /// A move aware vector
+    thread_vector threads;
+    /// the thread safe work queue of each worker
+    scoped_array<concurrent::sync_queue<work> > work_queues;
+    unsigned size;
+    /// the partition of the next closure submitted without key.
+    atomic<unsigned> next;
+
+    /**
+     * The main loop of the worker threads
+     */
+    void worker_thread(unsigned index)
+    {
+      try
+      {
+        for(;;)
+        {
+          work task;
+          queue_op_status st = work_queues[index].wait_pull(task);
+          if (st == queue_op_status::closed) {
+            return;
+          }
+          task();
+        }
+      }
+      catch (...)
+      {
+        std::terminate();
+        return;
+      }
+    }
+
+  public:
+    /// keyed_thread_pool is not copyable.
+    BOOST_THREAD_NO_COPYABLE(keyed_thread_pool)
+
+    /**
+     * \b Effects: creates a thread pool with \c thread_count partitions, each one run by its own thread.
+     *
+     * \b Throws: Whatever exception is thrown while initializing the needed resources.
+     */
+    keyed_thread_pool(unsigned const thread_count = thread::hardware_concurrency())
+    : work_queues(new concurrent::sync_queue<work>[thread_count == 0 ? 1 : thread_count]),
+      size(thread_count == 0 ? 1 : thread_count),
+      next(0)
+    {
+      try
+      {
+        threads.reserve(size);
+        for (unsigned i = 0; i < size; ++i)
+        {
+          thread th (&keyed_thread_pool::worker_thread, this, i);
+          threads.push_back(thread_t(boost::move(th)));
+        }
+      }
+      catch (...)
+      {
+        close();
+        join();
+        throw;
+      }
+    }
+    /**
+     * \b Effects: Destroys the thread pool.
+     *
+     * \b Synchronization: The completion of all the closures happen before the completion of the \c keyed_thread_pool destructor.
+     */
+    ~keyed_thread_pool()
+    {
+      // signal to all the worker threads that there will be no more submissions.
+      close();
+      // the workers run the remaining closures of their queue before exiting.
+      join();
+    }
+
+    /**
+     * \b Effects: join all the threads.
+     */
+    void join()
+    {
+      for (unsigned i = 0; i < threads.size(); ++i)
+      {
+        if (threads[i].joinable()) threads[i].join();
+      }
+    }
+
+    /**
+     * \b Effects: close the \c keyed_thread_pool for submissions.
+     * The worker threads will work until there is no more closures to run.
+     */
+    void close()
+    {
+      for (unsigned i = 0; i < size; ++i)
+      {
+        work_queues[i].close();
+      }
+    }
+
+    /**
+     * \b Returns: whether the pool is closed for submissions.
+     */
+    bool closed()
+    {
+      return work_queues[0].closed();
+    }
+
+    /**
+     * \b Returns: the number of partitions, that is the number of worker threads.
+     */
+    unsigned num_threads() const
+    {
+      return size;
+    }
+
+    /**
+     * \b Returns: the partition on which the closures submitted with \c key are run.
+     */
+    template <typename Key>
+    unsigned partition(Key const& key) const
+    {
+      return static_cast<unsigned>(detail::mix_hash(boost::hash<Key>()(key)) % size);
+    }
+
+    /**
+     * \b Effects: none.
+     * \b Returns: false. Running a closure out of the queue of its worker would break the order of its key.
+     */
+    bool try_executing_one()
+    {
+      return false;
+    }
+
+    /**
+     * \b Effects: yields.
+     */
+    void schedule_one_or_yield()
+    {
+      this_thread::yield();
+    }
+
+    /**
+     * \b Requires: \c Closure is a model of \c Callable(void()) and a model of \c CopyConstructible/MoveConstructible.
+     *
+     * \b Effects: The specified \c closure will be run by the worker of the partition of \c key, once the closures
+     * previously submitted with a key of this partition have completed.
+     * If invoked closure throws an exception the \c keyed_thread_pool will call \c std::terminate, as is the case with threads.
+     *
+     * \b Synchronization: completion of a closure happens before the start of the closures submitted after it with the same key.
+     *
+     * \b Throws: \c sync_queue_is_closed if the thread pool is closed.
+     * Whatever exception that can be throw while storing the closure.
+     */
+    template <typename Key>
+    void submit(Key const& key, BOOST_THREAD_RV_REF(work) closure)
+    {
+      work_queues[partition(key)].push(boost::move(closure));
+    }
+
+#if defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+    template <typename Key, typename Closure>
+    void submit(Key const& key, Closure & closure)
+    {
+      submit(key, work(closure));
+    }
+#endif
+    template <typename Key>
+    void submit(Key const& key, void (*closure)())
+    {
+      submit(key, work(closure));
+    }
+
+    template <typename Key, typename Closure>
+    void submit(Key const& key, BOOST_THREAD_FWD_REF(Closure) closure)
+    {
+      work w((boost::forward<Closure>(closure)));
+      submit(key, boost::move(w));
+    }
+
+    /**
+     * \b Effects: The specified \c closure, which isn't ordered with respect to any other closure, is pushed on the
+     * queue of the partitions in turn.
+     *
+     * \b Throws: \c sync_queue_is_closed if the thread pool is closed.
+     * Whatever exception that can be throw while storing the closure.
+     */
+    void submit(BOOST_THREAD_RV_REF(work) closure)
+    {
+      work_queues[next.fetch_add(1, memory_order_relaxed) % size].push(boost::move(closure));
+    }
+
+#if defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+    template <typename Closure>
+    void submit(Closure & closure)
+    {
+      submit(work(closure));
+    }
+#endif
+    void submit(void (*closure)())
+    {
+      submit(work(closure));
+    }
+
+    template <typename Closure>
+    void submit(BOOST_THREAD_FWD_REF(Closure) closure)
+    {
+      work w((boost::forward<Closure>(closure)));
+      submit(boost::move(w));
+    }
+
+    /**
+     * \b Requires: This must be called from an scheduled task.
+     *
+     * \b Effects: reschedule functions until pred()
+     * \b Returns: false, as no closure can be run out of the queue of its worker.
+     */
+    template <typename Pred>
+    bool reschedule_until(Pred const&)
+    {
+      return false;
+    }
+  };
+}
+using executors::keyed_thread_pool;
+
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
+#endif
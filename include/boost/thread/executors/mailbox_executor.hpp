@@ -0,0 +1,331 @@
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_THREAD_EXECUTORS_MAILBOX_EXECUTOR_HPP
+#define BOOST_THREAD_EXECUTORS_MAILBOX_EXECUTOR_HPP
+
+#include <boost/thread/detail/config.hpp>
+#if defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION && defined BOOST_THREAD_PROVIDES_EXECUTORS && defined BOOST_THREAD_USES_MOVE
+
+#include <exception> // std::terminate
+#include <boost/throw_exception.hpp>
+#include <boost/thread/detail/delete.hpp>
+#include <boost/thread/detail/move.hpp>
+#include <boost/thread/concurrent_queues/queue_op_status.hpp>
+#include <boost/thread/executors/work.hpp>
+#include <boost/thread/thread_only.hpp>
+#include <boost/atomic.hpp>
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+namespace executors
+{
+  /**
+   * Serial executor meant to be instantiated once per session, actor or any other serialized entity.
+   * The closures are pushed on a lock-free multiple producers/single consumer queue, and a single job draining this
+   * queue is submitted to the underlying executor when the mailbox goes from empty to non-empty. An idle mailbox owns
+   * neither a thread, a mutex nor a shared state, and takes a few words.
+   */
+  template <class Executor>
+  class mailbox_executor
+  {
+  public:
+    /// type-erasure to store the works to do
+    typedef  executors::work work;
+  private:
+    struct node_base
+    {
+      atomic<node_base*> next;
+
+      node_base() : next(0) {}
+    };
+
+    struct node : node_base
+    {
+      work closure;
+
+      explicit node(BOOST_THREAD_RV_REF(work) w) : closure(boost::move(w)) {}
+    };
+
+    // The job submitted to the underlying executor.
+    struct drain_job
+    {
+      mailbox_executor* mailbox;
+
+      void operator()() const
+      {
+        mailbox->drain();
+      }
+    };
+
+    Executor* ex_;
+    /// the last pushed node, shared by the producers
+    atomic<node_base*> head_;
+    /// the node preceding the next one to pop, owned by the job draining the mailbox
+    node_base* tail_;
+    node_base stub_;
+    /// the number of closures submitted and not yet run. The mailbox is scheduled while it isn't zero.
+    atomic<std::size_t> pending_;
+    unsigned budget_;
+    atomic<bool> closed_;
+
+    void push(node_base* n)
+    {
+      n->next.store(0, memory_order_relaxed);
+      node_base* prev = head_.exchange(n, memory_order_acq_rel);
+      prev->next.store(n, memory_order_release);
+    }
+
+    // Returns: the next node, or 0 if the queue is empty or if the node following the tail is being linked.
+    node* pop()
+    {
+      node_base* tail = tail_;
+      node_base* next = tail->next.load(memory_order_acquire);
+      if (tail == &stub_)
+      {
+        if (next == 0) return 0;
+        tail_ = next;
+        tail = next;
+        next = next->next.load(memory_order_acquire);
+      }
+      if (next != 0)
+      {
+        tail_ = next;
+        return static_cast<node*>(tail);
+      }
+      if (tail != head_.load(memory_order_acquire)) return 0;
+      // tail is the last node; the stub is pushed behind it so that it can be popped.
+      push(&stub_);
+      next = tail->next.load(memory_order_acquire);
+      if (next != 0)
+      {
+        tail_ = next;
+        return static_cast<node*>(tail);
+      }
+      return 0;
+    }
+
+    /**
+     * Requires: The underlying executor has failed to accept the job draining the mailbox, so that this thread is the
+     * only one scheduling it and can take over the consumer role.
+     *
+     * Effects: Discards the closures queued in the mailbox, including the ones pushed meanwhile, until none is
+     * pending. The mailbox must not be accessed afterwards, as it can be destroyed.
+     */
+    void discard_queued()
+    {
+      for (;;)
+      {
+        std::size_t removed = 0;
+        while (node* n = pop())
+        {
+          delete n;
+          ++removed;
+        }
+        if (pending_.fetch_sub(removed, memory_order_acq_rel) == removed) return;
+        // a closure counted in pending_ is not linked yet.
+        this_thread::yield();
+      }
+    }
+
+    /**
+     * Runs at most budget_ closures, then submits itself again if closures remain, so that the other mailboxes
+     * sharing the underlying executor are not starved. If the underlying executor doesn't accept the job any more,
+     * the remaining closures are discarded.
+     */
+    void drain()
+    {
+      std::size_t done = 0;
+      try
+      {
+        while (done < budget_)
+        {
+          node* n = pop();
+          // a closure counted in pending_ may not be linked yet.
+          if (n == 0) break;
+          n->closure();
+          delete n;
+          ++done;
+        }
+      }
+      catch (...)
+      {
+        std::terminate();
+      }
+      // The mailbox must not be accessed once pending_ has reached zero, as it can be destroyed.
+      if (pending_.fetch_sub(done, memory_order_acq_rel) != done)
+      {
+        try
+        {
+          drain_job job = {this};
+          ex_->submit(job);
+        }
+        catch (...)
+        {
+          discard_queued();
+        }
+      }
+    }
+
+  public:
+    /// mailbox_executor is not copyable.
+    BOOST_THREAD_NO_COPYABLE(mailbox_executor)
+
+    /**
+     * \b Effects: creates a mailbox that runs its closures on \c ex, at most \c budget of them each time it is scheduled.
+     *
+     * \b Throws: Nothing.
+     */
+    explicit mailbox_executor(Executor& ex, unsigned budget = 64) BOOST_NOEXCEPT
+    : ex_(&ex), head_(&stub_), tail_(&stub_), pending_(0), budget_(budget == 0 ? 1 : budget), closed_(false)
+    {
+    }
+
+    /**
+     * \b Requires: The destructor is not called from one of the closures of the mailbox.
+     *
+     * \b Effects: Closes the mailbox and waits until its closures have been run.
+     * While waiting, the calling thread runs the closures of the underlying executor, if any.
+     *
+     * \b Synchronization: The completion of all the closures happen before the completion of the \c mailbox_executor destructor.
+     */
+    ~mailbox_executor()
+    {
+      close();
+      while (pending_.load(memory_order_acquire) != 0)
+      {
+        if (! ex_->try_executing_one())
+        {
+          this_thread::yield();
+        }
+      }
+    }
+
+    /**
+     * \b Returns: The underlying executor.
+     */
+    Executor& underlying_executor() BOOST_NOEXCEPT { return *ex_; }
+
+    /**
+     * \b Effects: close the \c mailbox_executor for submissions.
+     * The closures already submitted will be run.
+     */
+    void close()
+    {
+      closed_.store(true, memory_order_release);
+    }
+
+    /**
+     * \b Returns: whether the mailbox is closed for submissions.
+     */
+    bool closed()
+    {
+      return closed_.load(memory_order_acquire);
+    }
+
+    /**
+     * \b Returns: whether the mailbox has no closure left to run.
+     */
+    bool empty() const
+    {
+      return pending_.load(memory_order_acquire) == 0;
+    }
+
+    /**
+     * \b Effects: try to execute one closure of the underlying executor, which may be the job draining this mailbox.
+     * \b Returns: whether a closure has been executed.
+     */
+    bool try_executing_one()
+    {
+      return ex_->try_executing_one();
+    }
+
+    /**
+     * \b Requires: \c Closure is a model of \c Callable(void()) and a model of \c CopyConstructible/MoveConstructible.
+     *
+     * \b Effects: The specified \c closure will be run on the underlying executor once the closures previously
+     * submitted to this mailbox have completed. If the mailbox was empty, the job draining it is submitted to the
+     * underlying executor.
+     * If invoked closure throws an exception the \c mailbox_executor will call \c std::terminate, as is the case with threads.
+     *
+     * \b Synchronization: The completion of a closure happens before the start of the next closure of the mailbox.
+     *
+     * \b Throws: \c sync_queue_is_closed if the mailbox is closed.
+     * Whatever exception that can be throw while storing the closure or submitting the job to the underlying executor,
+     * e.g. \c sync_queue_is_closed if it is closed. In the latter case the closures queued in the mailbox are
+     * discarded, as they would never be run. The same happens when the job draining the mailbox fails to submit
+     * itself again.
+     */
+    void submit(BOOST_THREAD_RV_REF(work) closure)
+    {
+      if (closed())
+      {
+        throw_exception( sync_queue_is_closed() );
+      }
+      node* n = new node(boost::move(closure));
+      // The closure is counted before being pushed, so that the drain job never pops a closure it doesn't know of.
+      bool was_empty = pending_.fetch_add(1, memory_order_acq_rel) == 0;
+      push(n);
+      if (was_empty)
+      {
+        try
+        {
+          drain_job job = {this};
+          ex_->submit(job);
+        }
+        catch (...)
+        {
+          discard_queued();
+          throw;
+        }
+      }
+    }
+
+#if defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+    template <typename Closure>
+    void submit(Closure & closure)
+    {
+      submit(work(closure));
+    }
+#endif
+    void submit(void (*closure)())
+    {
+      submit(work(closure));
+    }
+
+    template <typename Closure>
+    void submit(BOOST_THREAD_FWD_REF(Closure) closure)
+    {
+      work w((boost::forward<Closure>(closure)));
+      submit(boost::move(w));
+    }
+
+    /**
+     * \b Requires: This must be called from an scheduled task.
+     *
+     * \b Effects: reschedule functions until pred()
+     */
+    template <typename Pred>
+    bool reschedule_until(Pred const& pred)
+    {
+      do {
+        if ( ! try_executing_one())
+        {
+          return false;
+        }
+      } while (! pred());
+      return true;
+    }
+  };
+}
+using executors::mailbox_executor;
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
+#endif
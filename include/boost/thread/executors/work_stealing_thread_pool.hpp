@@ -0,0 +1,409 @@
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_THREAD_EXECUTORS_WORK_STEALING_THREAD_POOL_HPP
+#define BOOST_THREAD_EXECUTORS_WORK_STEALING_THREAD_POOL_HPP
+
+#include <boost/thread/detail/config.hpp>
+#if defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION && defined BOOST_THREAD_PROVIDES_EXECUTORS && defined BOOST_THREAD_USES_MOVE \
+ && ! defined BOOST_NO_CXX11_THREAD_LOCAL
+
+#include <boost/thread/detail/delete.hpp>
+#include <boost/thread/detail/move.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/lock_guard.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/concurrent_queues/sync_queue.hpp>
+#include <boost/thread/executors/work.hpp>
+#include <boost/thread/executors/detail/current_worker.hpp>
+#include <boost/thread/csbl/deque.hpp>
+#include <boost/thread/csbl/vector.hpp>
+#include <boost/atomic.hpp>
+#include <boost/scoped_array.hpp>
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+namespace executors
+{
+  /**
+   * Thread pool for fork-join parallelism.
+   * A closure submitted by one of the workers is pushed on the deque of this worker, which runs its own closures last in,
+   * first out. A worker without closures takes the ones submitted from outside the pool, then steals the oldest closure
+   * of another worker.
+   */
+  class work_stealing_thread_pool
+  {
+  public:
+    /// type-erasure to store the works to do
+    typedef  executors::work work;
+  private:
+    typedef thread thread_t;
+    /// A move aware vector type
+    typedef csbl::vector<thread_t> thread_vector;
+
+    struct work_deque
+    {
+      mutex mtx;
+      csbl::deque<work> closures;
+
+      bool pop_back(work& closure)
+      {
+        lock_guard<mutex> lk(mtx);
+        if (closures.empty()) return false;
+        closure = boost::move(closures.back());
+        closures.pop_back();
+        return true;
+      }
+      bool pop_front(work& closure)
+      {
+        lock_guard<mutex> lk(mtx);
+        if (closures.empty()) return false;
+        closure = boost::move(closures.front());
+        closures.pop_front();
+        return true;
+      }
+    };
+
+    // Identifies the worker running on the current thread.
+    struct worker_id
+    {
+      work_stealing_thread_pool* pool;
+      unsigned index;
+    };
+
+    static worker_id*& current()
+    {
+      static thread_local worker_id* id = 0;
+      return id;
+    }
+
+    /// A move aware vector
+    thread_vector threads;
+    /// One deque per worker, then the deque of the closures submitted from outside the pool.
+    scoped_array<work_deque> deques;
+    unsigned size;
+    /// Number of closures in the deques.
+    atomic<std::size_t> pending;
+    /// Number of workers waiting for closures.
+    atomic<unsigned> sleepers;
+    atomic<bool> closed_;
+    mutex idle_mtx;
+    condition_variable idle_cv;
+#if defined BOOST_THREAD_PROVIDES_HELP_WHILE_WAITING
+    /// The waits of the workers helping while they wait, notified when closures are pushed.
+    detail::work_waiters helpers;
+#endif
+
+    work_deque& outside()
+    {
+      return deques[size];
+    }
+
+    // Returns: the index of the calling worker, or size if the calling thread isn't a worker of this pool.
+    unsigned current_index()
+    {
+      worker_id* id = current();
+      return (id != 0 && id->pool == this) ? id->index : size;
+    }
+
+    void notify_sleepers(bool all)
+    {
+#if defined BOOST_THREAD_PROVIDES_HELP_WHILE_WAITING
+      helpers.notify();
+#endif
+      if (sleepers.load() != 0)
+      {
+        lock_guard<mutex> lk(idle_mtx);
+        if (all) idle_cv.notify_all();
+        else idle_cv.notify_one();
+      }
+    }
+
+    bool take(unsigned index, work& closure)
+    {
+      if (pending.load(memory_order_relaxed) == 0) return false;
+      if (index < size && deques[index].pop_back(closure)) return true;
+      if (outside().pop_front(closure)) return true;
+      for (unsigned i = 1; i <= size; ++i)
+      {
+        unsigned victim = (index + i) % size;
+        if (victim != index && deques[victim].pop_front(closure)) return true;
+      }
+      return false;
+    }
+
+    bool execute_one(unsigned index)
+    {
+      work closure;
+      if (! take(index, closure)) return false;
+      pending.fetch_sub(1);
+      closure();
+      return true;
+    }
+
+    /**
+     * The main loop of the worker threads
+     */
+    void worker_thread(unsigned index)
+    {
+      worker_id id = {this, index};
+      current() = &id;
+#if defined BOOST_THREAD_PROVIDES_HELP_WHILE_WAITING
+      detail::current_worker worker(*this, helpers);
+#endif
+      try
+      {
+        for(;;)
+        {
+          if (execute_one(index)) continue;
+          unique_lock<mutex> lk(idle_mtx);
+          sleepers.fetch_add(1);
+          if (pending.load() == 0)
+          {
+            if (closed_.load()) {
+              sleepers.fetch_sub(1);
+              break;
+            }
+            idle_cv.wait(lk);
+          }
+          sleepers.fetch_sub(1);
+        }
+      }
+      catch (...)
+      {
+        std::terminate();
+      }
+      current() = 0;
+    }
+
+    void push(unsigned index, BOOST_THREAD_RV_REF(work) closure)
+    {
+      work_deque& d = index < size ? deques[index] : outside();
+      {
+        lock_guard<mutex> lk(d.mtx);
+        d.closures.push_back(boost::move(closure));
+      }
+      pending.fetch_add(1);
+      notify_sleepers(false);
+    }
+
+  public:
+    /// work_stealing_thread_pool is not copyable.
+    BOOST_THREAD_NO_COPYABLE(work_stealing_thread_pool)
+
+    /**
+     * \b Effects: creates a thread pool that runs closures on \c thread_count threads.
+     *
+     * \b Throws: Whatever exception is thrown while initializing the needed resources.
+     */
+    work_stealing_thread_pool(unsigned const thread_count = thread::hardware_concurrency())
+    : deques(new work_deque[(thread_count == 0 ? 1 : thread_count) + 1]),
+      size(thread_count == 0 ? 1 : thread_count),
+      pending(0),
+      sleepers(0),
+      closed_(false)
+    {
+      try
+      {
+        threads.reserve(size);
+        for (unsigned i = 0; i < size; ++i)
+        {
+          thread th (&work_stealing_thread_pool::worker_thread, this, i);
+          threads.push_back(thread_t(boost::move(th)));
+        }
+      }
+      catch (...)
+      {
+        close();
+        join();
+        throw;
+      }
+    }
+    /**
+     * \b Effects: Destroys the thread pool.
+     *
+     * \b Synchronization: The completion of all the closures happen before the completion of the \c work_stealing_thread_pool destructor.
+     */
+    ~work_stealing_thread_pool()
+    {
+      // signal to all the worker threads that there will be no more submissions.
+      close();
+      // the workers run the remaining closures before exiting.
+      join();
+    }
+
+    /**
+     * \b Effects: join all the threads.
+     */
+    void join()
+    {
+      for (unsigned i = 0; i < threads.size(); ++i)
+      {
+        if (threads[i].joinable()) threads[i].join();
+      }
+    }
+
+    /**
+     * \b Effects: close the \c work_stealing_thread_pool for submissions from outside the pool.
+     * The worker threads will work until there is no more closures to run, and can still submit closures until then.
+     */
+    void close()
+    {
+      closed_.store(true);
+      notify_sleepers(true);
+    }
+
+    /**
+     * \b Returns: whether the pool is closed for submissions.
+     */
+    bool closed()
+    {
+      return closed_.load();
+    }
+
+    /**
+     * \b Returns: the number of worker threads.
+     */
+    unsigned num_threads() const
+    {
+      return size;
+    }
+
+    /**
+     * \b Returns: whether the calling thread is a worker thread of this pool.
+     */
+    bool is_worker()
+    {
+      return current_index() != size;
+    }
+
+    /**
+     * \b Effects: try to execute one task. A worker runs first the last closure it has submitted.
+     * \b Returns: whether a task has been executed.
+     * \b Throws: whatever the current task constructor throws or the task() throws.
+     */
+    bool try_executing_one()
+    {
+      try
+      {
+        return execute_one(current_index());
+      }
+      catch (...)
+      {
+        std::terminate();
+      }
+    }
+
+    /**
+     * \b Effects: schedule one task or yields
+     * \b Throws: whatever the current task constructor throws or the task() throws.
+     */
+    void schedule_one_or_yield()
+    {
+        if ( ! try_executing_one())
+        {
+          this_thread::yield();
+        }
+    }
+
+    /**
+     * \b Requires: \c Closure is a model of \c Callable(void()) and a model of \c CopyConstructible/MoveConstructible.
+     *
+     * \b Effects: The specified \c closure will be scheduled for execution at some point in the future.
+     * If called from a worker of the pool, the closure is pushed on the deque of this worker.
+     * If invoked closure throws an exception the \c work_stealing_thread_pool will call \c std::terminate, as is the case with threads.
+     *
+     * \b Throws: \c sync_queue_is_closed if the thread pool is closed and the calling thread is not one of its workers.
+     * Whatever exception that can be throw while storing the closure.
+     */
+    void submit(BOOST_THREAD_RV_REF(work) closure)  {
+      unsigned index = current_index();
+      if (index == size && closed_.load())
+      {
+        throw_exception( sync_queue_is_closed() );
+      }
+      push(index, boost::move(closure));
+    }
+
+#if defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+    template <typename Closure>
+    void submit(Closure & closure)
+    {
+      submit(work(closure));
+    }
+#endif
+    void submit(void (*closure)())
+    {
+      submit(work(closure));
+    }
+
+    template <typename Closure>
+    void submit(BOOST_THREAD_FWD_REF(Closure) closure)
+    {
+      work w((boost::forward<Closure>(closure)));
+      submit(boost::move(w));
+    }
+
+    /**
+     * \b Effects: The closures in [first, last) are pushed under a single lock of the deque
+     * and the idle worker threads are woken up once.
+     *
+     * \b Throws: \c sync_queue_is_closed if the thread pool is closed and the calling thread is not one of its workers.
+     * Whatever exception that can be throw while storing the closures.
+     */
+    void submit_bulk(work* first, work* last)
+    {
+      if (first == last) return;
+      unsigned index = current_index();
+      if (index == size && closed_.load())
+      {
+        throw_exception( sync_queue_is_closed() );
+      }
+      work_deque& d = index < size ? deques[index] : outside();
+      {
+        lock_guard<mutex> lk(d.mtx);
+        for (work* it = first; it != last; ++it)
+        {
+          d.closures.push_back(boost::move(*it));
+        }
+      }
+      pending.fetch_add(last - first);
+      notify_sleepers(true);
+    }
+
+    /**
+     * \b Requires: This must be called from an scheduled task.
+     *
+     * \b Effects: reschedule functions until pred()
+     */
+    template <typename Pred>
+    bool reschedule_until(Pred const& pred)
+    {
+      do {
+        if ( ! try_executing_one())
+        {
+          return false;
+        }
+      } while (! pred());
+      return true;
+    }
+  };
+
+  inline void submit_bulk(work_stealing_thread_pool& ex, work_stealing_thread_pool::work* first, work_stealing_thread_pool::work* last)
+  {
+    ex.submit_bulk(first, last);
+  }
+}
+using executors::work_stealing_thread_pool;
+
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
+#endif
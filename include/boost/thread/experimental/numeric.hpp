@@ -0,0 +1,16 @@
+#ifndef BOOST_THREAD_EXPERIMENTAL_NUMERIC_HPP
+#define BOOST_THREAD_EXPERIMENTAL_NUMERIC_HPP
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright The Boost.Thread Contributors 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/thread for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <boost/thread/experimental/parallel/v1/numeric.hpp>
+
+#endif
@@ -0,0 +1,477 @@
+#ifndef BOOST_THREAD_EXPERIMENTAL_PARALLEL_V1_ALGORITHM_HPP
+#define BOOST_THREAD_EXPERIMENTAL_PARALLEL_V1_ALGORITHM_HPP
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright The Boost.Thread Contributors 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/thread for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <boost/thread/detail/config.hpp>
+#include <boost/thread/future.hpp>
+
+#if defined BOOST_THREAD_PROVIDES_EXECUTORS
+
+#include <boost/thread/experimental/parallel/v1/exception_list.hpp>
+#include <boost/thread/experimental/parallel/v1/inline_namespace.hpp>
+#include <boost/thread/csbl/vector.hpp>
+#include <boost/thread/detail/delete.hpp>
+#include <boost/thread/detail/move.hpp>
+#include <boost/thread/thread_only.hpp>
+#include <boost/exception_ptr.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/move/algo/move.hpp>
+#include <boost/move/iterator.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+namespace experimental
+{
+namespace parallel
+{
+BOOST_THREAD_INLINE_NAMESPACE(v1)
+{
+  namespace detail
+  {
+    // Number of chunks a range of n elements is split into: a few per hardware thread, so that the chunks claimed
+    // by async_bulk() balance the load.
+    inline std::size_t chunk_count(std::size_t n)
+    {
+      std::size_t width = boost::thread::hardware_concurrency();
+      if (width == 0) width = 1;
+      std::size_t chunks = 4 * width;
+      return n < chunks ? n : chunks;
+    }
+
+    // Returns: the index of the first element of the chunk i when n elements are split into chunks chunks.
+    inline std::size_t chunk_begin(std::size_t n, std::size_t chunks, std::size_t i)
+    {
+      std::size_t size = n / chunks;
+      std::size_t extra = n % chunks;
+      return size * i + (i < extra ? i : extra);
+    }
+
+    template <class F>
+    struct guarded_call
+    {
+      typedef exception_ptr result_type;
+
+      F* f_;
+
+      exception_ptr operator()(std::size_t i) const
+      {
+        try
+        {
+          (*f_)(i);
+        }
+        catch (...)
+        {
+          return current_exception();
+        }
+        return exception_ptr();
+      }
+    };
+
+    /**
+     * Effects: Calls f(i) for each i in [0, m) on ex and waits for the calls to complete.
+     * Throws: exception_list with the exceptions thrown by the calls, if any.
+     */
+    template <class Executor, class F>
+    void bulk_invoke(Executor& ex, std::size_t m, F& f)
+    {
+      if (m == 0) return;
+      guarded_call<F> call = {&f};
+      csbl::vector<exception_ptr> errors = boost::async_bulk(ex, m, call).get();
+      exception_list exs;
+      for (std::size_t i = 0; i < errors.size(); ++i)
+      {
+        if (errors[i]) exs.add(errors[i]);
+      }
+      if (exs.size() != 0)
+      {
+        boost::throw_exception(exs);
+      }
+    }
+
+    // Calls f(i, first + b, first + e) for each chunk i = [b, e) of [first, first + n).
+    template <class RandomAccessIterator, class F>
+    struct chunk_call
+    {
+      RandomAccessIterator first_;
+      std::size_t n_;
+      std::size_t chunks_;
+      F* f_;
+
+      void operator()(std::size_t i) const
+      {
+        (*f_)(i, first_ + chunk_begin(n_, chunks_, i), first_ + chunk_begin(n_, chunks_, i + 1));
+      }
+    };
+
+    template <class Executor, class RandomAccessIterator, class F>
+    void for_each_chunk(Executor& ex, RandomAccessIterator first, std::size_t n, std::size_t chunks, F& f)
+    {
+      chunk_call<RandomAccessIterator, F> call = {first, n, chunks, &f};
+      bulk_invoke(ex, chunks, call);
+    }
+
+    template <class Function>
+    struct for_each_body
+    {
+      Function* f_;
+
+      template <class It>
+      void operator()(std::size_t, It first, It last) const
+      {
+        for (; first != last; ++first) (*f_)(*first);
+      }
+    };
+
+    template <class RandomAccessIterator, class OutputIterator, class UnaryOperation>
+    struct unary_transform_body
+    {
+      RandomAccessIterator first_;
+      OutputIterator d_first_;
+      UnaryOperation* op_;
+
+      void operator()(std::size_t, RandomAccessIterator first, RandomAccessIterator last) const
+      {
+        std::transform(first, last, d_first_ + (first - first_), *op_);
+      }
+    };
+
+    template <class RandomAccessIterator1, class RandomAccessIterator2, class OutputIterator, class BinaryOperation>
+    struct binary_transform_body
+    {
+      RandomAccessIterator1 first1_;
+      RandomAccessIterator2 first2_;
+      OutputIterator d_first_;
+      BinaryOperation* op_;
+
+      void operator()(std::size_t, RandomAccessIterator1 first, RandomAccessIterator1 last) const
+      {
+        std::transform(first, last, first2_ + (first - first1_), d_first_ + (first - first1_), *op_);
+      }
+    };
+
+    template <class Compare>
+    struct sort_body
+    {
+      Compare* comp_;
+
+      template <class It>
+      void operator()(std::size_t, It first, It last) const
+      {
+        std::sort(first, last, *comp_);
+      }
+    };
+
+    // Returns: the number of elements of [a, a + la) among the first k elements of the merge of [a, a + la) and
+    // [b, b + lb), the elements of the first run going first on ties.
+    template <class RandomAccessIterator, class Compare>
+    std::size_t co_rank(RandomAccessIterator a, std::size_t la, RandomAccessIterator b, std::size_t lb,
+        std::size_t k, Compare& comp)
+    {
+      std::size_t lo = k > lb ? k - lb : 0;
+      std::size_t hi = k < la ? k : la;
+      while (lo < hi)
+      {
+        std::size_t mid = lo + (hi - lo) / 2;
+        // a[mid] goes before b[k - mid - 1]: more elements are taken from the first run.
+        if (! comp(b[k - mid - 1], a[mid])) lo = mid + 1;
+        else hi = mid;
+      }
+      return lo;
+    }
+
+    template <class InputIterator, class OutputIterator, class Compare>
+    OutputIterator move_merge(InputIterator a, InputIterator a_last, InputIterator b, InputIterator b_last,
+        OutputIterator d, Compare& comp)
+    {
+      for (; a != a_last && b != b_last; ++d)
+      {
+        if (comp(*b, *a))
+        {
+          *d = boost::move(*b);
+          ++b;
+        }
+        else
+        {
+          *d = boost::move(*a);
+          ++a;
+        }
+      }
+      d = boost::move(a, a_last, d);
+      return boost::move(b, b_last, d);
+    }
+
+    // Merges the sorted runs 2i and 2i+1 of src, whose bounds are stored in bounds_, into dst; an odd last run is
+    // moved as is. The output is split in tasks_ pieces of the same size rather than by pair of runs, each piece
+    // finding where it starts in the runs by co_rank(), so that the last rounds, which merge a few long runs, are
+    // as parallel as the first ones.
+    template <class InputIterator, class OutputIterator, class Compare>
+    struct merge_round_body
+    {
+      InputIterator src_;
+      OutputIterator dst_;
+      std::size_t const* bounds_;
+      std::size_t runs_;
+      std::size_t n_;
+      std::size_t tasks_;
+      Compare* comp_;
+
+      void operator()(std::size_t t) const
+      {
+        std::size_t const begin = chunk_begin(n_, tasks_, t);
+        std::size_t const end = chunk_begin(n_, tasks_, t + 1);
+        for (std::size_t r = 0; r < runs_; r += 2)
+        {
+          std::size_t const first = bounds_[r];
+          std::size_t const last = bounds_[r + 2 <= runs_ ? r + 2 : runs_];
+          if (last <= begin) continue;
+          if (first >= end) break;
+          // the part [lo, hi) of the output of this pair written by the task.
+          std::size_t const lo = (begin > first ? begin : first) - first;
+          std::size_t const hi = (end < last ? end : last) - first;
+          if (r + 1 == runs_)
+          {
+            boost::move(src_ + (first + lo), src_ + (first + hi), dst_ + (first + lo));
+            continue;
+          }
+          InputIterator const a = src_ + first;
+          std::size_t const la = bounds_[r + 1] - first;
+          InputIterator const b = src_ + bounds_[r + 1];
+          std::size_t const lb = last - bounds_[r + 1];
+          std::size_t const a_lo = co_rank(a, la, b, lb, lo, *comp_);
+          std::size_t const a_hi = co_rank(a, la, b, lb, hi, *comp_);
+          move_merge(a + a_lo, a + a_hi, b + (lo - a_lo), b + (hi - a_hi), dst_ + (first + lo), *comp_);
+        }
+      }
+    };
+
+    template <class Executor, class InputIterator, class OutputIterator, class Compare>
+    void merge_round(Executor& ex, InputIterator src, OutputIterator dst, std::size_t const* bounds,
+        std::size_t runs, std::size_t n, std::size_t tasks, Compare& comp)
+    {
+      merge_round_body<InputIterator, OutputIterator, Compare> body = {src, dst, bounds, runs, n, tasks, &comp};
+      bulk_invoke(ex, tasks, body);
+    }
+
+    // Uninitialized storage in which the elements of a range are merged out of place, its chunks being constructed
+    // and destroyed in parallel.
+    template <class T>
+    class merge_buffer
+    {
+      T* data_;
+      std::size_t n_;
+      std::size_t chunks_;
+      // whether the elements of the chunk i are constructed.
+      csbl::vector<char> constructed_;
+
+    public:
+      BOOST_THREAD_NO_COPYABLE(merge_buffer)
+
+      merge_buffer(std::size_t n, std::size_t chunks) :
+        data_(std::allocator<T>().allocate(n)), n_(n), chunks_(chunks), constructed_(chunks, 0)
+      {
+      }
+      ~merge_buffer()
+      {
+        for (std::size_t i = 0; i < chunks_; ++i)
+        {
+          if (constructed_[i]) destroy(i);
+        }
+        std::allocator<T>().deallocate(data_, n_);
+      }
+
+      T* data() const
+      {
+        return data_;
+      }
+
+      // Effects: Constructs the chunk i by moving the elements of the same positions from the range at first.
+      template <class RandomAccessIterator>
+      void construct(std::size_t i, RandomAccessIterator first)
+      {
+        std::size_t const b = chunk_begin(n_, chunks_, i);
+        std::size_t const e = chunk_begin(n_, chunks_, i + 1);
+        std::uninitialized_copy(boost::make_move_iterator(first + b), boost::make_move_iterator(first + e), data_ + b);
+        constructed_[i] = 1;
+      }
+
+      void destroy(std::size_t i)
+      {
+        std::size_t const e = chunk_begin(n_, chunks_, i + 1);
+        for (std::size_t k = chunk_begin(n_, chunks_, i); k < e; ++k) data_[k].~T();
+        constructed_[i] = 0;
+      }
+    };
+
+    template <class T, class RandomAccessIterator>
+    struct construct_buffer_body
+    {
+      merge_buffer<T>* buffer_;
+      RandomAccessIterator first_;
+
+      void operator()(std::size_t i) const
+      {
+        buffer_->construct(i, first_);
+      }
+    };
+
+    // Moves the chunk i of the buffer back to the range at first_ if move_back_, then destroys it.
+    template <class T, class RandomAccessIterator>
+    struct release_buffer_body
+    {
+      merge_buffer<T>* buffer_;
+      RandomAccessIterator first_;
+      std::size_t n_;
+      std::size_t chunks_;
+      bool move_back_;
+
+      void operator()(std::size_t i) const
+      {
+        if (move_back_)
+        {
+          T* data = buffer_->data();
+          std::size_t const b = chunk_begin(n_, chunks_, i);
+          std::size_t const e = chunk_begin(n_, chunks_, i + 1);
+          boost::move(data + b, data + e, first_ + b);
+        }
+        buffer_->destroy(i);
+      }
+    };
+  }
+
+  /**
+   * \b Effects: Applies \c f to each element of [first, last) on the threads of execution of \c ex.
+   * The range is split in a few chunks per hardware thread, claimed by at most hardware_concurrency() closures.
+   *
+   * \b Throws: \c exception_list with the exceptions thrown by \c f. The elements of a chunk following a throwing one are skipped.
+   */
+  template <class Executor, class RandomAccessIterator, class Function>
+  void for_each(Executor& ex, RandomAccessIterator first, RandomAccessIterator last, Function f)
+  {
+    std::size_t n = static_cast<std::size_t>(last - first);
+    detail::for_each_body<Function> body = {&f};
+    detail::for_each_chunk(ex, first, n, detail::chunk_count(n), body);
+  }
+
+  /**
+   * \b Effects: Assigns op(*(first + i)) to *(d_first + i) for each i in [0, last - first) on the threads of execution of \c ex.
+   *
+   * \b Returns: d_first + (last - first).
+   *
+   * \b Throws: \c exception_list with the exceptions thrown by \c op.
+   */
+  template <class Executor, class RandomAccessIterator, class OutputIterator, class UnaryOperation>
+  OutputIterator transform(Executor& ex, RandomAccessIterator first, RandomAccessIterator last,
+      OutputIterator d_first, UnaryOperation op)
+  {
+    std::size_t n = static_cast<std::size_t>(last - first);
+    detail::unary_transform_body<RandomAccessIterator, OutputIterator, UnaryOperation> body = {first, d_first, &op};
+    detail::for_each_chunk(ex, first, n, detail::chunk_count(n), body);
+    return d_first + (last - first);
+  }
+
+  /**
+   * \b Effects: Assigns op(*(first1 + i), *(first2 + i)) to *(d_first + i) for each i in [0, last1 - first1) on the
+   * threads of execution of \c ex.
+   *
+   * \b Returns: d_first + (last1 - first1).
+   *
+   * \b Throws: \c exception_list with the exceptions thrown by \c op.
+   */
+  template <class Executor, class RandomAccessIterator1, class RandomAccessIterator2, class OutputIterator, class BinaryOperation>
+  OutputIterator transform(Executor& ex, RandomAccessIterator1 first1, RandomAccessIterator1 last1,
+      RandomAccessIterator2 first2, OutputIterator d_first, BinaryOperation op)
+  {
+    std::size_t n = static_cast<std::size_t>(last1 - first1);
+    detail::binary_transform_body<RandomAccessIterator1, RandomAccessIterator2, OutputIterator, BinaryOperation> body =
+        {first1, first2, d_first, &op};
+    detail::for_each_chunk(ex, first1, n, detail::chunk_count(n), body);
+    return d_first + (last1 - first1);
+  }
+
+  /**
+   * \b Effects: Sorts [first, last) with \c comp. The chunks are sorted in parallel, then merged pairwise in rounds
+   * into a buffer and back. Each round is split in as many tasks as there are chunks, whatever the number of runs
+   * left. The sort is not stable.
+   *
+   * \b Throws: \c exception_list with the exceptions thrown by \c comp or by the move of the elements. The
+   * elements of [first, last) are then left in a valid but unspecified state.
+   */
+  template <class Executor, class RandomAccessIterator, class Compare>
+  void sort(Executor& ex, RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+  {
+    typedef typename std::iterator_traits<RandomAccessIterator>::value_type value_type;
+    std::size_t n = static_cast<std::size_t>(last - first);
+    std::size_t const chunks = detail::chunk_count(n);
+    if (chunks <= 1)
+    {
+      std::sort(first, last, comp);
+      return;
+    }
+    detail::sort_body<Compare> body = {&comp};
+    detail::for_each_chunk(ex, first, n, chunks, body);
+
+    detail::merge_buffer<value_type> buffer(n, chunks);
+    detail::construct_buffer_body<value_type, RandomAccessIterator> construct = {&buffer, first};
+    detail::bulk_invoke(ex, chunks, construct);
+
+    std::size_t runs = chunks;
+    csbl::vector<std::size_t> bounds(runs + 1);
+    for (std::size_t i = 0; i <= runs; ++i)
+    {
+      bounds[i] = detail::chunk_begin(n, runs, i);
+    }
+    // the sorted runs are in the buffer, the range holding moved-from elements.
+    bool in_buffer = true;
+    while (runs > 1)
+    {
+      if (in_buffer) detail::merge_round(ex, buffer.data(), first, &bounds[0], runs, n, chunks, comp);
+      else detail::merge_round(ex, first, buffer.data(), &bounds[0], runs, n, chunks, comp);
+      in_buffer = ! in_buffer;
+      // The bounds of the merged runs; an odd last run is kept as is.
+      std::size_t merged = 0;
+      for (std::size_t i = 0; i <= runs; i += 2)
+      {
+        bounds[merged++] = bounds[i];
+      }
+      if (runs % 2 == 1)
+      {
+        bounds[merged++] = bounds[runs];
+      }
+      runs = merged - 1;
+    }
+    detail::release_buffer_body<value_type, RandomAccessIterator> release = {&buffer, first, n, chunks, in_buffer};
+    detail::bulk_invoke(ex, chunks, release);
+  }
+
+  template <class Executor, class RandomAccessIterator>
+  void sort(Executor& ex, RandomAccessIterator first, RandomAccessIterator last)
+  {
+    typedef typename std::iterator_traits<RandomAccessIterator>::value_type value_type;
+    parallel::v1::sort(ex, first, last, std::less<value_type>());
+  }
+
+} // v1
+} // parallel
+} // experimental
+} // boost
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
+#endif // header
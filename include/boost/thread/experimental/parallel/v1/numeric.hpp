@@ -0,0 +1,254 @@
+#ifndef BOOST_THREAD_EXPERIMENTAL_PARALLEL_V1_NUMERIC_HPP
+#define BOOST_THREAD_EXPERIMENTAL_PARALLEL_V1_NUMERIC_HPP
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright The Boost.Thread Contributors 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/thread for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <boost/thread/experimental/parallel/v1/algorithm.hpp>
+
+#if defined BOOST_THREAD_PROVIDES_EXECUTORS
+
+#include <boost/optional.hpp>
+
+#include <functional>
+#include <iterator>
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+namespace experimental
+{
+namespace parallel
+{
+BOOST_THREAD_INLINE_NAMESPACE(v1)
+{
+  namespace detail
+  {
+    // Combines the elements of each chunk, transformed by a unary operation, into its own partial result.
+    template <class T, class BinaryOperation, class UnaryOperation>
+    struct reduce_body
+    {
+      optional<T>* partials_;
+      BinaryOperation* reduce_op_;
+      UnaryOperation* transform_op_;
+
+      template <class It>
+      void operator()(std::size_t i, It first, It last) const
+      {
+        T acc((*transform_op_)(*first));
+        for (++first; first != last; ++first)
+        {
+          acc = (*reduce_op_)(acc, (*transform_op_)(*first));
+        }
+        partials_[i] = acc;
+      }
+    };
+
+    template <class T, class RandomAccessIterator2, class BinaryOperation1, class BinaryOperation2>
+    struct binary_reduce_body
+    {
+      optional<T>* partials_;
+      BinaryOperation1* reduce_op_;
+      BinaryOperation2* transform_op_;
+      std::size_t chunks_;
+      std::size_t n_;
+      RandomAccessIterator2 first2_;
+
+      template <class It>
+      void operator()(std::size_t i, It first, It last) const
+      {
+        RandomAccessIterator2 first2 = first2_ + chunk_begin(n_, chunks_, i);
+        T acc((*transform_op_)(*first, *first2));
+        for (++first, ++first2; first != last; ++first, ++first2)
+        {
+          acc = (*reduce_op_)(acc, (*transform_op_)(*first, *first2));
+        }
+        partials_[i] = acc;
+      }
+    };
+
+    struct identity
+    {
+      template <class T>
+      T const& operator()(T const& x) const
+      {
+        return x;
+      }
+    };
+
+    template <class T, class BinaryOperation>
+    T combine_partials(T init, csbl::vector<optional<T> > const& partials, BinaryOperation& op)
+    {
+      for (std::size_t i = 0; i < partials.size(); ++i)
+      {
+        init = op(init, *partials[i]);
+      }
+      return init;
+    }
+
+    // Scans each chunk into the output, starting from the combination of the preceding chunks.
+    template <class T, class RandomAccessIterator, class OutputIterator, class BinaryOperation>
+    struct scan_body
+    {
+      RandomAccessIterator first_;
+      OutputIterator d_first_;
+      optional<T> const* carries_;
+      BinaryOperation* op_;
+
+      void operator()(std::size_t i, RandomAccessIterator first, RandomAccessIterator last) const
+      {
+        OutputIterator out = d_first_ + (first - first_);
+        T acc(carries_[i] ? (*op_)(*carries_[i], *first) : T(*first));
+        *out = acc;
+        for (++first, ++out; first != last; ++first, ++out)
+        {
+          acc = (*op_)(acc, *first);
+          *out = acc;
+        }
+      }
+    };
+  }
+
+  /**
+   * \b Effects: Combines \c init and the elements of [first, last), transformed by \c transform_op, with \c reduce_op
+   * in an unspecified order and grouping. The chunks are reduced in parallel, then their results are combined in order.
+   *
+   * \b Requires: \c reduce_op is associative and commutative.
+   *
+   * \b Throws: \c exception_list with the exceptions thrown by the operations.
+   */
+  template <class Executor, class RandomAccessIterator, class T, class BinaryOperation, class UnaryOperation>
+  T transform_reduce(Executor& ex, RandomAccessIterator first, RandomAccessIterator last, T init,
+      BinaryOperation reduce_op, UnaryOperation transform_op)
+  {
+    std::size_t n = static_cast<std::size_t>(last - first);
+    std::size_t chunks = detail::chunk_count(n);
+    if (chunks == 0) return init;
+    csbl::vector<optional<T> > partials(chunks);
+    detail::reduce_body<T, BinaryOperation, UnaryOperation> body = {&partials[0], &reduce_op, &transform_op};
+    detail::for_each_chunk(ex, first, n, chunks, body);
+    return detail::combine_partials(init, partials, reduce_op);
+  }
+
+  /**
+   * \b Effects: Combines \c init and transform_op(*(first1 + i), *(first2 + i)) for each i in [0, last1 - first1)
+   * with \c reduce_op in an unspecified order and grouping.
+   *
+   * \b Throws: \c exception_list with the exceptions thrown by the operations.
+   */
+  template <class Executor, class RandomAccessIterator1, class RandomAccessIterator2, class T,
+      class BinaryOperation1, class BinaryOperation2>
+  T transform_reduce(Executor& ex, RandomAccessIterator1 first1, RandomAccessIterator1 last1,
+      RandomAccessIterator2 first2, T init, BinaryOperation1 reduce_op, BinaryOperation2 transform_op)
+  {
+    std::size_t n = static_cast<std::size_t>(last1 - first1);
+    std::size_t chunks = detail::chunk_count(n);
+    if (chunks == 0) return init;
+    csbl::vector<optional<T> > partials(chunks);
+    detail::binary_reduce_body<T, RandomAccessIterator2, BinaryOperation1, BinaryOperation2> body =
+        {&partials[0], &reduce_op, &transform_op, chunks, n, first2};
+    detail::for_each_chunk(ex, first1, n, chunks, body);
+    return detail::combine_partials(init, partials, reduce_op);
+  }
+
+  /**
+   * \b Effects: As transform_reduce(ex, first1, last1, first2, init, std::plus<>(), std::multiplies<>()).
+   */
+  template <class Executor, class RandomAccessIterator1, class RandomAccessIterator2, class T>
+  T transform_reduce(Executor& ex, RandomAccessIterator1 first1, RandomAccessIterator1 last1,
+      RandomAccessIterator2 first2, T init)
+  {
+    return parallel::v1::transform_reduce(ex, first1, last1, first2, init, std::plus<T>(), std::multiplies<T>());
+  }
+
+  /**
+   * \b Effects: Combines \c init and the elements of [first, last) with \c op in an unspecified order and grouping.
+   *
+   * \b Requires: \c op is associative and commutative.
+   *
+   * \b Throws: \c exception_list with the exceptions thrown by \c op.
+   */
+  template <class Executor, class RandomAccessIterator, class T, class BinaryOperation>
+  T reduce(Executor& ex, RandomAccessIterator first, RandomAccessIterator last, T init, BinaryOperation op)
+  {
+    return parallel::v1::transform_reduce(ex, first, last, init, op, detail::identity());
+  }
+
+  template <class Executor, class RandomAccessIterator, class T>
+  T reduce(Executor& ex, RandomAccessIterator first, RandomAccessIterator last, T init)
+  {
+    return parallel::v1::reduce(ex, first, last, init, std::plus<T>());
+  }
+
+  template <class Executor, class RandomAccessIterator>
+  typename std::iterator_traits<RandomAccessIterator>::value_type
+  reduce(Executor& ex, RandomAccessIterator first, RandomAccessIterator last)
+  {
+    typedef typename std::iterator_traits<RandomAccessIterator>::value_type value_type;
+    return parallel::v1::reduce(ex, first, last, value_type(), std::plus<value_type>());
+  }
+
+  /**
+   * \b Effects: Assigns to *(d_first + i) the combination with \c op of the elements of [first, first + i], for each i
+   * in [0, last - first). The chunks are reduced in parallel, their results are scanned in order, then the chunks are
+   * scanned in parallel, each from the combination of the preceding ones.
+   *
+   * \b Requires: \c op is associative. [d_first, d_first + (last - first)) is a random access range which may be [first, last).
+   *
+   * \b Returns: d_first + (last - first).
+   *
+   * \b Throws: \c exception_list with the exceptions thrown by \c op.
+   */
+  template <class Executor, class RandomAccessIterator, class OutputIterator, class BinaryOperation>
+  OutputIterator inclusive_scan(Executor& ex, RandomAccessIterator first, RandomAccessIterator last,
+      OutputIterator d_first, BinaryOperation op)
+  {
+    typedef typename std::iterator_traits<RandomAccessIterator>::value_type T;
+    std::size_t n = static_cast<std::size_t>(last - first);
+    std::size_t chunks = detail::chunk_count(n);
+    if (chunks == 0) return d_first;
+    csbl::vector<optional<T> > partials(chunks);
+    if (chunks > 1)
+    {
+      // The last chunk doesn't contribute to any carry.
+      detail::identity id;
+      detail::reduce_body<T, BinaryOperation, detail::identity> body = {&partials[0], &op, &id};
+      detail::chunk_call<RandomAccessIterator, detail::reduce_body<T, BinaryOperation, detail::identity> > call =
+          {first, n, chunks, &body};
+      detail::bulk_invoke(ex, chunks - 1, call);
+    }
+    // carries[i] combines the chunks preceding i.
+    csbl::vector<optional<T> > carries(chunks);
+    for (std::size_t i = 1; i < chunks; ++i)
+    {
+      carries[i] = carries[i - 1] ? op(*carries[i - 1], *partials[i - 1]) : *partials[i - 1];
+    }
+    detail::scan_body<T, RandomAccessIterator, OutputIterator, BinaryOperation> scan = {first, d_first, &carries[0], &op};
+    detail::for_each_chunk(ex, first, n, chunks, scan);
+    return d_first + (last - first);
+  }
+
+  template <class Executor, class RandomAccessIterator, class OutputIterator>
+  OutputIterator inclusive_scan(Executor& ex, RandomAccessIterator first, RandomAccessIterator last, OutputIterator d_first)
+  {
+    typedef typename std::iterator_traits<RandomAccessIterator>::value_type value_type;
+    return parallel::v1::inclusive_scan(ex, first, last, d_first, std::plus<value_type>());
+  }
+
+} // v1
+} // parallel
+} // experimental
+} // boost
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
+#endif // header
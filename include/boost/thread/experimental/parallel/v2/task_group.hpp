@@ -0,0 +1,226 @@
+#ifndef BOOST_THREAD_EXPERIMENTAL_PARALLEL_V2_TASK_GROUP_HPP
+#define BOOST_THREAD_EXPERIMENTAL_PARALLEL_V2_TASK_GROUP_HPP
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright The Boost.Thread Contributors 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/thread for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <boost/thread/detail/config.hpp>
+#include <boost/thread/executors/work_stealing_thread_pool.hpp>
+
+#if defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION && defined BOOST_THREAD_PROVIDES_EXECUTORS && defined BOOST_THREAD_USES_MOVE \
+ && ! defined BOOST_NO_CXX11_THREAD_LOCAL
+
+#include <boost/thread/experimental/exception_list.hpp>
+#include <boost/thread/experimental/parallel/v2/inline_namespace.hpp>
+#include <boost/thread/detail/delete.hpp>
+#include <boost/thread/detail/move.hpp>
+#include <boost/thread/lock_guard.hpp>
+#include <boost/thread/lock_types.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/atomic.hpp>
+#include <boost/throw_exception.hpp>
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+namespace experimental
+{
+namespace parallel
+{
+BOOST_THREAD_INLINE_NAMESPACE(v2)
+{
+  /**
+   * Group of tasks forked on a work_stealing_thread_pool and joined by wait().
+   * The tasks forked by a worker are pushed on its own deque, and wait() runs the pending ones, the last forked first,
+   * instead of blocking. A thread outside the pool runs the tasks it can steal, and then blocks until the others
+   * complete. The tasks not yet joined are counted on a single atomic counter, so forking a task only allocates the
+   * closure.
+   */
+  class task_group
+  {
+    template <class F>
+    struct task
+    {
+      task_group* group;
+      F f;
+
+      task(task_group* g, BOOST_THREAD_RV_REF(F) fn) : group(g), f(boost::move(fn))
+      {
+      }
+
+      void operator()()
+      {
+        group->execute(f);
+      }
+    };
+
+    // set in pending_ while a thread outside the pool is blocked in join().
+    static const std::size_t joiner_waiting = ~(~std::size_t(0) >> 1);
+
+    work_stealing_thread_pool& ex_;
+    atomic<std::size_t> pending_;
+    atomic<bool> canceled_;
+    mutex mtx_;
+    // notified when a task completes while joiner_waiting is set, pending_ being then decremented under mtx_.
+    condition_variable completed_;
+    exception_list exs_;
+
+    template <class F>
+    void execute(F& f)
+    {
+      if (! canceled_.load(memory_order_relaxed))
+      {
+        try
+        {
+          f();
+        }
+        catch (...)
+        {
+          lock_guard<mutex> lk(mtx_);
+          exs_.add(current_exception());
+          canceled_.store(true, memory_order_relaxed);
+        }
+      }
+      complete();
+    }
+
+    void complete()
+    {
+      // The group can be destroyed as soon as the counter reaches zero, so a blocked joiner is notified under the
+      // mutex, which it locks before returning.
+      std::size_t n = pending_.load(memory_order_relaxed);
+      for (;;)
+      {
+        if (n & joiner_waiting)
+        {
+          lock_guard<mutex> lk(mtx_);
+          pending_.fetch_sub(1, memory_order_acq_rel);
+          completed_.notify_all();
+          return;
+        }
+        if (pending_.compare_exchange_weak(n, n - 1, memory_order_acq_rel, memory_order_relaxed)) return;
+      }
+    }
+
+    void join()
+    {
+      if (ex_.is_worker())
+      {
+        // the tasks forked by this worker are on its own deque: it keeps running them.
+        while ((pending_.load(memory_order_acquire) & ~joiner_waiting) != 0)
+        {
+          ex_.schedule_one_or_yield();
+        }
+        return;
+      }
+      while ((pending_.load(memory_order_acquire) & ~joiner_waiting) != 0)
+      {
+        if (ex_.try_executing_one()) continue;
+        // nothing to steal: blocks until one of the tasks still running completes.
+        unique_lock<mutex> lk(mtx_);
+        std::size_t const n = pending_.fetch_or(joiner_waiting, memory_order_acq_rel) | joiner_waiting;
+        while (n != joiner_waiting && pending_.load(memory_order_acquire) == n)
+        {
+          completed_.wait(lk);
+        }
+      }
+      if (pending_.load(memory_order_relaxed) & joiner_waiting)
+      {
+        lock_guard<mutex> lk(mtx_);
+        pending_.fetch_and(~joiner_waiting, memory_order_relaxed);
+      }
+    }
+
+  public:
+    BOOST_DELETED_FUNCTION(task_group(const task_group&))
+    BOOST_DELETED_FUNCTION(task_group& operator=(const task_group&))
+
+    explicit task_group(work_stealing_thread_pool& ex)
+    : ex_(ex), pending_(0), canceled_(false)
+    {
+    }
+
+    /**
+     * \b Effects: Waits for the tasks not yet joined. Their exceptions are ignored.
+     */
+    ~task_group()
+    {
+      join();
+    }
+
+    /**
+     * \b Effects: Forks \c f on the executor of the group.
+     * Once a task has thrown, the tasks that have not started yet are not run.
+     *
+     * \b Throws: Whatever the executor throws while storing the closure.
+     */
+    template <typename F>
+    void run(BOOST_THREAD_FWD_REF(F) f)
+    {
+      typedef typename decay<F>::type Fp;
+      pending_.fetch_add(1, memory_order_relaxed);
+      try
+      {
+        ex_.submit(task<Fp>(this, thread_detail::decay_copy(boost::forward<F>(f))));
+      }
+      catch (...)
+      {
+        complete();
+        throw;
+      }
+    }
+
+    /**
+     * \b Effects: Runs the tasks of the pool, starting with the ones forked by the calling thread, until all the
+     * tasks forked so far have completed.
+     *
+     * \b Throws: \c exception_list with the exceptions thrown by the tasks, if any.
+     *
+     * \b Postconditions: The group can be reused.
+     */
+    void wait()
+    {
+      join();
+      exception_list exs;
+      {
+        lock_guard<mutex> lk(mtx_);
+        if (exs_.size() == 0) return;
+        exs = exs_;
+        exs_ = exception_list();
+      }
+      canceled_.store(false, memory_order_relaxed);
+      boost::throw_exception(exs);
+    }
+
+    /**
+     * \b Returns: whether a task has thrown since the last call to wait().
+     */
+    bool is_canceled() const
+    {
+      return canceled_.load(memory_order_relaxed);
+    }
+
+    work_stealing_thread_pool& get_executor()
+    {
+      return ex_;
+    }
+  };
+
+} // v2
+} // parallel
+} // experimental
+} // boost
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
+#endif // header
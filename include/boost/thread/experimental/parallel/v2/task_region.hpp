@@ -18,6 +18,7 @@
 #include <boost/thread/future.hpp>
 #if defined BOOST_THREAD_PROVIDES_EXECUTORS
 #include <boost/thread/executors/basic_thread_pool.hpp>
+#include <boost/thread/experimental/parallel/v2/task_group.hpp>
 #endif
 #include <boost/thread/experimental/exception_list.hpp>
 #include <boost/thread/experimental/parallel/v2/inline_namespace.hpp>
@@ -241,6 +242,73 @@ protected:
       wait_all();
     }
   };
+#if defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION && defined BOOST_THREAD_PROVIDES_EXECUTORS && defined BOOST_THREAD_USES_MOVE \
+ && ! defined BOOST_NO_CXX11_THREAD_LOCAL
+  /**
+   * On a work_stealing_thread_pool the tasks of the region are joined by a task_group instead of futures: they are
+   * pushed on the deque of the calling worker, and wait() runs them instead of blocking.
+   */
+  template <>
+  class task_region_handle_gen<work_stealing_thread_pool>
+  {
+  private:
+    template <class Ex, typename F>
+    friend void task_region(Ex&, BOOST_THREAD_FWD_REF(F) f);
+    template<class Ex, typename F>
+    friend void task_region_final(Ex&, BOOST_THREAD_FWD_REF(F) f);
+
+    void wait_all()
+    {
+      try
+      {
+        group.wait();
+      }
+      catch (...)
+      {
+        detail::handle_task_region_exceptions(exs);
+      }
+      if (exs.size() != 0)
+      {
+        boost::throw_exception(exs);
+      }
+    }
+  protected:
+    task_region_handle_gen(work_stealing_thread_pool& ex)
+    : group(ex)
+    {}
+
+    ~task_region_handle_gen()
+    {
+    }
+
+    task_group group;
+    exception_list exs;
+
+  public:
+    BOOST_DELETED_FUNCTION(task_region_handle_gen(const task_region_handle_gen&))
+    BOOST_DELETED_FUNCTION(task_region_handle_gen& operator=(const task_region_handle_gen&))
+    BOOST_DELETED_FUNCTION(task_region_handle_gen* operator&() const)
+
+  public:
+    template<typename F>
+    void run(BOOST_THREAD_FWD_REF(F) f)
+    {
+      if (group.is_canceled()) {
+        boost::throw_exception(task_canceled_exception());
+      }
+      group.run(forward<F>(f));
+    }
+
+    void wait()
+    {
+      if (group.is_canceled()) {
+        boost::throw_exception(task_canceled_exception());
+      }
+      wait_all();
+    }
+  };
+#endif
+
 #if defined BOOST_THREAD_PROVIDES_EXECUTORS
   typedef basic_thread_pool default_executor;
 #else
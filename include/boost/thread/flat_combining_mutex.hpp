@@ -0,0 +1,288 @@
+#ifndef BOOST_THREAD_FLAT_COMBINING_MUTEX_HPP
+#define BOOST_THREAD_FLAT_COMBINING_MUTEX_HPP
+
+//  flat_combining_mutex.hpp
+//
+//  (C) Copyright 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/thread/detail/config.hpp>
+#include <boost/thread/detail/delete.hpp>
+#include <boost/thread/detail/move.hpp>
+#include <boost/thread/detail/backoff.hpp>
+#include <boost/thread/detail/thread_slots.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/lockable_traits.hpp>
+#if defined BOOST_THREAD_PROVIDES_NESTED_LOCKS
+#include <boost/thread/lock_types.hpp>
+#endif
+#include <boost/atomic.hpp>
+#include <boost/assert.hpp>
+#include <boost/exception_ptr.hpp>
+#include <boost/optional.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/utility/result_of.hpp>
+
+#ifndef BOOST_THREAD_FLAT_COMBINING_MUTEX_MAX_SPIN
+#define BOOST_THREAD_FLAT_COMBINING_MUTEX_MAX_SPIN 2048
+#endif
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+  namespace detail
+  {
+    // operation published by a thread waiting for the combiner, living on the stack of this thread.
+    struct combining_request
+    {
+      atomic<bool> done;
+      exception_ptr exception;
+
+      combining_request() : done(false) {}
+      virtual ~combining_request() {}
+
+      // Effects: Executes the operation, the exception it throws being stored.
+      virtual void run() = 0;
+    };
+
+    template <typename F, typename R>
+    struct combining_request_impl : combining_request
+    {
+      F& f;
+      optional<R> result;
+
+      explicit combining_request_impl(F& f) : f(f) {}
+
+      void run()
+      {
+        try
+        {
+          result = f();
+        }
+        catch (...)
+        {
+          exception = current_exception();
+        }
+      }
+
+      R get()
+      {
+        if (exception) rethrow_exception(exception);
+        return boost::move(*result);
+      }
+    };
+
+    template <typename F>
+    struct combining_request_impl<F, void> : combining_request
+    {
+      F& f;
+
+      explicit combining_request_impl(F& f) : f(f) {}
+
+      void run()
+      {
+        try
+        {
+          f();
+        }
+        catch (...)
+        {
+          exception = current_exception();
+        }
+      }
+
+      void get()
+      {
+        if (exception) rethrow_exception(exception);
+      }
+    };
+  }
+
+  /**
+   * Mutex for data on which many threads apply small operations (flat combining).
+   *
+   * A thread calling combine() publishes its operation in a slot of its own, and the thread which owns the mutex
+   * executes all the published operations in a single pass, so that the protected data and the mutex stay in the
+   * cache of this thread instead of moving from core to core. The threads waiting for their operation to be executed
+   * spin on their own request, and become the combiner when the mutex is unlocked.
+   *
+   * The mutex can also be locked as any mutex; the operations published meanwhile are executed by the next combiner.
+   */
+  class BOOST_THREAD_CAPABILITY("mutex") flat_combining_mutex
+  {
+  private:
+    struct slot
+    {
+      atomic<detail::combining_request*> request;
+
+      slot() : request(0) {}
+    };
+
+    boost::mutex mtx_;
+    detail::thread_slots<slot> slots_;
+    unsigned max_spin_;
+
+    static const int max_passes = 3;
+
+    // Returns: Whether the request has been published, which fails only if all the slots are taken.
+    bool publish(detail::combining_request& r)
+    {
+      std::size_t const first = slots_.this_thread_index();
+      std::size_t const mask = slots_.size() - 1;
+      for (std::size_t i = 0; i <= mask; ++i)
+      {
+        detail::combining_request* expected = 0;
+        if (slots_[(first + i) & mask].request.compare_exchange_strong(expected, &r, memory_order_release,
+            memory_order_relaxed)) return true;
+      }
+      return false;
+    }
+
+    // Requires: mtx_ is locked.
+    // Effects: Executes the published operations until a pass finds none, or at most max_passes passes.
+    void combine_published()
+    {
+      for (int pass = 0; pass < max_passes; ++pass)
+      {
+        bool found = false;
+        for (std::size_t i = 0; i < slots_.size(); ++i)
+        {
+          detail::combining_request* r = slots_[i].request.load(memory_order_acquire);
+          if (r == 0) continue;
+          found = true;
+          r->run();
+          // the slot is free before the waiting thread returns, so that it can publish its next operation there.
+          slots_[i].request.store(0, memory_order_relaxed);
+          r->done.store(true, memory_order_release);
+        }
+        if (! found) return;
+      }
+    }
+
+    // Effects: Waits until the published request has been executed, by the owner of the mutex or by this thread.
+    void wait(detail::combining_request& r)
+    {
+      detail::spin_backoff backoff;
+      unsigned spun = 0;
+      while (! r.done.load(memory_order_acquire))
+      {
+        if (mtx_.try_lock())
+        {
+          combine_published();
+          mtx_.unlock();
+        }
+        else if (spun < max_spin_)
+        {
+          spun += backoff.pause();
+        }
+        else
+        {
+          // the combiner or the owner of the mutex is slow to come: waits for the mutex.
+          boost::lock_guard<boost::mutex> lk(mtx_);
+          combine_published();
+        }
+      }
+    }
+
+  public:
+    BOOST_THREAD_NO_COPYABLE(flat_combining_mutex)
+
+    /**
+     * \b Effects: Constructs an unlocked mutex whose waiting threads spin at most \c max_spin calls to
+     * detail::cpu_relax() before blocking on the mutex. The operations are published in twice as many slots as there
+     * are hardware threads.
+     *
+     * \b Throws: \c thread_resource_error or \c std::bad_alloc on failure.
+     */
+    explicit flat_combining_mutex(unsigned max_spin = BOOST_THREAD_FLAT_COMBINING_MUTEX_MAX_SPIN) :
+      slots_(0),
+      max_spin_(max_spin)
+    {
+    }
+
+    ~flat_combining_mutex()
+    {
+    }
+
+    void lock() BOOST_THREAD_ACQUIRE()
+    {
+      mtx_.lock();
+    }
+
+    bool try_lock() BOOST_THREAD_TRY_ACQUIRE(true)
+    {
+      return mtx_.try_lock();
+    }
+
+    void unlock() BOOST_THREAD_RELEASE()
+    {
+      mtx_.unlock();
+    }
+
+    /**
+     * \b Requires: The calling thread doesn't own the mutex, and \c f doesn't call combine() on this mutex.
+     *
+     * \b Effects: Executes \c f() while the mutex is owned, either on this thread or on the thread owning the
+     * mutex, which executes the operations published by all the waiting threads.
+     *
+     * \b Returns: The result of \c f().
+     *
+     * \b Throws: The exception thrown by \c f(), rethrown on this thread.
+     */
+    template <typename F>
+    typename boost::result_of<F()>::type combine(F& f)
+    {
+      typedef typename boost::result_of<F()>::type result_type;
+      detail::combining_request_impl<F, result_type> r(f);
+      if (publish(r))
+      {
+        wait(r);
+      }
+      else
+      {
+        boost::lock_guard<boost::mutex> lk(mtx_);
+        r.run();
+        combine_published();
+      }
+      return r.get();
+    }
+
+#if defined BOOST_THREAD_PROVIDES_NESTED_LOCKS
+    typedef unique_lock<flat_combining_mutex> scoped_lock;
+    typedef detail::try_lock_wrapper<flat_combining_mutex> scoped_try_lock;
+#endif
+  };
+
+  namespace detail
+  {
+    template <typename Lockable>
+    struct synchronized_value_combines_calls;
+    // the calls of synchronized_value<T, flat_combining_mutex>::operator() use flat_combining_mutex::combine().
+    template <>
+    struct synchronized_value_combines_calls<flat_combining_mutex> : true_type {};
+  }
+
+  namespace sync
+  {
+#ifdef BOOST_THREAD_NO_AUTO_DETECT_MUTEX_TYPES
+    template<>
+    struct is_basic_lockable<flat_combining_mutex>
+    {
+      BOOST_STATIC_CONSTANT(bool, value = true);
+    };
+    template<>
+    struct is_lockable<flat_combining_mutex>
+    {
+      BOOST_STATIC_CONSTANT(bool, value = true);
+    };
+#endif
+  }
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
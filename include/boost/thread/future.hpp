@@ -42,10 +42,12 @@ struct shared_state_base {
 #include <boost/thread/lock_algorithms.hpp>
 #include <boost/thread/lock_types.hpp>
 #include <boost/thread/mutex.hpp>
+#include <boost/thread/stop_token.hpp>
 #include <boost/thread/thread_only.hpp>
 #include <boost/thread/thread_time.hpp>
 #include <boost/thread/executor.hpp>
 #include <boost/thread/executors/generic_executor_ref.hpp>
+#include <boost/thread/executors/detail/current_worker.hpp>
 
 #if defined BOOST_THREAD_FUTURE_USES_OPTIONAL
 #include <boost/optional.hpp>
@@ -58,19 +60,24 @@ struct shared_state_base {
 #ifdef BOOST_THREAD_USES_CHRONO
 #include <boost/chrono/system_clocks.hpp>
 #endif
+#include <boost/core/addressof.hpp>
 #include <boost/core/enable_if.hpp>
 #include <boost/core/ref.hpp>
 #include <boost/enable_shared_from_this.hpp>
 #include <boost/exception_ptr.hpp>
 #include <boost/function.hpp>
+#include <boost/scoped_ptr.hpp>
 #include <boost/scoped_array.hpp>
 #include <boost/shared_ptr.hpp>
 #include <boost/smart_ptr/make_shared.hpp>
 #include <boost/throw_exception.hpp>
+#include <boost/type_traits/aligned_storage.hpp>
+#include <boost/type_traits/alignment_of.hpp>
 #include <boost/type_traits/conditional.hpp>
 #include <boost/type_traits/decay.hpp>
 #include <boost/type_traits/is_copy_constructible.hpp>
 #include <boost/type_traits/is_fundamental.hpp>
+#include <boost/type_traits/is_nothrow_move_constructible.hpp>
 #include <boost/type_traits/is_void.hpp>
 #include <boost/utility/result_of.hpp>
 
@@ -89,6 +96,7 @@ struct shared_state_base {
 #endif
 
 #include <algorithm>
+#include <iterator>
 #include <list>
 #include <vector>
 #include <utility>
@@ -123,6 +131,31 @@ namespace boost
 
     namespace detail
     {
+        struct continuation_batch;
+        struct shared_state_base;
+
+        // Cancels a shared state bound to a stop_token. The state is held weakly so that the registration does not keep it alive.
+        struct shared_state_canceller
+        {
+            weak_ptr<shared_state_base> that;
+
+            explicit shared_state_canceller(weak_ptr<shared_state_base> const& st) : that(st) {}
+            void operator()() const;
+        };
+
+        // Registration of a callback run once a shared state is ready, on the thread making it ready and with the
+        // state mutex unlocked. The link is owned by the registrant, so registering needs no allocation.
+        struct ready_callback_link
+        {
+            ready_callback_link* prev;
+            ready_callback_link* next;
+            bool linked;
+
+            ready_callback_link() : prev(0), next(0), linked(false) {}
+            virtual void on_ready() = 0;
+        protected:
+            ~ready_callback_link() {}
+        };
 
         struct relocker
         {
@@ -148,6 +181,101 @@ namespace boost
             relocker& operator=(relocker const&);
         };
 
+#if defined BOOST_THREAD_PROVIDES_CONTINUATION_FUSION
+        // Scope opened on the worker thread by the jobs running a task or a continuation on an executor.
+        // An executor continuation launched from within the scope and targeting the same executor is kept aside
+        // and run by the scope once the current stage returns, instead of being submitted: the stages of a
+        // pipeline run back to back on the same worker, without stack growth.
+        // A job runs at most BOOST_THREAD_CONTINUATION_FUSION_BUDGET kept aside continuations, so the other closures
+        // queued on the executor are not starved, and scopes nested deeper than BOOST_THREAD_CONTINUATION_FUSION_DEPTH,
+        // as when a job runs other closures while waiting, don't keep any.
+        class continuation_fusion_scope
+        {
+        public:
+            typedef void (*run_type)(shared_ptr<shared_state_base>);
+
+        private:
+            void const* executor_;
+            continuation_fusion_scope* outer_;
+            unsigned depth_;
+            unsigned budget_;
+            shared_ptr<shared_state_base> pending_;
+            run_type run_;
+
+            static continuation_fusion_scope*& current()
+            {
+                static thread_local continuation_fusion_scope* scope = 0;
+                return scope;
+            }
+
+            continuation_fusion_scope(continuation_fusion_scope const&);
+            continuation_fusion_scope& operator=(continuation_fusion_scope const&);
+
+        public:
+            explicit continuation_fusion_scope(executor_ptr_type const& ex) :
+                executor_(ex ? ex->identity() : 0),
+                outer_(current()),
+                depth_(outer_ ? outer_->depth_ + 1 : 1),
+                budget_(BOOST_THREAD_CONTINUATION_FUSION_BUDGET),
+                run_(0)
+            {
+                current() = this;
+            }
+
+            ~continuation_fusion_scope()
+            {
+                current() = outer_;
+            }
+
+            // Returns true if the continuation \c st, to be run by \c ex, has been kept aside by the current scope.
+            static bool defer(executor_ptr_type const& ex, shared_ptr<shared_state_base> const& st, run_type run)
+            {
+                continuation_fusion_scope* scope = current();
+                if (scope == 0 || scope->pending_ || scope->budget_ == 0
+                    || scope->depth_ > BOOST_THREAD_CONTINUATION_FUSION_DEPTH
+                    || scope->executor_ != ex->identity())
+                {
+                    return false;
+                }
+                --scope->budget_;
+                scope->pending_ = st;
+                scope->run_ = run;
+                return true;
+            }
+
+            // Runs the continuation kept aside by the stage that has just returned, and the ones it launches in turn.
+            void run_pending()
+            {
+                while (pending_)
+                {
+                    shared_ptr<shared_state_base> st;
+                    st.swap(pending_);
+                    run_(st);
+                }
+            }
+
+            // Returns true if a scope of the calling thread has kept aside a continuation.
+            static bool holds_back()
+            {
+                for (continuation_fusion_scope* scope = current(); scope != 0; scope = scope->outer_)
+                {
+                    if (scope->pending_) return true;
+                }
+                return false;
+            }
+
+            // Runs the continuations kept aside by the scopes of the calling thread, which is about to wait: the
+            // state it waits for can be one of them, or depend on one of them.
+            static void run_held_back()
+            {
+                for (continuation_fusion_scope* scope = current(); scope != 0; scope = scope->outer_)
+                {
+                    scope->run_pending();
+                }
+            }
+        };
+#endif
+
         struct shared_state_base : enable_shared_from_this<shared_state_base>
         {
             typedef std::list<boost::condition_variable_any*> waiter_list;
@@ -165,24 +293,39 @@ namespace boost
             mutable boost::mutex mutex;
             boost::condition_variable waiters;
             waiter_list external_waiters;
+            any_ready_link* any_ready_waiters;
+            ready_callback_link* ready_callbacks;
             boost::function<void()> callback;
             // This declaration should be only included conditionally, but is included to maintain the same layout.
             continuations_type continuations;
             executor_ptr_type ex_;
+            // Set once the task computing the result has started; a stop request is then ignored.
+            bool started_;
+            scoped_ptr<stop_callback<shared_state_canceller> > stop_registration_;
 
             // This declaration should be only included conditionally, but is included to maintain the same layout.
             virtual void launch_continuation()
             {
             }
 
+            // Launches the continuation as part of a batch of continuations released together.
+            // Executor continuations override it to join the bulk submission to their executor.
+            virtual void enqueue_continuation(continuation_batch&)
+            {
+                launch_continuation();
+            }
+
             shared_state_base():
                 done(false),
                 is_valid_(true),
                 is_deferred_(false),
                 is_constructed(false),
                 policy_(launch::none),
+                any_ready_waiters(0),
+                ready_callbacks(0),
                 continuations(),
-                ex_()
+                ex_(),
+                started_(false)
             {}
 
             shared_state_base(exceptional_ptr const& ex):
@@ -192,8 +335,11 @@ namespace boost
                 is_deferred_(false),
                 is_constructed(false),
                 policy_(launch::none),
+                any_ready_waiters(0),
+                ready_callbacks(0),
                 continuations(),
-                ex_()
+                ex_(),
+                started_(false)
             {}
 
 
@@ -243,6 +389,65 @@ namespace boost
               validate(lk);
             }
 
+            // Binds the state to st: a stop requested before the task starts completes the state with task_cancelled.
+            // Must be called before the state can be launched, without holding its lock.
+            void set_stop_token(stop_token const& st)
+            {
+                if (st.stop_possible())
+                {
+                    stop_registration_.reset(new stop_callback<shared_state_canceller>(st, shared_state_canceller(shared_from_this())));
+                }
+            }
+
+            bool start_running(boost::unique_lock<boost::mutex>&)
+            {
+                if (stop_registration_ && done)
+                {
+                    return false;
+                }
+                started_ = true;
+                return true;
+            }
+            bool start_running(boost::lock_guard<boost::mutex>&)
+            {
+                if (stop_registration_ && done)
+                {
+                    return false;
+                }
+                started_ = true;
+                return true;
+            }
+            // Returns false if the state has been cancelled, in which case the task must not run.
+            bool start_running()
+            {
+                if (! stop_registration_)
+                {
+                    return true;
+                }
+                boost::lock_guard<boost::mutex> lk(this->mutex);
+                return start_running(lk);
+            }
+
+            // Whether the state has been cancelled before being launched, so that launching it can be skipped.
+            bool cancelled()
+            {
+                if (! stop_registration_)
+                {
+                    return false;
+                }
+                boost::lock_guard<boost::mutex> lk(this->mutex);
+                return done && ! started_;
+            }
+
+            void cancel()
+            {
+                boost::unique_lock<boost::mutex> lock(this->mutex);
+                if (! done && ! started_)
+                {
+                    mark_exceptional_finish_internal(boost::copy_exception(task_cancelled()), lock);
+                }
+            }
+
             void set_deferred()
             {
               is_deferred_ = true;
@@ -277,6 +482,94 @@ namespace boost
                 external_waiters.erase(it);
             }
 
+            // Returns true if the state is already ready, in which case the link is not registered.
+            bool notify_when_ready(any_ready_link& link)
+            {
+                boost::unique_lock<boost::mutex> lock(this->mutex);
+                do_callback(lock);
+                if (done)
+                {
+                    return true;
+                }
+                link.prev = 0;
+                link.next = any_ready_waiters;
+                if (any_ready_waiters)
+                {
+                    any_ready_waiters->prev = &link;
+                }
+                any_ready_waiters = &link;
+                link.linked = true;
+                return false;
+            }
+
+            // Returns true if the state is already ready, in which case the link is not registered.
+            // A deferred state is run on the calling thread.
+            bool add_ready_callback(ready_callback_link& link)
+            {
+                boost::unique_lock<boost::mutex> lock(this->mutex);
+                do_callback(lock);
+                if (is_deferred_)
+                {
+                    is_deferred_=false;
+                    execute(lock);
+                }
+                if (done)
+                {
+                    return true;
+                }
+                link.prev = 0;
+                link.next = ready_callbacks;
+                if (ready_callbacks)
+                {
+                    ready_callbacks->prev = &link;
+                }
+                ready_callbacks = &link;
+                link.linked = true;
+                return false;
+            }
+
+            void remove_ready_callback(ready_callback_link& link)
+            {
+                boost::lock_guard<boost::mutex> lock(this->mutex);
+                if (link.linked)
+                {
+                    if (link.prev)
+                    {
+                        link.prev->next = link.next;
+                    }
+                    else
+                    {
+                        ready_callbacks = link.next;
+                    }
+                    if (link.next)
+                    {
+                        link.next->prev = link.prev;
+                    }
+                    link.linked = false;
+                }
+            }
+
+            void unnotify_when_ready(any_ready_link& link)
+            {
+                boost::lock_guard<boost::mutex> lock(this->mutex);
+                if (link.linked)
+                {
+                    if (link.prev)
+                    {
+                        link.prev->next = link.next;
+                    }
+                    else
+                    {
+                        any_ready_waiters = link.next;
+                    }
+                    if (link.next)
+                    {
+                        link.next->prev = link.prev;
+                    }
+                    link.linked = false;
+                }
+            }
+
 #if 0
             // this inline definition results in ODR. See https://github.com/boostorg/thread/issues/193
             // to avoid it, we define the function on the derived templates using the macro BOOST_THREAD_DO_CONTINUATION
@@ -309,7 +602,9 @@ namespace boost
                   this->continuations.clear(); \
                   relocker rlk(lock); \
                   for (continuations_type::iterator it = the_continuations.begin(); it != the_continuations.end(); ++it) { \
-                    (*it)->launch_continuation(); \
+                    if (! (*it)->cancelled()) { \
+                      (*it)->launch_continuation(); \
+                    } \
                   } \
                 } \
             }
@@ -341,6 +636,30 @@ namespace boost
                 {
                     (*it)->notify_all();
                 }
+                while (any_ready_waiters)
+                {
+                    any_ready_link* link = any_ready_waiters;
+                    any_ready_waiters = link->next;
+                    link->linked = false;
+                    link->notifier->notify(link->index);
+                }
+                if (ready_callbacks)
+                {
+                    ready_callback_link* links = ready_callbacks;
+                    ready_callbacks = 0;
+                    for (ready_callback_link* link = links; link; link = link->next)
+                    {
+                        link->linked = false;
+                    }
+                    relocker rlk(lock);
+                    while (links)
+                    {
+                        // on_ready() may release the link.
+                        ready_callback_link* link = links;
+                        links = link->next;
+                        link->on_ready();
+                    }
+                }
                 do_continuation(lock);
             }
             void notify_deferred()
@@ -384,6 +703,97 @@ namespace boost
               else
                 return done;
             }
+#if defined BOOST_THREAD_PROVIDES_HELP_WHILE_WAITING
+            // Runs on the calling thread the work computing the result that no thread of execution has started yet.
+            // Called by a worker of the executor of the state while it waits for it.
+            virtual void run_pending_work()
+            {
+            }
+
+            // On a worker thread of an executor, runs the work computing the result if it is still pending on the same
+            // executor, then the other closures queued on the executor until the state is ready.
+            // Waits nested deeper than BOOST_THREAD_HELP_WHILE_WAITING_DEPTH don't run other closures.
+            void help_while_waiting(boost::unique_lock<boost::mutex>& lk)
+            {
+              executors::detail::current_worker* worker = executors::detail::current_worker::get();
+              if (worker == 0 || done)
+              {
+                return;
+              }
+              // Running the pending work is needed anyway and is bounded as the call of a deferred function is.
+              if (ex_ && worker->works_for(ex_->identity()))
+              {
+                relocker relock(lk);
+                run_pending_work();
+              }
+              if (done || ! worker->can_help())
+              {
+                return;
+              }
+              executors::detail::current_worker::helping guard(*worker);
+              // Nothing to run: the result is computed by another thread, and the worker sleeps until the state is
+              // ready or a closure is queued on the executor.
+              helping_waiter waiter(*this);
+              {
+                relocker relock(lk);
+                worker->wait_for_work(waiter);
+              }
+              try
+              {
+                while (! done)
+                {
+                  waiter.queued = false;
+                  bool executed;
+                  {
+                    relocker relock(lk);
+                    executed = worker->try_executing_one();
+                  }
+                  if (! executed && ! waiter.queued && ! done)
+                  {
+                    waiters.wait(lk);
+                  }
+                }
+              }
+              catch (...)
+              {
+                relocker relock(lk);
+                worker->stop_waiting_for_work(waiter);
+                throw;
+              }
+              relocker relock(lk);
+              worker->stop_waiting_for_work(waiter);
+            }
+
+            // Wakes up a worker waiting for the state when a closure is queued on its executor.
+            struct helping_waiter : executors::detail::work_waiter
+            {
+              shared_state_base& that;
+              // protected by the mutex of the state.
+              bool queued;
+
+              explicit helping_waiter(shared_state_base& st) : that(st), queued(false) {}
+              void on_work()
+              {
+                boost::lock_guard<boost::mutex> lk(that.mutex);
+                queued = true;
+                that.waiters.notify_all();
+              }
+            };
+#endif
+
+#if defined BOOST_THREAD_PROVIDES_CONTINUATION_FUSION
+            // A continuation kept aside by a job of the calling thread would run only once the job returns, so it is
+            // run before waiting.
+            void run_held_back_continuations(boost::unique_lock<boost::mutex>& lk)
+            {
+              if (! done && continuation_fusion_scope::holds_back())
+              {
+                relocker relock(lk);
+                continuation_fusion_scope::run_held_back();
+              }
+            }
+#endif
+
             void wait_internal(boost::unique_lock<boost::mutex> &lk, bool rethrow=true)
             {
               do_callback(lk);
@@ -392,6 +802,12 @@ namespace boost
                 is_deferred_=false;
                 execute(lk);
               }
+#if defined BOOST_THREAD_PROVIDES_CONTINUATION_FUSION
+              run_held_back_continuations(lk);
+#endif
+#if defined BOOST_THREAD_PROVIDES_HELP_WHILE_WAITING
+              help_while_waiting(lk);
+#endif
               waiters.wait(lk, boost::bind(&shared_state_base::is_done, this));
               if(rethrow && exception)
               {
@@ -442,6 +858,9 @@ namespace boost
               if (is_deferred_)
                   return future_status::deferred;
               do_callback(lock);
+#if defined BOOST_THREAD_PROVIDES_CONTINUATION_FUSION
+              run_held_back_continuations(lock);
+#endif
               if(!waiters.wait_until(lock, abs_time, boost::bind(&shared_state_base::is_done, this)))
               {
                   return future_status::timeout;
@@ -551,6 +970,120 @@ namespace boost
             shared_state_base& operator=(shared_state_base const&);
         };
 
+        inline void shared_state_canceller::operator()() const
+        {
+            if (shared_ptr<shared_state_base> st = that.lock())
+            {
+                st->cancel();
+            }
+        }
+
+        // Continuations released by several shared states, kept aside until all of them have been marked
+        // finished and then launched together. Continuations to be run by the same executor are handed to
+        // it in a single bulk submission.
+        struct continuation_batch
+        {
+            typedef shared_state_base::continuations_type continuations_type;
+
+            continuations_type continuations;
+#ifdef BOOST_THREAD_PROVIDES_EXECUTORS
+            struct executor_closures
+            {
+                executor_ptr_type ex;
+                std::vector<executors::work> closures;
+                // the states run by the closures, made exceptional if the executor rejects them.
+                std::vector<shared_ptr<shared_state_base> > states;
+            };
+            std::vector<executor_closures> by_executor;
+#endif
+
+            // Must be called with the lock of the state owning \c from, before it is marked finished.
+            void collect(continuations_type& from)
+            {
+                if (! from.empty())
+                {
+                    continuations.insert(continuations.end(), from.begin(), from.end());
+                    from.clear();
+                }
+            }
+
+#ifdef BOOST_THREAD_PROVIDES_EXECUTORS
+            void submit(executor_ptr_type const& ex, shared_ptr<shared_state_base> const& st, BOOST_THREAD_RV_REF(executors::work) closure)
+            {
+                void const* id = ex->identity();
+                std::size_t i = 0;
+                while (i < by_executor.size() && by_executor[i].ex->identity() != id)
+                {
+                    ++i;
+                }
+                if (i == by_executor.size())
+                {
+                    by_executor.push_back(executor_closures());
+                    by_executor.back().ex = ex;
+                }
+                by_executor[i].closures.push_back(boost::move(closure));
+                by_executor[i].states.push_back(st);
+            }
+
+            // Makes the states whose closures have been rejected by their executor ready with the exception \c e.
+            // The closures the executor has accepted before throwing still run, but their result is ignored.
+            static void reject(std::vector<shared_ptr<shared_state_base> >& states, exception_ptr const& e)
+            {
+                for (std::size_t i = 0; i < states.size(); ++i)
+                {
+                    boost::unique_lock<boost::mutex> lock(states[i]->mutex);
+                    if (! states[i]->done && ! states[i]->started_)
+                    {
+                        states[i]->mark_exceptional_finish_internal(e, lock);
+                    }
+                }
+            }
+#endif
+
+            // Must be called without holding any state lock.
+            // All the continuations are launched even if launching one of them throws; the first exception is then
+            // rethrown.
+            void launch()
+            {
+                exception_ptr error;
+                continuations_type the_continuations;
+                the_continuations.swap(continuations);
+                for (continuations_type::iterator it = the_continuations.begin(); it != the_continuations.end(); ++it)
+                {
+                    try
+                    {
+                        if (! (*it)->cancelled())
+                        {
+                            (*it)->enqueue_continuation(*this);
+                        }
+                    }
+                    catch (...)
+                    {
+                        if (! error) error = current_exception();
+                    }
+                }
+#ifdef BOOST_THREAD_PROVIDES_EXECUTORS
+                std::vector<executor_closures> the_executors;
+                the_executors.swap(by_executor);
+                for (std::size_t i = 0; i < the_executors.size(); ++i)
+                {
+                    std::vector<executors::work>& closures = the_executors[i].closures;
+                    try
+                    {
+                        the_executors[i].ex->submit_bulk(&closures[0], &closures[0] + closures.size());
+                    }
+                    catch (...)
+                    {
+                        exception_ptr e = current_exception();
+                        reject(the_executors[i].states, e);
+                        if (! error) error = e;
+                    }
+                }
+#endif
+                if (error) rethrow_exception(error);
+            }
+        };
+
         // Used to create stand-alone futures
         template<typename T>
         struct shared_state:
@@ -976,6 +1509,10 @@ namespace boost
 
           static void run(shared_ptr<future_async_shared_state> that, BOOST_THREAD_FWD_REF(Fp) f)
           {
+            if (! that->start_running())
+            {
+              return;
+            }
             try
             {
               that->mark_finished_with_result(f());
@@ -1001,6 +1538,10 @@ namespace boost
 
           static void run(shared_ptr<future_async_shared_state> that, BOOST_THREAD_FWD_REF(Fp) f)
           {
+            if (! that->start_running())
+            {
+              return;
+            }
             try
             {
               f();
@@ -1027,6 +1568,10 @@ namespace boost
 
           static void run(shared_ptr<future_async_shared_state> that, BOOST_THREAD_FWD_REF(Fp) f)
           {
+            if (! that->start_running())
+            {
+              return;
+            }
             try
             {
               that->mark_finished_with_result(f());
@@ -1053,6 +1598,10 @@ namespace boost
           }
 
           virtual void execute(boost::unique_lock<boost::mutex>& lck) {
+            if (! this->start_running(lck))
+            {
+              return;
+            }
             try
             {
               Fp local_fuct=boost::move(func_);
@@ -1079,6 +1628,10 @@ namespace boost
           }
 
           virtual void execute(boost::unique_lock<boost::mutex>& lck) {
+            if (! this->start_running(lck))
+            {
+              return;
+            }
             try
             {
               this->mark_finished_with_result_internal(func_(), lck);
@@ -1102,6 +1655,10 @@ namespace boost
           }
 
           virtual void execute(boost::unique_lock<boost::mutex>& lck) {
+            if (! this->start_running(lck))
+            {
+              return;
+            }
             try
             {
               Fp local_fuct=boost::move(func_);
@@ -1120,77 +1677,15 @@ namespace boost
         class future_waiter
         {
         public:
-            typedef std::vector<int>::size_type count_type;
+            typedef any_ready_waiter<boost::shared_ptr<shared_state_base> >::count_type count_type;
         private:
-            struct registered_waiter
-            {
-                boost::shared_ptr<detail::shared_state_base> future_;
-                detail::shared_state_base::notify_when_ready_handle handle;
-                count_type index;
-
-                registered_waiter(boost::shared_ptr<detail::shared_state_base> const& a_future,
-                                  detail::shared_state_base::notify_when_ready_handle handle_,
-                                  count_type index_):
-                    future_(a_future),handle(handle_),index(index_)
-                {}
-            };
+            any_ready_waiter<boost::shared_ptr<shared_state_base> > waiter_;
 
-            struct all_futures_lock
+        public:
+            template<typename F>
+            void add(F& f)
             {
-#ifdef _MANAGED
-                   typedef std::ptrdiff_t count_type_portable;
-#else
-                   typedef count_type count_type_portable;
-#endif
-                   count_type_portable count;
-                   boost::scoped_array<boost::unique_lock<boost::mutex> > locks;
-
-                all_futures_lock(std::vector<registered_waiter>& futures):
-                    count(futures.size()),locks(new boost::unique_lock<boost::mutex>[count])
-                {
-                    for(count_type_portable i=0;i<count;++i)
-                    {
-                        locks[i]=BOOST_THREAD_MAKE_RV_REF(boost::unique_lock<boost::mutex>(futures[i].future_->mutex));
-                    }
-                }
-
-                void lock()
-                {
-                    boost::lock(locks.get(),locks.get()+count);
-                }
-
-                void unlock()
-                {
-                    for(count_type_portable i=0;i<count;++i)
-                    {
-                        locks[i].unlock();
-                    }
-                }
-            };
-
-            boost::condition_variable_any cv;
-            std::vector<registered_waiter> futures_;
-            count_type future_count;
-
-        public:
-            future_waiter():
-                future_count(0)
-            {}
-
-            template<typename F>
-            void add(F& f)
-            {
-                if(f.future_)
-                {
-                  registered_waiter waiter(f.future_,f.future_->notify_when_ready(cv),future_count);
-                  try {
-                    futures_.push_back(waiter);
-                  } catch(...) {
-                    f.future_->unnotify_when_ready(waiter.handle);
-                    throw;
-                  }
-                }
-                ++future_count;
+                waiter_.add(f);
             }
 
 #ifndef BOOST_NO_CXX11_VARIADIC_TEMPLATES
@@ -1203,26 +1698,7 @@ namespace boost
 
             count_type wait()
             {
-                all_futures_lock lk(futures_);
-                for(;;)
-                {
-                    for(count_type i=0;i<futures_.size();++i)
-                    {
-                        if(futures_[i].future_->done)
-                        {
-                            return futures_[i].index;
-                        }
-                    }
-                    cv.wait(lk);
-                }
-            }
-
-            ~future_waiter()
-            {
-                for(count_type i=0;i<futures_.size();++i)
-                {
-                    futures_[i].future_->unnotify_when_ready(futures_[i].handle);
-                }
+                return waiter_.wait();
             }
         };
 
@@ -1314,11 +1790,307 @@ namespace boost
     template <typename R>
     class promise;
 
+    class promise_batch;
+
     template <typename R>
     class packaged_task;
 
     namespace detail
     {
+      /// Whether the value of a ready future is stored in place: it must fit in a pointer and be moved without
+      /// throwing, so that the future stays small and its move constructor noexcept.
+      template <typename R>
+      struct ready_value_in_place
+      {
+        BOOST_STATIC_CONSTANT(bool, value = (sizeof(R) <= sizeof(void*)
+            && alignment_of<R>::value <= alignment_of<void*>::value
+            && is_nothrow_move_constructible<R>::value));
+      };
+      template <typename R>
+      struct ready_value_in_place<R&>
+      {
+        BOOST_STATIC_CONSTANT(bool, value = true);
+      };
+      template <>
+      struct ready_value_in_place<void>
+      {
+        BOOST_STATIC_CONSTANT(bool, value = true);
+      };
+
+      /// Storage of the value of a ready_result, constructed and destroyed by it.
+      template <typename R, bool InPlace = ready_value_in_place<R>::value>
+      class ready_value
+      {
+        typename aligned_storage<sizeof(void*), alignment_of<void*>::value>::type buffer_;
+
+        R* get() BOOST_NOEXCEPT
+        {
+          return static_cast<R*>(static_cast<void*>(&buffer_));
+        }
+
+      public:
+#if ! defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+        template <class ...Args>
+        void construct(BOOST_THREAD_FWD_REF(Args)... args)
+        {
+          new (&buffer_) R(boost::forward<Args>(args)...);
+        }
+#else
+        template <class T>
+        void construct(BOOST_THREAD_FWD_REF(T) v)
+        {
+          new (&buffer_) R(boost::forward<T>(v));
+        }
+        void construct()
+        {
+          new (&buffer_) R();
+        }
+#endif
+        void destroy() BOOST_NOEXCEPT
+        {
+          get()->~R();
+        }
+        // Requires: *this holds no value.
+        void move_from(ready_value& other) BOOST_NOEXCEPT
+        {
+          new (&buffer_) R(boost::move(*other.get()));
+          other.destroy();
+        }
+        typename shared_state<R>::move_dest_type take()
+        {
+          return boost::move(*get());
+        }
+        void mark_finished(shared_state<R>& st, boost::unique_lock<boost::mutex>& lk)
+        {
+          st.mark_finished_with_result_internal(boost::move(*get()), lk);
+        }
+      };
+
+      template <typename R>
+      class ready_value<R, false>
+      {
+        R* value_;
+
+      public:
+#if ! defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+        template <class ...Args>
+        void construct(BOOST_THREAD_FWD_REF(Args)... args)
+        {
+          value_ = new R(boost::forward<Args>(args)...);
+        }
+#else
+        template <class T>
+        void construct(BOOST_THREAD_FWD_REF(T) v)
+        {
+          value_ = new R(boost::forward<T>(v));
+        }
+        void construct()
+        {
+          value_ = new R();
+        }
+#endif
+        void destroy() BOOST_NOEXCEPT
+        {
+          delete value_;
+        }
+        void move_from(ready_value& other) BOOST_NOEXCEPT
+        {
+          value_ = other.value_;
+        }
+        typename shared_state<R>::move_dest_type take()
+        {
+          return boost::move(*value_);
+        }
+        void mark_finished(shared_state<R>& st, boost::unique_lock<boost::mutex>& lk)
+        {
+          st.mark_finished_with_result_internal(boost::move(*value_), lk);
+        }
+      };
+
+      template <typename R, bool InPlace>
+      class ready_value<R&, InPlace>
+      {
+        R* value_;
+
+      public:
+        void construct(R& v) BOOST_NOEXCEPT
+        {
+          value_ = boost::addressof(v);
+        }
+        void destroy() BOOST_NOEXCEPT
+        {
+        }
+        void move_from(ready_value& other) BOOST_NOEXCEPT
+        {
+          value_ = other.value_;
+        }
+        R& take()
+        {
+          return *value_;
+        }
+        void mark_finished(shared_state<R&>& st, boost::unique_lock<boost::mutex>& lk)
+        {
+          st.mark_finished_with_result_internal(*value_, lk);
+        }
+      };
+
+      template <bool InPlace>
+      class ready_value<void, InPlace>
+      {
+      public:
+        void construct() BOOST_NOEXCEPT
+        {
+        }
+        void destroy() BOOST_NOEXCEPT
+        {
+        }
+        void move_from(ready_value&) BOOST_NOEXCEPT
+        {
+        }
+        void take()
+        {
+        }
+        void mark_finished(shared_state<void>& st, boost::unique_lock<boost::mutex>& lk)
+        {
+          st.mark_finished_with_result_internal(lk);
+        }
+      };
+
+      /// Result of a future made ready without a shared state, e.g. by make_ready_future().
+      ///
+      /// A value fitting in a pointer is stored in place, any other value and the exceptions are allocated, so that
+      /// the result takes at most two words and is moved without throwing. Such a future needs neither a shared state
+      /// nor any synchronization until one is materialized.
+      template <typename R>
+      class ready_result
+      {
+        typedef typename shared_state<R>::move_dest_type move_dest_type;
+
+        // retrieved: the value has been moved out by get(), and is destroyed with the result.
+        enum kind_type { empty_kind, value_kind, retrieved_kind, exception_kind };
+
+        union
+        {
+          ready_value<R> value_;
+          exception_ptr* exception_;
+        };
+        unsigned char kind_;
+
+      public:
+        BOOST_THREAD_NO_COPYABLE(ready_result)
+
+        ready_result() BOOST_NOEXCEPT : kind_(empty_kind) {}
+        ~ready_result()
+        {
+          reset();
+        }
+
+        bool empty() const BOOST_NOEXCEPT
+        {
+          return kind_ == empty_kind || kind_ == retrieved_kind;
+        }
+        bool has_value() const BOOST_NOEXCEPT
+        {
+          return kind_ == value_kind;
+        }
+        bool has_exception() const BOOST_NOEXCEPT
+        {
+          return kind_ == exception_kind;
+        }
+        exception_ptr get_exception_ptr() const
+        {
+          return kind_ == exception_kind ? *exception_ : exception_ptr();
+        }
+        void set_exception(exception_ptr e)
+        {
+          exception_ptr* p = new exception_ptr(e);
+          reset();
+          exception_ = p;
+          kind_ = exception_kind;
+        }
+#if ! defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+        template <class ...Args>
+        void set_value(BOOST_THREAD_FWD_REF(Args)... args)
+        {
+          reset();
+          value_.construct(boost::forward<Args>(args)...);
+          kind_ = value_kind;
+        }
+#else
+        template <typename T>
+        void set_value(BOOST_THREAD_FWD_REF(T) v)
+        {
+          reset();
+          value_.construct(boost::forward<T>(v));
+          kind_ = value_kind;
+        }
+        template <typename T>
+        void set_value(T& v)
+        {
+          reset();
+          value_.construct(v);
+          kind_ = value_kind;
+        }
+        void set_value()
+        {
+          reset();
+          value_.construct();
+          kind_ = value_kind;
+        }
+#endif
+        void reset() BOOST_NOEXCEPT
+        {
+          if (kind_ == value_kind || kind_ == retrieved_kind) value_.destroy();
+          else if (kind_ == exception_kind) delete exception_;
+          kind_ = empty_kind;
+        }
+        // Requires: *this is empty.
+        void move_from(ready_result& other) BOOST_NOEXCEPT
+        {
+          if (other.kind_ == value_kind || other.kind_ == retrieved_kind) value_.move_from(other.value_);
+          else if (other.kind_ == exception_kind) exception_ = other.exception_;
+          kind_ = other.kind_;
+          other.kind_ = empty_kind;
+        }
+        void swap(ready_result& other) BOOST_NOEXCEPT
+        {
+          ready_result tmp;
+          tmp.move_from(*this);
+          move_from(other);
+          other.move_from(tmp);
+        }
+
+        move_dest_type get(bool invalidate)
+        {
+          if (kind_ == exception_kind)
+          {
+            exception_ptr e = *exception_;
+            if (invalidate) reset();
+            boost::rethrow_exception(e);
+          }
+          if (invalidate) kind_ = retrieved_kind;
+          return value_.take();
+        }
+
+        /// Moves the result to a new shared state, already ready.
+        shared_ptr<shared_state<R> > make_shared_state()
+        {
+          shared_ptr<shared_state<R> > st;
+          if (kind_ == exception_kind)
+          {
+            st.reset(new shared_state<R>(exceptional_ptr(*exception_)));
+          }
+          else
+          {
+            st.reset(new shared_state<R>());
+            boost::unique_lock<boost::mutex> lk(st->mutex);
+            value_.mark_finished(*st, lk);
+          }
+          reset();
+          return st;
+        }
+      };
+
       /// Common implementation for all the futures independently of the return type
       class base_future
       {
@@ -1346,6 +2118,12 @@ namespace boost
         {
         }
 
+        /// Returns: the shared state, which a basic_future always has if it is valid.
+        future_ptr const& materialize()
+        {
+          return future_;
+        }
+
       public:
         typedef future_state::state state;
 
@@ -1520,63 +2298,228 @@ namespace boost
 
       };
 
-    } // detail
-    BOOST_THREAD_DCL_MOVABLE_BEG(R) detail::basic_future<R> BOOST_THREAD_DCL_MOVABLE_END
-
-    namespace detail
-    {
-#if (!defined _MSC_VER || _MSC_VER >= 1400) // _MSC_VER == 1400 on MSVC 2005
-        template <class Rp, class Fp>
-        BOOST_THREAD_FUTURE<Rp>
-        make_future_async_shared_state(BOOST_THREAD_FWD_REF(Fp) f);
-
-        template <class Rp, class Fp>
-        BOOST_THREAD_FUTURE<Rp>
-        make_future_deferred_shared_state(BOOST_THREAD_FWD_REF(Fp) f);
-#endif // #if (!defined _MSC_VER || _MSC_VER >= 1400)
-#if defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION
-        template<typename F, typename Rp, typename Fp>
-        struct future_deferred_continuation_shared_state;
-        template<typename F, typename Rp, typename Fp>
-        struct future_async_continuation_shared_state;
+      /// Common implementation for future, which can also hold the result of a future made ready without a shared
+      /// state. shared_future has no such result, as a future gets a shared state when it is shared.
+      template <typename R>
+      class basic_unique_future : public basic_future<R>
+      {
+      protected:
+      public:
+        typedef basic_future<R> base_type;
+        typedef typename base_type::future_ptr future_ptr;
 
-        template <class F, class Rp, class Fp>
-        BOOST_THREAD_FUTURE<Rp>
-        make_future_async_continuation_shared_state(boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
+        ready_result<R> ready_;
 
-        template <class F, class Rp, class Fp>
-        BOOST_THREAD_FUTURE<Rp>
-        make_future_sync_continuation_shared_state(boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
+        basic_unique_future(future_ptr a_future):
+          base_type(a_future)
+        {
+        }
 
-        template <class F, class Rp, class Fp>
-        BOOST_THREAD_FUTURE<Rp>
-        make_future_deferred_continuation_shared_state(boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
+        /// Returns: the shared state, creating it if the future has been made ready without one.
+        future_ptr const& materialize()
+        {
+          if (! this->future_ && ! ready_.empty())
+          {
+            this->future_ = ready_.make_shared_state();
+          }
+          return this->future_;
+        }
 
-        template<typename F, typename Rp, typename Fp>
-        BOOST_THREAD_FUTURE<Rp>
-        make_shared_future_deferred_continuation_shared_state(boost::unique_lock<boost::mutex> &lock, F f, BOOST_THREAD_FWD_REF(Fp) c);
+      public:
+        typedef future_state::state state;
 
-        template<typename F, typename Rp, typename Fp>
-        BOOST_THREAD_FUTURE<Rp>
-        make_shared_future_async_continuation_shared_state(boost::unique_lock<boost::mutex> &lock, F f, BOOST_THREAD_FWD_REF(Fp) c);
+        BOOST_THREAD_MOVABLE_ONLY(basic_unique_future)
+        basic_unique_future() {}
 
-        template<typename F, typename Rp, typename Fp>
-        BOOST_THREAD_FUTURE<Rp>
-        make_shared_future_sync_continuation_shared_state(boost::unique_lock<boost::mutex> &lock, F f, BOOST_THREAD_FWD_REF(Fp) c);
+        ~basic_unique_future() {
+        }
 
+        basic_unique_future(BOOST_THREAD_RV_REF(basic_unique_future) other) BOOST_NOEXCEPT:
+        base_type(boost::move(static_cast<base_type&>(BOOST_THREAD_RV(other))))
+        {
+            ready_.move_from(BOOST_THREAD_RV(other).ready_);
+        }
+        explicit basic_unique_future(BOOST_THREAD_RV_REF(base_type) other) BOOST_NOEXCEPT:
+        base_type(boost::move(static_cast<base_type&>(BOOST_THREAD_RV(other))))
+        {
+        }
+        basic_unique_future& operator=(BOOST_THREAD_RV_REF(basic_unique_future) other) BOOST_NOEXCEPT
+        {
+            base_type::operator=(boost::move(static_cast<base_type&>(BOOST_THREAD_RV(other))));
+            ready_.reset();
+            ready_.move_from(BOOST_THREAD_RV(other).ready_);
+            return *this;
+        }
+        void swap(basic_unique_future& that) BOOST_NOEXCEPT
+        {
+          base_type::swap(that);
+          ready_.swap(that.ready_);
+        }
+        // functions to check state, and wait for ready
+        state get_state(boost::unique_lock<boost::mutex>& lk) const
+        {
+            if (! this->future_ && ! ready_.empty()) return future_state::ready;
+            return base_type::get_state(lk);
+        }
+        state get_state() const
+        {
+            if (! this->future_ && ! ready_.empty()) return future_state::ready;
+            return base_type::get_state();
+        }
 
-  #ifdef BOOST_THREAD_PROVIDES_EXECUTORS
-        template<typename Ex, typename F, typename Rp, typename Fp>
-        BOOST_THREAD_FUTURE<Rp>
-        make_future_executor_continuation_shared_state(Ex& ex, boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
+        bool is_ready() const
+        {
+            return get_state()==future_state::ready;
+        }
 
-        template<typename Ex, typename F, typename Rp, typename Fp>
+        bool is_ready(boost::unique_lock<boost::mutex>& lk) const
+        {
+            return get_state(lk)==future_state::ready;
+        }
+        bool has_exception() const
+        {
+            if (! this->future_) return ready_.has_exception();
+            return base_type::has_exception();
+        }
+
+        bool has_value() const
+        {
+            if (! this->future_) return ready_.has_value();
+            return base_type::has_value();
+        }
+
+        exception_ptr get_exception_ptr()
+        {
+            if (! this->future_) return ready_.get_exception_ptr();
+            return base_type::get_exception_ptr();
+        }
+
+        bool valid() const BOOST_NOEXCEPT
+        {
+            if (! this->future_) return ! ready_.empty();
+            return base_type::valid();
+        }
+
+        void wait() const
+        {
+            if (! this->future_ && ! ready_.empty()) return;
+            base_type::wait();
+        }
+
+        typedef typename base_type::notify_when_ready_handle notify_when_ready_handle;
+
+        boost::mutex& mutex() {
+          materialize();
+          return base_type::mutex();
+        }
+
+        notify_when_ready_handle notify_when_ready(boost::condition_variable_any& cv)
+        {
+          materialize();
+          return base_type::notify_when_ready(cv);
+        }
+
+#if defined BOOST_THREAD_USES_DATETIME
+        template<typename Duration>
+        bool timed_wait(Duration const& rel_time) const
+        {
+            if (! this->future_ && ! ready_.empty()) return true;
+            return base_type::timed_wait(rel_time);
+        }
+
+        bool timed_wait_until(boost::system_time const& abs_time) const
+        {
+            if (! this->future_ && ! ready_.empty()) return true;
+            return base_type::timed_wait_until(abs_time);
+        }
+#endif
+#ifdef BOOST_THREAD_USES_CHRONO
+        template <class Rep, class Period>
+        future_status
+        wait_for(const chrono::duration<Rep, Period>& rel_time) const
+        {
+          if (! this->future_ && ! ready_.empty()) return future_status::ready;
+          return base_type::wait_for(rel_time);
+        }
+        template <class Clock, class Duration>
+        future_status
+        wait_until(const chrono::time_point<Clock, Duration>& abs_time) const
+        {
+          if (! this->future_ && ! ready_.empty()) return future_status::ready;
+          return base_type::wait_until(abs_time);
+        }
+#endif
+
+      };
+
+    } // detail
+    BOOST_THREAD_DCL_MOVABLE_BEG(R) detail::basic_future<R> BOOST_THREAD_DCL_MOVABLE_END
+    BOOST_THREAD_DCL_MOVABLE_BEG(R) detail::basic_unique_future<R> BOOST_THREAD_DCL_MOVABLE_END
+
+    namespace detail
+    {
+#if (!defined _MSC_VER || _MSC_VER >= 1400) // _MSC_VER == 1400 on MSVC 2005
+        template <class Rp, class Fp>
         BOOST_THREAD_FUTURE<Rp>
-        make_shared_future_executor_continuation_shared_state(Ex& ex, boost::unique_lock<boost::mutex> &lock, F f, BOOST_THREAD_FWD_REF(Fp) c);
+        make_future_async_shared_state(stop_token const& st, BOOST_THREAD_FWD_REF(Fp) f);
+
+        template <class Rp, class Fp>
+        BOOST_THREAD_FUTURE<Rp>
+        make_future_deferred_shared_state(stop_token const& st, BOOST_THREAD_FWD_REF(Fp) f);
+#endif // #if (!defined _MSC_VER || _MSC_VER >= 1400)
+#if defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION
+        // The executor overloads of then() are not viable when a stop_token is passed first.
+        template <class Ex, class T>
+        struct disable_if_stop_token : disable_if<is_same<typename remove_cv<Ex>::type, stop_token>, T>
+        {
+        };
+
+        template<typename F, typename Rp, typename Fp>
+        struct future_deferred_continuation_shared_state;
+        template<typename F, typename Rp, typename Fp>
+        struct future_async_continuation_shared_state;
+
+        template <class F, class Rp, class Fp>
+        BOOST_THREAD_FUTURE<Rp>
+        make_future_async_continuation_shared_state(stop_token const& st, boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
+
+        template <class F, class Rp, class Fp>
+        BOOST_THREAD_FUTURE<Rp>
+        make_future_sync_continuation_shared_state(stop_token const& st, boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
+
+        template <class F, class Rp, class Fp>
+        BOOST_THREAD_FUTURE<Rp>
+        make_future_deferred_continuation_shared_state(stop_token const& st, boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
+
+        template<typename F, typename Rp, typename Fp>
+        BOOST_THREAD_FUTURE<Rp>
+        make_shared_future_deferred_continuation_shared_state(stop_token const& st, boost::unique_lock<boost::mutex> &lock, F f, BOOST_THREAD_FWD_REF(Fp) c);
+
+        template<typename F, typename Rp, typename Fp>
+        BOOST_THREAD_FUTURE<Rp>
+        make_shared_future_async_continuation_shared_state(stop_token const& st, boost::unique_lock<boost::mutex> &lock, F f, BOOST_THREAD_FWD_REF(Fp) c);
+
+        template<typename F, typename Rp, typename Fp>
+        BOOST_THREAD_FUTURE<Rp>
+        make_shared_future_sync_continuation_shared_state(stop_token const& st, boost::unique_lock<boost::mutex> &lock, F f, BOOST_THREAD_FWD_REF(Fp) c);
+
+
+  #ifdef BOOST_THREAD_PROVIDES_EXECUTORS
+        template<typename Ex, typename F, typename Rp, typename Fp>
+        BOOST_THREAD_FUTURE<Rp>
+        make_future_executor_continuation_shared_state(Ex& ex, stop_token const& st, boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
+
+        template<typename Ex, typename F, typename Rp, typename Fp>
+        BOOST_THREAD_FUTURE<Rp>
+        make_shared_future_executor_continuation_shared_state(Ex& ex, stop_token const& st, boost::unique_lock<boost::mutex> &lock, F f, BOOST_THREAD_FWD_REF(Fp) c);
 
         template <class Rp, class Fp, class Executor>
         BOOST_THREAD_FUTURE<Rp>
-        make_future_executor_shared_state(Executor& ex, BOOST_THREAD_FWD_REF(Fp) f);
+        make_future_executor_shared_state(Executor& ex, stop_token const& st, BOOST_THREAD_FWD_REF(Fp) f);
+
+        template <class Rt, class State, class Executor>
+        BOOST_THREAD_FUTURE<Rt>
+        make_future_bulk_shared_state(Executor& ex, shared_ptr<State> const& h);
   #endif
 #endif
 #if defined BOOST_THREAD_PROVIDES_FUTURE_UNWRAP
@@ -1619,10 +2562,10 @@ namespace boost
 
 
     template <typename R>
-    class BOOST_THREAD_FUTURE : public detail::basic_future<R>
+    class BOOST_THREAD_FUTURE : public detail::basic_unique_future<R>
     {
     private:
-        typedef detail::basic_future<R> base_type;
+        typedef detail::basic_unique_future<R> base_type;
         typedef typename base_type::future_ptr future_ptr;
 
         friend class shared_future<R>;
@@ -1635,40 +2578,44 @@ namespace boost
 
         template <class F, class Rp, class Fp>
         friend BOOST_THREAD_FUTURE<Rp>
-        detail::make_future_async_continuation_shared_state(boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
+        detail::make_future_async_continuation_shared_state(stop_token const& st, boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
 
         template <class F, class Rp, class Fp>
         friend BOOST_THREAD_FUTURE<Rp>
-        detail::make_future_sync_continuation_shared_state(boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
+        detail::make_future_sync_continuation_shared_state(stop_token const& st, boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
 
         template <class F, class Rp, class Fp>
         friend BOOST_THREAD_FUTURE<Rp>
-        detail::make_future_deferred_continuation_shared_state(boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
+        detail::make_future_deferred_continuation_shared_state(stop_token const& st, boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
 
         template<typename F, typename Rp, typename Fp>
         friend BOOST_THREAD_FUTURE<Rp>
-        detail::make_shared_future_deferred_continuation_shared_state(boost::unique_lock<boost::mutex> &lock, F f, BOOST_THREAD_FWD_REF(Fp) c);
+        detail::make_shared_future_deferred_continuation_shared_state(stop_token const& st, boost::unique_lock<boost::mutex> &lock, F f, BOOST_THREAD_FWD_REF(Fp) c);
 
         template<typename F, typename Rp, typename Fp>
         friend BOOST_THREAD_FUTURE<Rp>
-        detail::make_shared_future_async_continuation_shared_state(boost::unique_lock<boost::mutex> &lock, F f, BOOST_THREAD_FWD_REF(Fp) c);
+        detail::make_shared_future_async_continuation_shared_state(stop_token const& st, boost::unique_lock<boost::mutex> &lock, F f, BOOST_THREAD_FWD_REF(Fp) c);
 
         template<typename F, typename Rp, typename Fp>
         friend BOOST_THREAD_FUTURE<Rp>
-        detail::make_shared_future_sync_continuation_shared_state(boost::unique_lock<boost::mutex> &lock, F f, BOOST_THREAD_FWD_REF(Fp) c);
+        detail::make_shared_future_sync_continuation_shared_state(stop_token const& st, boost::unique_lock<boost::mutex> &lock, F f, BOOST_THREAD_FWD_REF(Fp) c);
 
   #ifdef BOOST_THREAD_PROVIDES_EXECUTORS
         template<typename Ex, typename F, typename Rp, typename Fp>
         friend BOOST_THREAD_FUTURE<Rp>
-        detail::make_future_executor_continuation_shared_state(Ex& ex, boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
+        detail::make_future_executor_continuation_shared_state(Ex& ex, stop_token const& st, boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
 
         template<typename Ex, typename F, typename Rp, typename Fp>
         friend BOOST_THREAD_FUTURE<Rp>
-        detail::make_shared_future_executor_continuation_shared_state(Ex& ex, boost::unique_lock<boost::mutex> &lock, F f, BOOST_THREAD_FWD_REF(Fp) c);
+        detail::make_shared_future_executor_continuation_shared_state(Ex& ex, stop_token const& st, boost::unique_lock<boost::mutex> &lock, F f, BOOST_THREAD_FWD_REF(Fp) c);
 
         template <class Rp, class Fp, class Executor>
         friend BOOST_THREAD_FUTURE<Rp>
-        detail::make_future_executor_shared_state(Executor& ex, BOOST_THREAD_FWD_REF(Fp) f);
+        detail::make_future_executor_shared_state(Executor& ex, stop_token const& st, BOOST_THREAD_FWD_REF(Fp) f);
+
+        template <class Rt, class State, class Executor>
+        friend BOOST_THREAD_FUTURE<Rt>
+        detail::make_future_bulk_shared_state(Executor& ex, shared_ptr<State> const& h);
   #endif
 #endif
 #if defined BOOST_THREAD_PROVIDES_FUTURE_UNWRAP
@@ -1716,11 +2663,11 @@ namespace boost
 
         template <class Rp, class Fp>
         friend BOOST_THREAD_FUTURE<Rp>
-        detail::make_future_async_shared_state(BOOST_THREAD_FWD_REF(Fp) f);
+        detail::make_future_async_shared_state(stop_token const& st, BOOST_THREAD_FWD_REF(Fp) f);
 
         template <class Rp, class Fp>
         friend BOOST_THREAD_FUTURE<Rp>
-        detail::make_future_deferred_shared_state(BOOST_THREAD_FWD_REF(Fp) f);
+        detail::make_future_deferred_shared_state(stop_token const& st, BOOST_THREAD_FWD_REF(Fp) f);
 
         typedef typename base_type::move_dest_type move_dest_type;
 
@@ -1736,8 +2683,11 @@ namespace boost
 
         BOOST_CONSTEXPR BOOST_THREAD_FUTURE() {}
         //BOOST_CONSTEXPR
-        BOOST_THREAD_FUTURE(exceptional_ptr const& ex):
-            base_type(ex) {}
+        BOOST_THREAD_FUTURE(exceptional_ptr const& ex)
+        {
+          if (ex.ptr_) this->ready_.set_exception(ex.ptr_);
+          else this->future_ = base_type::make_exceptional_future_ptr(ex);
+        }
 
         ~BOOST_THREAD_FUTURE() {
         }
@@ -1751,7 +2701,7 @@ namespace boost
 #endif
 
         explicit BOOST_THREAD_FUTURE(BOOST_THREAD_RV_REF(shared_future<R>) other) :
-        base_type(boost::move(static_cast<base_type&>(BOOST_THREAD_RV(other))))
+        base_type(boost::move(static_cast<detail::basic_future<R>&>(BOOST_THREAD_RV(other))))
         {}
 
         BOOST_THREAD_FUTURE& operator=(BOOST_THREAD_RV_REF(BOOST_THREAD_FUTURE) other) BOOST_NOEXCEPT
@@ -1781,9 +2731,11 @@ namespace boost
           this->future_->set_deferred();
         }
         bool run_if_is_deferred() {
+          if (! this->future_) return false;
           return this->future_->run_if_is_deferred();
         }
         bool run_if_is_deferred_or_ready() {
+          if (! this->future_) return true;
           return this->future_->run_if_is_deferred_or_ready();
         }
         // retrieving the value
@@ -1791,7 +2743,15 @@ namespace boost
         {
             if (this->future_.get() == 0)
             {
-                boost::throw_exception(future_uninitialized());
+                if (this->ready_.empty())
+                {
+                    boost::throw_exception(future_uninitialized());
+                }
+#ifdef BOOST_THREAD_PROVIDES_FUTURE_INVALID_AFTER_GET
+                return this->ready_.get(true);
+#else
+                return this->ready_.get(false);
+#endif
             }
             unique_lock<boost::mutex> lk(this->future_->mutex);
             if (! this->future_->valid(lk))
@@ -1811,7 +2771,22 @@ namespace boost
 
             if (this->future_.get() == 0)
             {
-                boost::throw_exception(future_uninitialized());
+                if (this->ready_.empty())
+                {
+                    boost::throw_exception(future_uninitialized());
+                }
+                if (this->ready_.has_value())
+                {
+#ifdef BOOST_THREAD_PROVIDES_FUTURE_INVALID_AFTER_GET
+                    return this->ready_.get(true);
+#else
+                    return this->ready_.get(false);
+#endif
+                }
+#ifdef BOOST_THREAD_PROVIDES_FUTURE_INVALID_AFTER_GET
+                this->ready_.reset();
+#endif
+                return boost::move(v);
             }
             unique_lock<boost::mutex> lk(this->future_->mutex);
             if (! this->future_->valid(lk))
@@ -1837,7 +2812,22 @@ namespace boost
         {
             if (this->future_.get() == 0)
             {
-                boost::throw_exception(future_uninitialized());
+                if (this->ready_.empty())
+                {
+                    boost::throw_exception(future_uninitialized());
+                }
+                if (this->ready_.has_value())
+                {
+#ifdef BOOST_THREAD_PROVIDES_FUTURE_INVALID_AFTER_GET
+                    return this->ready_.get(true);
+#else
+                    return this->ready_.get(false);
+#endif
+                }
+#ifdef BOOST_THREAD_PROVIDES_FUTURE_INVALID_AFTER_GET
+                this->ready_.reset();
+#endif
+                return v;
             }
             unique_lock<boost::mutex> lk(this->future_->mutex);
             if (! this->future_->valid(lk))
@@ -1863,10 +2853,19 @@ namespace boost
         template<typename F>
         inline BOOST_THREAD_FUTURE<typename boost::result_of<F(BOOST_THREAD_FUTURE)>::type>
         then(launch policy, BOOST_THREAD_FWD_REF(F) func);  // EXTENSION
+        template<typename F>
+        inline BOOST_THREAD_FUTURE<typename boost::result_of<F(BOOST_THREAD_FUTURE)>::type>
+        then(stop_token const& st, BOOST_THREAD_FWD_REF(F) func);  // EXTENSION
+        template<typename F>
+        inline BOOST_THREAD_FUTURE<typename boost::result_of<F(BOOST_THREAD_FUTURE)>::type>
+        then(launch policy, stop_token const& st, BOOST_THREAD_FWD_REF(F) func);  // EXTENSION
   #ifdef BOOST_THREAD_PROVIDES_EXECUTORS
         template<typename Ex, typename F>
-        inline BOOST_THREAD_FUTURE<typename boost::result_of<F(BOOST_THREAD_FUTURE)>::type>
+        inline typename detail::disable_if_stop_token<Ex, BOOST_THREAD_FUTURE<typename boost::result_of<F(BOOST_THREAD_FUTURE)>::type> >::type
         then(Ex& ex, BOOST_THREAD_FWD_REF(F) func);  // EXTENSION
+        template<typename Ex, typename F>
+        inline BOOST_THREAD_FUTURE<typename boost::result_of<F(BOOST_THREAD_FUTURE)>::type>
+        then(Ex& ex, stop_token const& st, BOOST_THREAD_FWD_REF(F) func);  // EXTENSION
   #endif
 
         template <typename R2>
@@ -1883,12 +2882,12 @@ namespace boost
     BOOST_THREAD_DCL_MOVABLE_BEG(T) BOOST_THREAD_FUTURE<T> BOOST_THREAD_DCL_MOVABLE_END
 
         template <typename R2>
-        class BOOST_THREAD_FUTURE<BOOST_THREAD_FUTURE<R2> > : public detail::basic_future<BOOST_THREAD_FUTURE<R2> >
+        class BOOST_THREAD_FUTURE<BOOST_THREAD_FUTURE<R2> > : public detail::basic_unique_future<BOOST_THREAD_FUTURE<R2> >
         {
           typedef BOOST_THREAD_FUTURE<R2> R;
 
         private:
-            typedef detail::basic_future<R> base_type;
+            typedef detail::basic_unique_future<R> base_type;
             typedef typename base_type::future_ptr future_ptr;
 
             friend class shared_future<R>;
@@ -1901,40 +2900,40 @@ namespace boost
 
             template <class F, class Rp, class Fp>
             friend BOOST_THREAD_FUTURE<Rp>
-            detail::make_future_async_continuation_shared_state(boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
+            detail::make_future_async_continuation_shared_state(stop_token const& st, boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
 
             template <class F, class Rp, class Fp>
             friend BOOST_THREAD_FUTURE<Rp>
-            detail::make_future_sync_continuation_shared_state(boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
+            detail::make_future_sync_continuation_shared_state(stop_token const& st, boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
 
             template <class F, class Rp, class Fp>
             friend BOOST_THREAD_FUTURE<Rp>
-            detail::make_future_deferred_continuation_shared_state(boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
+            detail::make_future_deferred_continuation_shared_state(stop_token const& st, boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
 
             template<typename F, typename Rp, typename Fp>
             friend BOOST_THREAD_FUTURE<Rp>
-            detail::make_shared_future_deferred_continuation_shared_state(boost::unique_lock<boost::mutex> &lock, F f, BOOST_THREAD_FWD_REF(Fp) c);
+            detail::make_shared_future_deferred_continuation_shared_state(stop_token const& st, boost::unique_lock<boost::mutex> &lock, F f, BOOST_THREAD_FWD_REF(Fp) c);
 
             template<typename F, typename Rp, typename Fp>
             friend BOOST_THREAD_FUTURE<Rp>
-            detail::make_shared_future_async_continuation_shared_state(boost::unique_lock<boost::mutex> &lock, F f, BOOST_THREAD_FWD_REF(Fp) c);
+            detail::make_shared_future_async_continuation_shared_state(stop_token const& st, boost::unique_lock<boost::mutex> &lock, F f, BOOST_THREAD_FWD_REF(Fp) c);
 
             template<typename F, typename Rp, typename Fp>
             friend BOOST_THREAD_FUTURE<Rp>
-            detail::make_shared_future_sync_continuation_shared_state(boost::unique_lock<boost::mutex> &lock, F f, BOOST_THREAD_FWD_REF(Fp) c);
+            detail::make_shared_future_sync_continuation_shared_state(stop_token const& st, boost::unique_lock<boost::mutex> &lock, F f, BOOST_THREAD_FWD_REF(Fp) c);
 
       #ifdef BOOST_THREAD_PROVIDES_EXECUTORS
             template<typename Ex, typename F, typename Rp, typename Fp>
             friend BOOST_THREAD_FUTURE<Rp>
-            detail::make_future_executor_continuation_shared_state(Ex& ex, boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
+            detail::make_future_executor_continuation_shared_state(Ex& ex, stop_token const& st, boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
 
             template<typename Ex, typename F, typename Rp, typename Fp>
             friend BOOST_THREAD_FUTURE<Rp>
-            detail::make_shared_future_executor_continuation_shared_state(Ex& ex, boost::unique_lock<boost::mutex> &lock, F f, BOOST_THREAD_FWD_REF(Fp) c);
+            detail::make_shared_future_executor_continuation_shared_state(Ex& ex, stop_token const& st, boost::unique_lock<boost::mutex> &lock, F f, BOOST_THREAD_FWD_REF(Fp) c);
 
             template <class Rp, class Fp, class Executor>
             friend BOOST_THREAD_FUTURE<Rp>
-            detail::make_future_executor_shared_state(Executor& ex, BOOST_THREAD_FWD_REF(Fp) f);
+            detail::make_future_executor_shared_state(Executor& ex, stop_token const& st, BOOST_THREAD_FWD_REF(Fp) f);
       #endif
 
 #endif
@@ -1984,11 +2983,11 @@ namespace boost
 
             template <class Rp, class Fp>
             friend BOOST_THREAD_FUTURE<Rp>
-            detail::make_future_async_shared_state(BOOST_THREAD_FWD_REF(Fp) f);
+            detail::make_future_async_shared_state(stop_token const& st, BOOST_THREAD_FWD_REF(Fp) f);
 
             template <class Rp, class Fp>
             friend BOOST_THREAD_FUTURE<Rp>
-            detail::make_future_deferred_shared_state(BOOST_THREAD_FWD_REF(Fp) f);
+            detail::make_future_deferred_shared_state(stop_token const& st, BOOST_THREAD_FWD_REF(Fp) f);
 
             typedef typename base_type::move_dest_type move_dest_type;
 
@@ -2004,8 +3003,11 @@ namespace boost
 
             BOOST_CONSTEXPR BOOST_THREAD_FUTURE() {}
             //BOOST_CONSTEXPR
-            BOOST_THREAD_FUTURE(exceptional_ptr const& ex):
-                base_type(ex) {}
+            BOOST_THREAD_FUTURE(exceptional_ptr const& ex)
+            {
+              if (ex.ptr_) this->ready_.set_exception(ex.ptr_);
+              else this->future_ = base_type::make_exceptional_future_ptr(ex);
+            }
 
             ~BOOST_THREAD_FUTURE() {
             }
@@ -2042,9 +3044,11 @@ namespace boost
               this->future_->set_deferred();
             }
             bool run_if_is_deferred() {
+              if (! this->future_) return false;
               return this->future_->run_if_is_deferred();
             }
             bool run_if_is_deferred_or_ready() {
+              if (! this->future_) return true;
               return this->future_->run_if_is_deferred_or_ready();
             }
             // retrieving the value
@@ -2052,7 +3056,15 @@ namespace boost
             {
                 if (this->future_.get() == 0)
                 {
-                    boost::throw_exception(future_uninitialized());
+                    if (this->ready_.empty())
+                    {
+                        boost::throw_exception(future_uninitialized());
+                    }
+#ifdef BOOST_THREAD_PROVIDES_FUTURE_INVALID_AFTER_GET
+                    return this->ready_.get(true);
+#else
+                    return this->ready_.get(false);
+#endif
                 }
                 unique_lock<boost::mutex> lk(this->future_->mutex);
                 if (! this->future_->valid(lk))
@@ -2068,7 +3080,22 @@ namespace boost
             {
                 if (this->future_.get() == 0)
                 {
-                    boost::throw_exception(future_uninitialized());
+                    if (this->ready_.empty())
+                    {
+                        boost::throw_exception(future_uninitialized());
+                    }
+                    if (this->ready_.has_value())
+                    {
+#ifdef BOOST_THREAD_PROVIDES_FUTURE_INVALID_AFTER_GET
+                        return this->ready_.get(true);
+#else
+                        return this->ready_.get(false);
+#endif
+                    }
+#ifdef BOOST_THREAD_PROVIDES_FUTURE_INVALID_AFTER_GET
+                    this->ready_.reset();
+#endif
+                    return boost::move(v);
                 }
                 unique_lock<boost::mutex> lk(this->future_->mutex);
                 if (! this->future_->valid(lk))
@@ -2087,7 +3114,22 @@ namespace boost
             {
                 if (this->future_.get() == 0)
                 {
-                    boost::throw_exception(future_uninitialized());
+                    if (this->ready_.empty())
+                    {
+                        boost::throw_exception(future_uninitialized());
+                    }
+                    if (this->ready_.has_value())
+                    {
+#ifdef BOOST_THREAD_PROVIDES_FUTURE_INVALID_AFTER_GET
+                        return this->ready_.get(true);
+#else
+                        return this->ready_.get(false);
+#endif
+                    }
+#ifdef BOOST_THREAD_PROVIDES_FUTURE_INVALID_AFTER_GET
+                    this->ready_.reset();
+#endif
+                    return v;
                 }
                 unique_lock<boost::mutex> lk(this->future_->mutex);
                 if (! this->future_->valid(lk))
@@ -2110,10 +3152,19 @@ namespace boost
             template<typename F>
             inline BOOST_THREAD_FUTURE<typename boost::result_of<F(BOOST_THREAD_FUTURE)>::type>
             then(launch policy, BOOST_THREAD_FWD_REF(F) func); // EXTENSION
+            template<typename F>
+            inline BOOST_THREAD_FUTURE<typename boost::result_of<F(BOOST_THREAD_FUTURE)>::type>
+            then(stop_token const& st, BOOST_THREAD_FWD_REF(F) func); // EXTENSION
+            template<typename F>
+            inline BOOST_THREAD_FUTURE<typename boost::result_of<F(BOOST_THREAD_FUTURE)>::type>
+            then(launch policy, stop_token const& st, BOOST_THREAD_FWD_REF(F) func); // EXTENSION
       #ifdef BOOST_THREAD_PROVIDES_EXECUTORS
             template<typename Ex, typename F>
-            inline BOOST_THREAD_FUTURE<typename boost::result_of<F(BOOST_THREAD_FUTURE)>::type>
+            inline typename detail::disable_if_stop_token<Ex, BOOST_THREAD_FUTURE<typename boost::result_of<F(BOOST_THREAD_FUTURE)>::type> >::type
             then(Ex &ex, BOOST_THREAD_FWD_REF(F) func); // EXTENSION
+            template<typename Ex, typename F>
+            inline BOOST_THREAD_FUTURE<typename boost::result_of<F(BOOST_THREAD_FUTURE)>::type>
+            then(Ex &ex, stop_token const& st, BOOST_THREAD_FWD_REF(F) func); // EXTENSION
       #endif
     #endif
 
@@ -2142,15 +3193,15 @@ namespace boost
 
         template <class F, class Rp, class Fp>
         friend BOOST_THREAD_FUTURE<Rp>
-        detail::make_future_async_continuation_shared_state(boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
+        detail::make_future_async_continuation_shared_state(stop_token const& st, boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
 
         template <class F, class Rp, class Fp>
         friend BOOST_THREAD_FUTURE<Rp>
-        detail::make_future_sync_continuation_shared_state(boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
+        detail::make_future_sync_continuation_shared_state(stop_token const& st, boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
 
         template <class F, class Rp, class Fp>
         friend BOOST_THREAD_FUTURE<Rp>
-        detail::make_future_deferred_continuation_shared_state(boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
+        detail::make_future_deferred_continuation_shared_state(stop_token const& st, boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
 #endif
 #if defined BOOST_THREAD_PROVIDES_SIGNATURE_PACKAGED_TASK
         template <class> friend class packaged_task;// todo check if this works in windows
@@ -2189,8 +3240,9 @@ namespace boost
         base_type(boost::move(static_cast<base_type&>(BOOST_THREAD_RV(other))))
         {
         }
+        // A future made ready without a shared state gets one, as copies of a shared_future share it.
         shared_future(BOOST_THREAD_RV_REF( BOOST_THREAD_FUTURE<R> ) other) BOOST_NOEXCEPT :
-        base_type(boost::move(static_cast<base_type&>(BOOST_THREAD_RV(other))))
+        base_type((BOOST_THREAD_RV(other).materialize(), boost::move(static_cast<base_type&>(BOOST_THREAD_RV(other)))))
         {
         }
 
@@ -2201,6 +3253,7 @@ namespace boost
         }
         shared_future& operator=(BOOST_THREAD_RV_REF( BOOST_THREAD_FUTURE<R> ) other) BOOST_NOEXCEPT
         {
+            BOOST_THREAD_RV(other).materialize();
             base_type::operator=(boost::move(static_cast<base_type&>(BOOST_THREAD_RV(other))));
             return *this;
         }
@@ -2245,10 +3298,19 @@ namespace boost
         template<typename F>
         inline BOOST_THREAD_FUTURE<typename boost::result_of<F(shared_future)>::type>
         then(launch policy, BOOST_THREAD_FWD_REF(F) func) const; // EXTENSION
+        template<typename F>
+        inline BOOST_THREAD_FUTURE<typename boost::result_of<F(shared_future)>::type>
+        then(stop_token const& st, BOOST_THREAD_FWD_REF(F) func) const; // EXTENSION
+        template<typename F>
+        inline BOOST_THREAD_FUTURE<typename boost::result_of<F(shared_future)>::type>
+        then(launch policy, stop_token const& st, BOOST_THREAD_FWD_REF(F) func) const; // EXTENSION
   #ifdef BOOST_THREAD_PROVIDES_EXECUTORS
         template<typename Ex, typename F>
-        inline BOOST_THREAD_FUTURE<typename boost::result_of<F(shared_future)>::type>
+        inline typename detail::disable_if_stop_token<Ex, BOOST_THREAD_FUTURE<typename boost::result_of<F(shared_future)>::type> >::type
         then(Ex& ex, BOOST_THREAD_FWD_REF(F) func) const; // EXTENSION
+        template<typename Ex, typename F>
+        inline BOOST_THREAD_FUTURE<typename boost::result_of<F(shared_future)>::type>
+        then(Ex& ex, stop_token const& st, BOOST_THREAD_FWD_REF(F) func) const; // EXTENSION
   #endif
 #endif
 
@@ -2260,6 +3322,7 @@ namespace boost
     class promise
     {
         typedef boost::shared_ptr<detail::shared_state<R> > future_ptr;
+        friend class promise_batch;
 
         typedef typename detail::shared_state<R>::source_reference_type source_reference_type;
         typedef typename detail::shared_state<R>::rvalue_source_type rvalue_source_type;
@@ -2556,6 +3619,7 @@ namespace boost
     class promise<R&>
     {
         typedef boost::shared_ptr<detail::shared_state<R&> > future_ptr;
+        friend class promise_batch;
 
         future_ptr future_;
         bool future_obtained;
@@ -2739,6 +3803,7 @@ namespace boost
     class promise<void>
     {
         typedef boost::shared_ptr<detail::shared_state<void> > future_ptr;
+        friend class promise_batch;
 
         future_ptr future_;
         bool future_obtained;
@@ -2920,6 +3985,127 @@ namespace boost
             future_->notify_deferred();
         }
     };
+
+    /**
+     * Satisfies several promises as a whole.
+     * Each result is published, and the waiters of its future woken up, as soon as it is set;
+     * the continuations attached to the futures are kept aside and launched together by flush(),
+     * the ones bound to the same executor being handed to it in a single bulk submission.
+     */
+    class promise_batch
+    {
+        detail::continuation_batch continuations_;
+
+        template <typename R>
+        static detail::shared_state<R>& shared_state_of(promise<R>& p)
+        {
+            p.lazy_init();
+            if (p.future_.get()==0)
+            {
+                boost::throw_exception(promise_moved());
+            }
+            return *p.future_;
+        }
+
+        // Must be called with the state lock: takes the continuations out so that marking the state finished does not launch them.
+        void collect_continuations(detail::shared_state_base& state, boost::unique_lock<boost::mutex>&)
+        {
+            if(state.done)
+            {
+                boost::throw_exception(promise_already_satisfied());
+            }
+            continuations_.collect(state.continuations);
+        }
+
+    public:
+        BOOST_THREAD_NO_COPYABLE(promise_batch)
+        promise_batch() {}
+
+        /**
+         * Launches the continuations not yet flushed. Exceptions thrown while submitting them are ignored;
+         * call flush() to observe them.
+         */
+        ~promise_batch()
+        {
+            try
+            {
+                flush();
+            }
+            catch (...)
+            {
+            }
+        }
+
+        template <typename R>
+        void set_value(promise<R>& p, typename detail::shared_state<R>::source_reference_type r)
+        {
+            detail::shared_state<R>& state = shared_state_of(p);
+            boost::unique_lock<boost::mutex> lock(state.mutex);
+            collect_continuations(state, lock);
+            state.mark_finished_with_result_internal(r, lock);
+        }
+
+        template <typename R>
+        void set_value(promise<R>& p, typename detail::shared_state<R>::rvalue_source_type r)
+        {
+            detail::shared_state<R>& state = shared_state_of(p);
+            boost::unique_lock<boost::mutex> lock(state.mutex);
+            collect_continuations(state, lock);
+#if ! defined  BOOST_NO_CXX11_RVALUE_REFERENCES
+            state.mark_finished_with_result_internal(boost::move(r), lock);
+#else
+            state.mark_finished_with_result_internal(static_cast<typename detail::shared_state<R>::rvalue_source_type>(r), lock);
+#endif
+        }
+
+        void set_value(promise<void>& p)
+        {
+            detail::shared_state<void>& state = shared_state_of(p);
+            boost::unique_lock<boost::mutex> lock(state.mutex);
+            collect_continuations(state, lock);
+            state.mark_finished_with_result_internal(lock);
+        }
+
+        template <typename R>
+        void set_exception(promise<R>& p, boost::exception_ptr e)
+        {
+            detail::shared_state<R>& state = shared_state_of(p);
+            boost::unique_lock<boost::mutex> lock(state.mutex);
+            collect_continuations(state, lock);
+            state.mark_exceptional_finish_internal(e, lock);
+        }
+        template <typename R, typename E>
+        void set_exception(promise<R>& p, E ex)
+        {
+            set_exception(p, boost::copy_exception(ex));
+        }
+
+        /**
+         * Launches the continuations of the promises satisfied since the last flush.
+         * Continuations bound to the same executor are submitted with a single \c submit_bulk call.
+         */
+        void flush()
+        {
+            continuations_.launch();
+        }
+    };
+
+    /**
+     * Sets the value of each promise in [first, last) from the corresponding element of the sequence starting at \c values,
+     * then launches the continuations of all of them as a single batch.
+     * Returns the iterator past the last value used.
+     */
+    template <typename PromiseIterator, typename InputIterator>
+    InputIterator set_values(PromiseIterator first, PromiseIterator last, InputIterator values)
+    {
+        promise_batch batch;
+        for (; first != last; ++first, ++values)
+        {
+            batch.set_value(*first, *values);
+        }
+        batch.flush();
+        return values;
+    }
 }
 #if defined BOOST_THREAD_PROVIDES_FUTURE_CTOR_ALLOCATORS
 namespace boost { namespace container {
@@ -2972,6 +4158,7 @@ namespace boost
               // todo The packaged_task::reset must be as if an assignemnt froma new packaged_task with the same function
               // the reset function is an optimization that avoids reallocating a new task.
               started=false;
+              this->started_=false;
               this->validate();
             }
 #if defined BOOST_THREAD_PROVIDES_SIGNATURE_PACKAGED_TASK && defined(BOOST_THREAD_PROVIDES_VARIADIC_THREAD)
@@ -2989,6 +4176,11 @@ namespace boost
                         boost::throw_exception(task_already_started());
                     }
                     started=true;
+                    if (! this->start_running(lk))
+                    {
+                        // cancelled by a stop request
+                        return;
+                    }
                 }
 #if defined BOOST_THREAD_PROVIDES_SIGNATURE_PACKAGED_TASK && defined(BOOST_THREAD_PROVIDES_VARIADIC_THREAD)
                 do_run(boost::move(args)...);
@@ -3012,6 +4204,11 @@ namespace boost
                         boost::throw_exception(task_already_started());
                     }
                     started=true;
+                    if (! this->start_running(lk))
+                    {
+                        // cancelled by a stop request
+                        return;
+                    }
                 }
 #if defined BOOST_THREAD_PROVIDES_SIGNATURE_PACKAGED_TASK && defined(BOOST_THREAD_PROVIDES_VARIADIC_THREAD)
                 do_apply(boost::move(args)...);
@@ -3807,6 +5004,14 @@ namespace boost
         void set_wait_callback(F f) {
             task->set_wait_callback(f,this);
         }
+
+        // cancellation
+        void set_stop_token(stop_token const& st) {
+            if(!task) {
+                boost::throw_exception(task_moved());
+            }
+            task->set_stop_token(st);
+        }
     };
 }
 #if defined BOOST_THREAD_PROVIDES_FUTURE_CTOR_ALLOCATORS
@@ -3835,9 +5040,10 @@ namespace detail
   ////////////////////////////////
   template <class Rp, class Fp>
   BOOST_THREAD_FUTURE<Rp>
-  make_future_deferred_shared_state(BOOST_THREAD_FWD_REF(Fp) f) {
+  make_future_deferred_shared_state(stop_token const& st, BOOST_THREAD_FWD_REF(Fp) f) {
     shared_ptr<future_deferred_shared_state<Rp, Fp> >
         h(new future_deferred_shared_state<Rp, Fp>(boost::forward<Fp>(f)));
+    h->set_stop_token(st);
     return BOOST_THREAD_FUTURE<Rp>(h);
   }
 
@@ -3846,10 +5052,14 @@ namespace detail
   ////////////////////////////////
   template <class Rp, class Fp>
   BOOST_THREAD_FUTURE<Rp>
-  make_future_async_shared_state(BOOST_THREAD_FWD_REF(Fp) f) {
+  make_future_async_shared_state(stop_token const& st, BOOST_THREAD_FWD_REF(Fp) f) {
     shared_ptr<future_async_shared_state<Rp, Fp> >
         h(new future_async_shared_state<Rp, Fp>());
-    h->init(boost::forward<Fp>(f));
+    h->set_stop_token(st);
+    if (! h->cancelled())
+    {
+      h->init(boost::forward<Fp>(f));
+    }
     return BOOST_THREAD_FUTURE<Rp>(h);
   }
 }
@@ -3870,14 +5080,14 @@ namespace detail
     typedef typename BF::result_type Rp;
 
     if (underlying_cast<int>(policy) & int(launch::async)) {
-      return BOOST_THREAD_MAKE_RV_REF(boost::detail::make_future_async_shared_state<Rp>(
+      return BOOST_THREAD_MAKE_RV_REF(boost::detail::make_future_async_shared_state<Rp>(stop_token(),
               BF(
                   f
                   , thread_detail::decay_copy(boost::forward<ArgTypes>(args))...
               )
           ));
     } else if (underlying_cast<int>(policy) & int(launch::deferred)) {
-      return BOOST_THREAD_MAKE_RV_REF(boost::detail::make_future_deferred_shared_state<Rp>(
+      return BOOST_THREAD_MAKE_RV_REF(boost::detail::make_future_deferred_shared_state<Rp>(stop_token(),
               BF(
                   f
                   , thread_detail::decay_copy(boost::forward<ArgTypes>(args))...
@@ -3931,14 +5141,14 @@ namespace detail
     typedef typename BF::result_type Rp;
 
     if (underlying_cast<int>(policy) & int(launch::async)) {
-      return BOOST_THREAD_MAKE_RV_REF(boost::detail::make_future_async_shared_state<Rp>(
+      return BOOST_THREAD_MAKE_RV_REF(boost::detail::make_future_async_shared_state<Rp>(stop_token(),
               BF(
                   thread_detail::decay_copy(boost::forward<F>(f))
                 , thread_detail::decay_copy(boost::forward<ArgTypes>(args))...
               )
           ));
     } else if (underlying_cast<int>(policy) & int(launch::deferred)) {
-      return BOOST_THREAD_MAKE_RV_REF(boost::detail::make_future_deferred_shared_state<Rp>(
+      return BOOST_THREAD_MAKE_RV_REF(boost::detail::make_future_deferred_shared_state<Rp>(stop_token(),
               BF(
                   thread_detail::decay_copy(boost::forward<F>(f))
                 , thread_detail::decay_copy(boost::forward<ArgTypes>(args))...
@@ -3951,12 +5161,45 @@ namespace detail
     }
   }
 
-#else // defined(BOOST_THREAD_PROVIDES_VARIADIC_THREAD)
-
-  template <class F>
-  BOOST_THREAD_FUTURE<typename boost::result_of<typename decay<F>::type()>::type>
-  async(launch policy, BOOST_THREAD_FWD_REF(F) f) {
-    typedef typename boost::result_of<typename decay<F>::type()>::type R;
+  ////////////////////////////////
+  // template <class F, class... ArgTypes>
+  // future<R> async(launch policy, stop_token const& st, F&&, ArgTypes&&...);
+  ////////////////////////////////
+  template <class F, class ...ArgTypes>
+  BOOST_THREAD_FUTURE<typename boost::result_of<typename decay<F>::type(
+      typename decay<ArgTypes>::type...
+  )>::type>
+  async(launch policy, stop_token const& st, BOOST_THREAD_FWD_REF(F) f, BOOST_THREAD_FWD_REF(ArgTypes)... args) {
+    typedef detail::invoker<typename decay<F>::type, typename decay<ArgTypes>::type...> BF;
+    typedef typename BF::result_type Rp;
+
+    if (underlying_cast<int>(policy) & int(launch::async)) {
+      return BOOST_THREAD_MAKE_RV_REF(boost::detail::make_future_async_shared_state<Rp>(st,
+              BF(
+                  thread_detail::decay_copy(boost::forward<F>(f))
+                , thread_detail::decay_copy(boost::forward<ArgTypes>(args))...
+              )
+          ));
+    } else if (underlying_cast<int>(policy) & int(launch::deferred)) {
+      return BOOST_THREAD_MAKE_RV_REF(boost::detail::make_future_deferred_shared_state<Rp>(st,
+              BF(
+                  thread_detail::decay_copy(boost::forward<F>(f))
+                , thread_detail::decay_copy(boost::forward<ArgTypes>(args))...
+              )
+          ));
+    } else {
+      std::terminate();
+      //BOOST_THREAD_FUTURE<R> ret;
+      //return ::boost::move(ret);
+    }
+  }
+
+#else // defined(BOOST_THREAD_PROVIDES_VARIADIC_THREAD)
+
+  template <class F>
+  BOOST_THREAD_FUTURE<typename boost::result_of<typename decay<F>::type()>::type>
+  async(launch policy, BOOST_THREAD_FWD_REF(F) f) {
+    typedef typename boost::result_of<typename decay<F>::type()>::type R;
 #if defined BOOST_THREAD_PROVIDES_SIGNATURE_PACKAGED_TASK
     typedef packaged_task<R()> packaged_task_type;
 #else // defined BOOST_THREAD_PROVIDES_SIGNATURE_PACKAGED_TASK
@@ -3984,6 +5227,28 @@ namespace detail
       //return ::boost::move(ret);
     }
   }
+
+  template <class F>
+  BOOST_THREAD_FUTURE<typename boost::result_of<typename decay<F>::type()>::type>
+  async(launch policy, stop_token const& st, BOOST_THREAD_FWD_REF(F) f) {
+    typedef typename boost::result_of<typename decay<F>::type()>::type R;
+#if defined BOOST_THREAD_PROVIDES_SIGNATURE_PACKAGED_TASK
+    typedef packaged_task<R()> packaged_task_type;
+#else // defined BOOST_THREAD_PROVIDES_SIGNATURE_PACKAGED_TASK
+    typedef packaged_task<R> packaged_task_type;
+#endif // defined BOOST_THREAD_PROVIDES_SIGNATURE_PACKAGED_TASK
+
+    if (underlying_cast<int>(policy) & int(launch::async)) {
+      packaged_task_type pt( boost::forward<F>(f) );
+      pt.set_stop_token(st);
+      BOOST_THREAD_FUTURE<R> ret = pt.get_future();
+      ret.set_async();
+      boost::thread( boost::move(pt) ).detach();
+      return ::boost::move(ret);
+    } else {
+      std::terminate();
+    }
+  }
 #endif // defined(BOOST_THREAD_PROVIDES_VARIADIC_THREAD)
 
 #ifdef BOOST_THREAD_PROVIDES_EXECUTORS
@@ -4035,12 +5300,21 @@ namespace detail {
       }
 #endif
       void operator()() {
+        if (! that->start_running()) {
+          return;
+        }
+#if defined BOOST_THREAD_PROVIDES_CONTINUATION_FUSION
+        continuation_fusion_scope scope(that->get_executor());
+#endif
         shared_ptr<shared_state<Rp> > that_ = static_pointer_cast<shared_state<Rp> >(that);
         try {
           that_->mark_finished_with_result(f_());
         } catch(...) {
           that_->mark_exceptional_finish();
         }
+#if defined BOOST_THREAD_PROVIDES_CONTINUATION_FUSION
+        scope.run_pending();
+#endif
       }
       ~shared_state_nullary_task()
       {
@@ -4087,6 +5361,12 @@ namespace detail {
       }
 #endif
       void operator()() {
+        if (! that->start_running()) {
+          return;
+        }
+#if defined BOOST_THREAD_PROVIDES_CONTINUATION_FUSION
+        continuation_fusion_scope scope(that->get_executor());
+#endif
         shared_ptr<shared_state<void> > that_ = static_pointer_cast<shared_state<void> >(that);
         try {
           f_();
@@ -4094,6 +5374,9 @@ namespace detail {
         } catch(...) {
           that_->mark_exceptional_finish();
         }
+#if defined BOOST_THREAD_PROVIDES_CONTINUATION_FUSION
+        scope.run_pending();
+#endif
       }
     };
 
@@ -4114,10 +5397,15 @@ namespace detail {
       }
 
       template <class Fp, class Executor>
-      void init(Executor& ex, BOOST_THREAD_FWD_REF(Fp) f)
+      void init(Executor& ex, stop_token const& st, BOOST_THREAD_FWD_REF(Fp) f)
       {
         typedef typename decay<Fp>::type Cont;
         this->set_executor_policy(executor_ptr_type(new executor_ref<Executor>(ex)));
+        this->set_stop_token(st);
+        if (this->cancelled())
+        {
+          return;
+        }
         shared_state_nullary_task<Rp,Cont> t(this->shared_from_this(), boost::forward<Fp>(f));
         ex.submit(boost::move(t));
       }
@@ -4128,12 +5416,130 @@ namespace detail {
     ////////////////////////////////
     // make_future_executor_shared_state
     ////////////////////////////////
+#if defined BOOST_THREAD_PROVIDES_HELP_WHILE_WAITING
+    /////////////////////////
+    /// future_executor_task_shared_state
+    /////////////////////////
+    // The state keeps the task and the submitted closure only refers to the state, so that a worker of the executor
+    // waiting for the result runs the task itself if no worker has started it yet.
+    template<typename Rp, typename Fp>
+    struct future_executor_task_shared_state: future_executor_shared_state<Rp>
+    {
+      Fp f_;
+
+      struct job
+      {
+        shared_ptr<future_executor_task_shared_state> that_;
+
+        void operator()()
+        {
+          that_->run_pending_work();
+        }
+      };
+
+      template <class F>
+      explicit future_executor_task_shared_state(BOOST_THREAD_FWD_REF(F) f) : f_(boost::forward<F>(f))
+      {
+      }
+
+      template <class Executor>
+      void init(Executor& ex, stop_token const& st)
+      {
+        this->set_executor_policy(executor_ptr_type(new executor_ref<Executor>(ex)));
+        this->set_stop_token(st);
+        if (this->cancelled())
+        {
+          return;
+        }
+        job j = {static_shared_from_this(this)};
+        ex.submit(boost::move(j));
+      }
+
+      void run_pending_work()
+      {
+        if (! this->start_running()) {
+          return;
+        }
+#if defined BOOST_THREAD_PROVIDES_CONTINUATION_FUSION
+        continuation_fusion_scope scope(this->get_executor());
+#endif
+        try {
+          this->mark_finished_with_result(f_());
+        } catch(...) {
+          this->mark_exceptional_finish();
+        }
+#if defined BOOST_THREAD_PROVIDES_CONTINUATION_FUSION
+        scope.run_pending();
+#endif
+      }
+    };
+
+    template<typename Fp>
+    struct future_executor_task_shared_state<void, Fp>: future_executor_shared_state<void>
+    {
+      Fp f_;
+
+      struct job
+      {
+        shared_ptr<future_executor_task_shared_state> that_;
+
+        void operator()()
+        {
+          that_->run_pending_work();
+        }
+      };
+
+      template <class F>
+      explicit future_executor_task_shared_state(BOOST_THREAD_FWD_REF(F) f) : f_(boost::forward<F>(f))
+      {
+      }
+
+      template <class Executor>
+      void init(Executor& ex, stop_token const& st)
+      {
+        this->set_executor_policy(executor_ptr_type(new executor_ref<Executor>(ex)));
+        this->set_stop_token(st);
+        if (this->cancelled())
+        {
+          return;
+        }
+        job j = {static_shared_from_this(this)};
+        ex.submit(boost::move(j));
+      }
+
+      void run_pending_work()
+      {
+        if (! this->start_running()) {
+          return;
+        }
+#if defined BOOST_THREAD_PROVIDES_CONTINUATION_FUSION
+        continuation_fusion_scope scope(this->get_executor());
+#endif
+        try {
+          f_();
+          this->mark_finished_with_result();
+        } catch(...) {
+          this->mark_exceptional_finish();
+        }
+#if defined BOOST_THREAD_PROVIDES_CONTINUATION_FUSION
+        scope.run_pending();
+#endif
+      }
+    };
+#endif
+
     template <class Rp, class Fp, class Executor>
     BOOST_THREAD_FUTURE<Rp>
-    make_future_executor_shared_state(Executor& ex, BOOST_THREAD_FWD_REF(Fp) f) {
+    make_future_executor_shared_state(Executor& ex, stop_token const& st, BOOST_THREAD_FWD_REF(Fp) f) {
+#if defined BOOST_THREAD_PROVIDES_HELP_WHILE_WAITING
+      typedef future_executor_task_shared_state<Rp, typename decay<Fp>::type> State;
+      shared_ptr<State> h(new State(boost::forward<Fp>(f)));
+      h->init(ex, st);
+#else
       shared_ptr<future_executor_shared_state<Rp> >
           h(new future_executor_shared_state<Rp>());
-      h->init(ex, boost::forward<Fp>(f));
+      h->init(ex, st, boost::forward<Fp>(f));
+#endif
       return BOOST_THREAD_FUTURE<Rp>(h);
     }
 
@@ -4156,7 +5562,7 @@ namespace detail {
     typedef detail::invoker<typename decay<F>::type, typename decay<ArgTypes>::type...> BF;
     typedef typename BF::result_type Rp;
 
-    return BOOST_THREAD_MAKE_RV_REF(boost::detail::make_future_executor_shared_state<Rp>(ex,
+    return BOOST_THREAD_MAKE_RV_REF(boost::detail::make_future_executor_shared_state<Rp>(ex, stop_token(),
         BF(
             f
             , thread_detail::decay_copy(boost::forward<ArgTypes>(args))...
@@ -4173,7 +5579,27 @@ namespace detail {
     typedef detail::invoker<typename decay<F>::type, typename decay<ArgTypes>::type...> BF;
     typedef typename BF::result_type Rp;
 
-    return BOOST_THREAD_MAKE_RV_REF(boost::detail::make_future_executor_shared_state<Rp>(ex,
+    return BOOST_THREAD_MAKE_RV_REF(boost::detail::make_future_executor_shared_state<Rp>(ex, stop_token(),
+        BF(
+            thread_detail::decay_copy(boost::forward<F>(f))
+            , thread_detail::decay_copy(boost::forward<ArgTypes>(args))...
+        )
+    ));
+  }
+
+  ////////////////////////////////
+  // template <class Executor, class F, class... ArgTypes>
+  // future<R> async(Executor& ex, stop_token const& st, F&&, ArgTypes&&...);
+  ////////////////////////////////
+  template <class Executor, class F, class ...ArgTypes>
+  BOOST_THREAD_FUTURE<typename boost::result_of<typename decay<F>::type(
+      typename decay<ArgTypes>::type...
+  )>::type>
+  async(Executor& ex, stop_token const& st, BOOST_THREAD_FWD_REF(F) f, BOOST_THREAD_FWD_REF(ArgTypes)... args) {
+    typedef detail::invoker<typename decay<F>::type, typename decay<ArgTypes>::type...> BF;
+    typedef typename BF::result_type Rp;
+
+    return BOOST_THREAD_MAKE_RV_REF(boost::detail::make_future_executor_shared_state<Rp>(ex, st,
         BF(
             thread_detail::decay_copy(boost::forward<F>(f))
             , thread_detail::decay_copy(boost::forward<ArgTypes>(args))...
@@ -4191,76 +5617,428 @@ namespace detail {
     typedef detail::invoker<F> BF;
     typedef typename BF::result_type Rp;
 
-    return BOOST_THREAD_MAKE_RV_REF(boost::detail::make_future_executor_shared_state<Rp>(ex,
+    return BOOST_THREAD_MAKE_RV_REF(boost::detail::make_future_executor_shared_state<Rp>(ex, stop_token(),
         BF(
             f
         )
     ));
   }
 
-  template <class Executor, class R, class A1>
-  BOOST_THREAD_FUTURE<R>
-  async(Executor& ex, R(*f)(BOOST_THREAD_FWD_REF(A1)), BOOST_THREAD_FWD_REF(A1) a1) {
-    typedef R(*F)(BOOST_THREAD_FWD_REF(A1));
-    typedef detail::invoker<F, typename decay<A1>::type> BF;
-    typedef typename BF::result_type Rp;
+  template <class Executor, class R, class A1>
+  BOOST_THREAD_FUTURE<R>
+  async(Executor& ex, R(*f)(BOOST_THREAD_FWD_REF(A1)), BOOST_THREAD_FWD_REF(A1) a1) {
+    typedef R(*F)(BOOST_THREAD_FWD_REF(A1));
+    typedef detail::invoker<F, typename decay<A1>::type> BF;
+    typedef typename BF::result_type Rp;
+
+    return BOOST_THREAD_MAKE_RV_REF(boost::detail::make_future_executor_shared_state<Rp>(ex, stop_token(),
+        BF(
+            f
+            , thread_detail::decay_copy(boost::forward<A1>(a1))
+        )
+    ));
+  }
+#endif // defined BOOST_THREAD_RVALUE_REFERENCES_DONT_MATCH_FUNCTION_PTR
+
+  template <class Executor, class F>
+  BOOST_THREAD_FUTURE<typename boost::result_of<typename decay<F>::type()>::type>
+  async(Executor& ex, BOOST_THREAD_FWD_REF(F) f)  {
+    typedef detail::invoker<typename decay<F>::type> BF;
+    typedef typename BF::result_type Rp;
+
+    return boost::detail::make_future_executor_shared_state<Rp>(ex, stop_token(),
+        BF(
+            thread_detail::decay_copy(boost::forward<F>(f))
+        )
+    );
+  }
+
+  template <class Executor, class F, class A1>
+  BOOST_THREAD_FUTURE<typename boost::result_of<typename decay<F>::type(
+      typename decay<A1>::type
+  )>::type>
+  async(Executor& ex, BOOST_THREAD_FWD_REF(F) f, BOOST_THREAD_FWD_REF(A1) a1) {
+    typedef detail::invoker<typename decay<F>::type, typename decay<A1>::type> BF;
+    typedef typename BF::result_type Rp;
+
+    return BOOST_THREAD_MAKE_RV_REF(boost::detail::make_future_executor_shared_state<Rp>(ex, stop_token(),
+        BF(
+            thread_detail::decay_copy(boost::forward<F>(f))
+          , thread_detail::decay_copy(boost::forward<A1>(a1))
+        )
+    ));
+  }
+
+  template <class Executor, class F, class A1, class A2>
+  BOOST_THREAD_FUTURE<typename boost::result_of<typename decay<F>::type(
+      typename decay<A1>::type, typename decay<A2>::type
+  )>::type>
+  async(Executor& ex, BOOST_THREAD_FWD_REF(F) f, BOOST_THREAD_FWD_REF(A1) a1, BOOST_THREAD_FWD_REF(A2) a2) {
+    typedef detail::invoker<typename decay<F>::type, typename decay<A1>::type, typename decay<A2>::type> BF;
+    typedef typename BF::result_type Rp;
+
+    return BOOST_THREAD_MAKE_RV_REF(boost::detail::make_future_executor_shared_state<Rp>(ex, stop_token(),
+        BF(
+            thread_detail::decay_copy(boost::forward<F>(f))
+          , thread_detail::decay_copy(boost::forward<A1>(a1))
+          , thread_detail::decay_copy(boost::forward<A2>(a2))
+        )
+    ));
+  }
+
+  ////////////////////////////////
+  // template <class Executor, class F, class... ArgTypes>
+  // future<R> async(Executor& ex, stop_token const& st, F&&, ArgTypes&&...);
+  ////////////////////////////////
+  template <class Executor, class F>
+  BOOST_THREAD_FUTURE<typename boost::result_of<typename decay<F>::type()>::type>
+  async(Executor& ex, stop_token const& st, BOOST_THREAD_FWD_REF(F) f)  {
+    typedef detail::invoker<typename decay<F>::type> BF;
+    typedef typename BF::result_type Rp;
+
+    return BOOST_THREAD_MAKE_RV_REF(boost::detail::make_future_executor_shared_state<Rp>(ex, st,
+        BF(
+            thread_detail::decay_copy(boost::forward<F>(f))
+        )
+    ));
+  }
+
+  template <class Executor, class F, class A1>
+  BOOST_THREAD_FUTURE<typename boost::result_of<typename decay<F>::type(
+      typename decay<A1>::type
+  )>::type>
+  async(Executor& ex, stop_token const& st, BOOST_THREAD_FWD_REF(F) f, BOOST_THREAD_FWD_REF(A1) a1) {
+    typedef detail::invoker<typename decay<F>::type, typename decay<A1>::type> BF;
+    typedef typename BF::result_type Rp;
+
+    return BOOST_THREAD_MAKE_RV_REF(boost::detail::make_future_executor_shared_state<Rp>(ex, st,
+        BF(
+            thread_detail::decay_copy(boost::forward<F>(f))
+          , thread_detail::decay_copy(boost::forward<A1>(a1))
+        )
+    ));
+  }
+
+  template <class Executor, class F, class A1, class A2>
+  BOOST_THREAD_FUTURE<typename boost::result_of<typename decay<F>::type(
+      typename decay<A1>::type, typename decay<A2>::type
+  )>::type>
+  async(Executor& ex, stop_token const& st, BOOST_THREAD_FWD_REF(F) f, BOOST_THREAD_FWD_REF(A1) a1, BOOST_THREAD_FWD_REF(A2) a2) {
+    typedef detail::invoker<typename decay<F>::type, typename decay<A1>::type, typename decay<A2>::type> BF;
+    typedef typename BF::result_type Rp;
+
+    return BOOST_THREAD_MAKE_RV_REF(boost::detail::make_future_executor_shared_state<Rp>(ex, st,
+        BF(
+            thread_detail::decay_copy(boost::forward<F>(f))
+          , thread_detail::decay_copy(boost::forward<A1>(a1))
+          , thread_detail::decay_copy(boost::forward<A2>(a2))
+        )
+    ));
+  }
+
+#endif //! defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+  ////////////////////////////////
+  // template <class Executor, class F>
+  // future<vector<R>> async_bulk(Executor& ex, std::size_t n, F&& f);
+  ////////////////////////////////
+namespace detail {
+
+    template <class Rp>
+    struct bulk_result
+    {
+      typedef csbl::vector<Rp> type;
+    };
+    template <>
+    struct bulk_result<void>
+    {
+      typedef void type;
+    };
+
+    /////////////////////////
+    /// bulk_countdown
+    /////////////////////////
+    // The jobs submitted by async_bulk() claim chunks of indices, smaller as the remaining work shrinks, and count the
+    // completed indices down. The job completing the last chunk makes the shared state ready.
+    template <class Rt>
+    struct bulk_countdown: shared_state<Rt>
+    {
+      std::size_t size_;
+      std::size_t width_;
+      atomic<std::size_t> next_;
+      atomic<std::size_t> remaining_;
+      atomic<bool> failed_;
+      exception_ptr exception_;
+
+      bulk_countdown(std::size_t n, std::size_t width)
+      : size_(n), width_(width), next_(0), remaining_(n), failed_(false)
+      {
+      }
+
+      // Returns: false once every index has been claimed.
+      bool claim(std::size_t& first, std::size_t& last)
+      {
+        std::size_t n = next_.load(memory_order_relaxed);
+        std::size_t chunk;
+        do
+        {
+          if (n >= size_) return false;
+          chunk = (size_ - n) / (2 * width_);
+          if (chunk == 0) chunk = 1;
+        } while (! next_.compare_exchange_weak(n, n + chunk, memory_order_relaxed));
+        first = n;
+        last = n + chunk;
+        return true;
+      }
+
+      bool failed() const
+      {
+        return failed_.load(memory_order_relaxed);
+      }
+
+      // Must be called from a catch block. The first exception is kept, the remaining indices are skipped.
+      void fail()
+      {
+        if (! failed_.exchange(true, memory_order_relaxed))
+        {
+          exception_ = current_exception();
+        }
+      }
+
+      // Returns: whether the calling job has completed the last indices.
+      bool count_down(std::size_t done)
+      {
+        return remaining_.fetch_sub(done, memory_order_acq_rel) == done;
+      }
+
+      void mark_failed()
+      {
+        boost::unique_lock<boost::mutex> lk(this->mutex);
+        this->mark_exceptional_finish_internal(exception_, lk);
+      }
+    };
+
+    // Results written concurrently by the jobs of async_bulk(), each one at its index.
+    template <class Rp>
+    struct bulk_results
+    {
+      csbl::vector<Rp> values_;
+
+      explicit bulk_results(std::size_t n) : values_(n) {}
+      Rp& operator[](std::size_t i) { return values_[i]; }
+      csbl::vector<Rp> release() { return boost::move(values_); }
+    };
+    // The elements of a vector<bool> share words, so the jobs write the results in an array of bool, copied once
+    // they are all there.
+    template <>
+    struct bulk_results<bool>
+    {
+      scoped_array<bool> values_;
+      std::size_t size_;
+
+      explicit bulk_results(std::size_t n) : values_(new bool[n]()), size_(n) {}
+      bool& operator[](std::size_t i) { return values_[i]; }
+      csbl::vector<bool> release() { return csbl::vector<bool>(values_.get(), values_.get() + size_); }
+    };
+
+    template <class Rp, class Fp>
+    struct future_bulk_shared_state: bulk_countdown<csbl::vector<Rp> >
+    {
+      typedef bulk_countdown<csbl::vector<Rp> > base_type;
+      Fp f_;
+      bulk_results<Rp> results_;
+
+      future_bulk_shared_state(std::size_t n, std::size_t width, BOOST_THREAD_FWD_REF(Fp) f)
+      : base_type(n, width), f_(boost::move(f)), results_(n)
+      {
+      }
+
+      void complete()
+      {
+        if (this->failed()) this->mark_failed();
+        else this->mark_finished_with_result(results_.release());
+      }
+
+#if defined BOOST_THREAD_PROVIDES_HELP_WHILE_WAITING
+      // A waiting worker claims the remaining indices as the submitted closures do.
+      void run_pending_work()
+      {
+        run();
+      }
+#endif
+
+      void run()
+      {
+        std::size_t first, last;
+        while (this->claim(first, last))
+        {
+          if (! this->failed())
+          {
+            try
+            {
+              for (std::size_t i = first; i < last; ++i)
+              {
+                results_[i] = f_(i);
+              }
+            }
+            catch (...)
+            {
+              this->fail();
+            }
+          }
+          if (this->count_down(last - first)) complete();
+        }
+      }
+    };
+
+    template <class Fp>
+    struct future_bulk_shared_state<void, Fp>: bulk_countdown<void>
+    {
+      typedef bulk_countdown<void> base_type;
+      Fp f_;
+
+      future_bulk_shared_state(std::size_t n, std::size_t width, BOOST_THREAD_FWD_REF(Fp) f)
+      : base_type(n, width), f_(boost::move(f))
+      {
+      }
+
+      void complete()
+      {
+        if (this->failed()) this->mark_failed();
+        else this->mark_finished_with_result();
+      }
+
+#if defined BOOST_THREAD_PROVIDES_HELP_WHILE_WAITING
+      // A waiting worker claims the remaining indices as the submitted closures do.
+      void run_pending_work()
+      {
+        run();
+      }
+#endif
+
+      void run()
+      {
+        std::size_t first, last;
+        while (this->claim(first, last))
+        {
+          if (! this->failed())
+          {
+            try
+            {
+              for (std::size_t i = first; i < last; ++i)
+              {
+                f_(i);
+              }
+            }
+            catch (...)
+            {
+              this->fail();
+            }
+          }
+          if (this->count_down(last - first)) complete();
+        }
+      }
+    };
+
+    template <class State>
+    struct bulk_job
+    {
+      shared_ptr<State> state_;
 
-    return BOOST_THREAD_MAKE_RV_REF(boost::detail::make_future_executor_shared_state<Rp>(ex,
-        BF(
-            f
-            , thread_detail::decay_copy(boost::forward<A1>(a1))
-        )
-    ));
-  }
-#endif // defined BOOST_THREAD_RVALUE_REFERENCES_DONT_MATCH_FUNCTION_PTR
+      explicit bulk_job(shared_ptr<State> const& st) : state_(st) {}
 
-  template <class Executor, class F>
-  BOOST_THREAD_FUTURE<typename boost::result_of<typename decay<F>::type()>::type>
-  async(Executor& ex, BOOST_THREAD_FWD_REF(F) f)  {
-    typedef detail::invoker<typename decay<F>::type> BF;
-    typedef typename BF::result_type Rp;
+      void operator()()
+      {
+        state_->run();
+      }
+    };
 
-    return boost::detail::make_future_executor_shared_state<Rp>(ex,
-        BF(
-            thread_detail::decay_copy(boost::forward<F>(f))
-        )
-    );
-  }
+    ////////////////////////////////
+    // make_future_bulk_shared_state
+    ////////////////////////////////
+    template <class Rt, class State, class Executor>
+    BOOST_THREAD_FUTURE<Rt>
+    make_future_bulk_shared_state(Executor& ex, shared_ptr<State> const& h) {
+      h->set_executor_policy(executor_ptr_type(new executor_ref<Executor>(ex)));
+      if (h->size_ == 0)
+      {
+        h->complete();
+        return BOOST_THREAD_FUTURE<Rt>(h);
+      }
+      csbl::vector<executors::work> jobs;
+      jobs.reserve(h->width_);
+      for (std::size_t i = 0; i < h->width_; ++i)
+      {
+        jobs.push_back(executors::work(bulk_job<State>(h)));
+      }
+      executors::detail::submit_bulk_to(ex, &jobs[0], &jobs[0] + jobs.size());
+      return BOOST_THREAD_FUTURE<Rt>(h);
+    }
 
-  template <class Executor, class F, class A1>
-  BOOST_THREAD_FUTURE<typename boost::result_of<typename decay<F>::type(
-      typename decay<A1>::type
-  )>::type>
-  async(Executor& ex, BOOST_THREAD_FWD_REF(F) f, BOOST_THREAD_FWD_REF(A1) a1) {
-    typedef detail::invoker<typename decay<F>::type, typename decay<A1>::type> BF;
-    typedef typename BF::result_type Rp;
+    inline std::size_t bulk_width(std::size_t n)
+    {
+      std::size_t width = boost::thread::hardware_concurrency();
+      if (width == 0) width = 1;
+      return n < width ? n : width;
+    }
 
-    return BOOST_THREAD_MAKE_RV_REF(boost::detail::make_future_executor_shared_state<Rp>(ex,
-        BF(
-            thread_detail::decay_copy(boost::forward<F>(f))
-          , thread_detail::decay_copy(boost::forward<A1>(a1))
-        )
-    ));
-  }
+    template <class RandomAccessIterator, class Fp>
+    struct bulk_range_invoker
+    {
+      typedef typename boost::result_of<Fp(typename std::iterator_traits<RandomAccessIterator>::reference)>::type result_type;
 
-  template <class Executor, class F, class A1, class A2>
-  BOOST_THREAD_FUTURE<typename boost::result_of<typename decay<F>::type(
-      typename decay<A1>::type, typename decay<A2>::type
-  )>::type>
-  async(Executor& ex, BOOST_THREAD_FWD_REF(F) f, BOOST_THREAD_FWD_REF(A1) a1, BOOST_THREAD_FWD_REF(A2) a2) {
-    typedef detail::invoker<typename decay<F>::type, typename decay<A1>::type, typename decay<A2>::type> BF;
-    typedef typename BF::result_type Rp;
+      RandomAccessIterator first_;
+      Fp f_;
 
-    return BOOST_THREAD_MAKE_RV_REF(boost::detail::make_future_executor_shared_state<Rp>(ex,
-        BF(
-            thread_detail::decay_copy(boost::forward<F>(f))
-          , thread_detail::decay_copy(boost::forward<A1>(a1))
-          , thread_detail::decay_copy(boost::forward<A2>(a2))
-        )
-    ));
+      bulk_range_invoker(RandomAccessIterator first, BOOST_THREAD_FWD_REF(Fp) f)
+      : first_(first), f_(boost::move(f))
+      {
+      }
+
+      result_type operator()(std::size_t i)
+      {
+        return f_(first_[i]);
+      }
+    };
+} // detail
+
+  /**
+   * \par Effects
+   * Calls f(i) for each i in [0, n) on the threads of execution of ex. The indices are claimed in chunks by at most
+   * hardware_concurrency() closures submitted at once, so that the shared state is the only allocation whatever n.
+   * f is called concurrently and must be safe to do so.
+   * \par Returns
+   * A future ready when every call has returned, holding the results in index order if f returns a value.
+   * If some call throws, the remaining indices are skipped and the future holds the first exception caught.
+   * \par Requires
+   * The result type of f, if not void, must be DefaultConstructible and MoveAssignable.
+   */
+  template <class Executor, class F>
+  BOOST_THREAD_FUTURE<typename detail::bulk_result<
+      typename boost::result_of<typename decay<F>::type(std::size_t)>::type
+  >::type>
+  async_bulk(Executor& ex, std::size_t n, BOOST_THREAD_FWD_REF(F) f) {
+    typedef typename decay<F>::type Fp;
+    typedef typename boost::result_of<Fp(std::size_t)>::type Rp;
+    typedef detail::future_bulk_shared_state<Rp, Fp> State;
+
+    shared_ptr<State> h(new State(n, detail::bulk_width(n), thread_detail::decay_copy(boost::forward<F>(f))));
+    return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_bulk_shared_state<typename detail::bulk_result<Rp>::type>(ex, h)));
   }
 
-#endif //! defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+  /**
+   * \par Effects
+   * As async_bulk(ex, last - first, g), where g(i) calls f(first[i]).
+   */
+  template <class Executor, class RandomAccessIterator, class F>
+  BOOST_THREAD_FUTURE<typename detail::bulk_result<
+      typename detail::bulk_range_invoker<RandomAccessIterator, typename decay<F>::type>::result_type
+  >::type>
+  async_bulk(Executor& ex, RandomAccessIterator first, RandomAccessIterator last, BOOST_THREAD_FWD_REF(F) f) {
+    typedef detail::bulk_range_invoker<RandomAccessIterator, typename decay<F>::type> Invoker;
+    return async_bulk(ex, static_cast<std::size_t>(last - first),
+        Invoker(first, thread_detail::decay_copy(boost::forward<F>(f))));
+  }
 #endif
 
   ////////////////////////////////
@@ -4362,26 +6140,26 @@ namespace detail {
 #endif
   BOOST_THREAD_FUTURE<typename detail::deduced_type<T>::type> make_ready_future(BOOST_THREAD_FWD_REF(T) value) {
     typedef typename detail::deduced_type<T>::type future_value_type;
-    promise<future_value_type> p;
-    p.set_value(boost::forward<T>(value));
-    return BOOST_THREAD_MAKE_RV_REF(p.get_future());
+    BOOST_THREAD_FUTURE<future_value_type> f;
+    f.ready_.set_value(boost::forward<T>(value));
+    return BOOST_THREAD_MAKE_RV_REF(f);
   }
 
   // explicit overloads
   template <class T>
   BOOST_THREAD_FUTURE<T> make_ready_future(typename remove_reference<T>::type & x)
   {
-    promise<T> p;
-    p.set_value(x);
-    return p.get_future();
+    BOOST_THREAD_FUTURE<T> f;
+    f.ready_.set_value(x);
+    return BOOST_THREAD_MAKE_RV_REF(f);
   }
 
   template <class T>
   BOOST_THREAD_FUTURE<T> make_ready_future(BOOST_THREAD_FWD_REF(typename remove_reference<T>::type) x)
   {
-    promise<T> p;
-    p.set_value(forward<typename remove_reference<T>::type>(x));
-    return p.get_future();
+    BOOST_THREAD_FUTURE<T> f;
+    f.ready_.set_value(forward<typename remove_reference<T>::type>(x));
+    return BOOST_THREAD_MAKE_RV_REF(f);
   }
 
   // variadic overload
@@ -4389,49 +6167,47 @@ namespace detail {
   template <class T, class ...Args>
   BOOST_THREAD_FUTURE<T> make_ready_future(Args&&... args)
   {
-    promise<T> p;
-    p.emplace(forward<Args>(args)...);
-    return p.get_future();
-
+    BOOST_THREAD_FUTURE<T> f;
+    f.ready_.set_value(forward<Args>(args)...);
+    return BOOST_THREAD_MAKE_RV_REF(f);
   }
 #endif
 
   template <typename T, typename T1>
   BOOST_THREAD_FUTURE<T> make_ready_no_decay_future(T1 value) {
-    typedef T future_value_type;
-    promise<future_value_type> p;
-    p.set_value(value);
-    return BOOST_THREAD_MAKE_RV_REF(p.get_future());
+    BOOST_THREAD_FUTURE<T> f;
+    f.ready_.set_value(value);
+    return BOOST_THREAD_MAKE_RV_REF(f);
   }
 
 #if ! defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) || defined BOOST_THREAD_USES_MOVE
   inline BOOST_THREAD_FUTURE<void> make_ready_future() {
-    promise<void> p;
-    p.set_value();
-    return p.get_future();
+    BOOST_THREAD_FUTURE<void> f;
+    f.ready_.set_value();
+    return BOOST_THREAD_MAKE_RV_REF(f);
   }
 #endif
 
 
   template <typename T>
   BOOST_THREAD_FUTURE<T> make_exceptional_future(exception_ptr ex) {
-    promise<T> p;
-    p.set_exception(ex);
-    return BOOST_THREAD_MAKE_RV_REF(p.get_future());
+    BOOST_THREAD_FUTURE<T> f;
+    f.ready_.set_exception(ex);
+    return BOOST_THREAD_MAKE_RV_REF(f);
   }
 
   template <typename T, typename E>
   BOOST_THREAD_FUTURE<T> make_exceptional_future(E ex) {
-    promise<T> p;
-    p.set_exception(boost::copy_exception(ex));
-    return BOOST_THREAD_MAKE_RV_REF(p.get_future());
+    BOOST_THREAD_FUTURE<T> f;
+    f.ready_.set_exception(boost::copy_exception(ex));
+    return BOOST_THREAD_MAKE_RV_REF(f);
   }
 
   template <typename T>
   BOOST_THREAD_FUTURE<T> make_exceptional_future() {
-    promise<T> p;
-    p.set_exception(boost::current_exception());
-    return BOOST_THREAD_MAKE_RV_REF(p.get_future());
+    BOOST_THREAD_FUTURE<T> f;
+    f.ready_.set_exception(boost::current_exception());
+    return BOOST_THREAD_MAKE_RV_REF(f);
   }
   template <typename T>
   BOOST_THREAD_FUTURE<T> make_ready_future(exception_ptr ex)  {
@@ -4497,6 +6273,10 @@ namespace detail
     }
 
     void call() {
+      if (! this->start_running()) {
+        this->parent = F();
+        return;
+      }
       try {
         this->mark_finished_with_result(this->continuation(boost::move(this->parent)));
       } catch(...) {
@@ -4507,6 +6287,9 @@ namespace detail
     }
 
     void call(boost::unique_lock<boost::mutex>& lck) {
+      if (! this->start_running(lck)) {
+        return;
+      }
       try {
         relocker relock(lck);
 
@@ -4558,6 +6341,10 @@ namespace detail
 
     void call()
     {
+      if (! this->start_running()) {
+        this->parent = F();
+        return;
+      }
       try {
         this->continuation(boost::move(this->parent));
         this->mark_finished_with_result();
@@ -4569,6 +6356,9 @@ namespace detail
     }
 
     void call(boost::unique_lock<boost::mutex>& lck) {
+      if (! this->start_running(lck)) {
+        return;
+      }
       try {
         {
           relocker relock(lck);
@@ -4680,7 +6470,13 @@ namespace detail
 
     void operator()()
     {
+#if defined BOOST_THREAD_PROVIDES_CONTINUATION_FUSION
+      continuation_fusion_scope scope(that_->get_executor());
+      that_->run(that_);
+      scope.run_pending();
+#else
       that_->run(that_);
+#endif
     }
   };
 
@@ -4708,10 +6504,21 @@ namespace detail {
     }
 
     void launch_continuation() {
+#if defined BOOST_THREAD_PROVIDES_CONTINUATION_FUSION
+      if (continuation_fusion_scope::defer(this->get_executor(), this->shared_from_this(), &base_type::run)) {
+        return;
+      }
+#endif
       run_it<base_type> fct(static_shared_from_this(this));
       this->get_executor()->submit(boost::move(fct));
     }
 
+    void enqueue_continuation(continuation_batch& batch) {
+      run_it<base_type> fct(static_shared_from_this(this));
+      executors::work closure(boost::move(fct));
+      batch.submit(this->get_executor(), this->shared_from_this(), boost::move(closure));
+    }
+
     ~future_executor_continuation_shared_state() {}
   };
 #endif
@@ -4787,10 +6594,21 @@ namespace detail {
     }
 
     void launch_continuation() {
+#if defined BOOST_THREAD_PROVIDES_CONTINUATION_FUSION
+      if (continuation_fusion_scope::defer(this->get_executor(), this->shared_from_this(), &base_type::run)) {
+        return;
+      }
+#endif
       run_it<base_type> fct(static_shared_from_this(this));
       this->get_executor()->submit(boost::move(fct));
     }
 
+    void enqueue_continuation(continuation_batch& batch) {
+      run_it<base_type> fct(static_shared_from_this(this));
+      executors::work closure(boost::move(fct));
+      batch.submit(this->get_executor(), this->shared_from_this(), boost::move(closure));
+    }
+
     ~shared_future_executor_continuation_shared_state() {}
   };
 
@@ -4846,11 +6664,12 @@ namespace detail {
   template<typename F, typename Rp, typename Fp>
   BOOST_THREAD_FUTURE<Rp>
   make_future_deferred_continuation_shared_state(
-      boost::unique_lock<boost::mutex> &lock,
+      stop_token const& st, boost::unique_lock<boost::mutex> &lock,
       BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c) {
     typedef typename decay<Fp>::type Cont;
     shared_ptr<future_deferred_continuation_shared_state<F, Rp, Cont> >
         h(new future_deferred_continuation_shared_state<F, Rp, Cont>(boost::move(f), boost::forward<Fp>(c)));
+    h->set_stop_token(st);
     h->init(lock);
     return BOOST_THREAD_FUTURE<Rp>(h);
   }
@@ -4861,11 +6680,12 @@ namespace detail {
   template<typename F, typename Rp, typename Fp>
   BOOST_THREAD_FUTURE<Rp>
   make_future_async_continuation_shared_state(
-      boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f,
+      stop_token const& st, boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f,
       BOOST_THREAD_FWD_REF(Fp) c) {
     typedef typename decay<Fp>::type Cont;
     shared_ptr<future_async_continuation_shared_state<F,Rp, Cont> >
         h(new future_async_continuation_shared_state<F,Rp, Cont>(boost::move(f), boost::forward<Fp>(c)));
+    h->set_stop_token(st);
     h->init(lock);
 
     return BOOST_THREAD_FUTURE<Rp>(h);
@@ -4876,11 +6696,12 @@ namespace detail {
   template<typename F, typename Rp, typename Fp>
   BOOST_THREAD_FUTURE<Rp>
   make_future_sync_continuation_shared_state(
-      boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f,
+      stop_token const& st, boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f,
       BOOST_THREAD_FWD_REF(Fp) c) {
     typedef typename decay<Fp>::type Cont;
     shared_ptr<future_sync_continuation_shared_state<F,Rp, Cont> >
         h(new future_sync_continuation_shared_state<F,Rp, Cont>(boost::move(f), boost::forward<Fp>(c)));
+    h->set_stop_token(st);
     h->init(lock);
 
     return BOOST_THREAD_FUTURE<Rp>(h);
@@ -4893,12 +6714,13 @@ namespace detail {
 
   template<typename Ex, typename F, typename Rp, typename Fp>
   BOOST_THREAD_FUTURE<Rp>
-  make_future_executor_continuation_shared_state(Ex& ex,
+  make_future_executor_continuation_shared_state(Ex& ex, stop_token const& st,
       boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f,
       BOOST_THREAD_FWD_REF(Fp) c) {
     typedef typename decay<Fp>::type Cont;
     shared_ptr<future_executor_continuation_shared_state<F,Rp, Cont> >
         h(new future_executor_continuation_shared_state<F,Rp, Cont>(boost::move(f), boost::forward<Fp>(c)));
+    h->set_stop_token(st);
     h->init(lock, ex);
 
     return BOOST_THREAD_FUTURE<Rp>(h);
@@ -4911,11 +6733,12 @@ namespace detail {
   template<typename F, typename Rp, typename Fp>
   BOOST_THREAD_FUTURE<Rp>
   make_shared_future_deferred_continuation_shared_state(
-      boost::unique_lock<boost::mutex> &lock,
+      stop_token const& st, boost::unique_lock<boost::mutex> &lock,
       F f, BOOST_THREAD_FWD_REF(Fp) c) {
     typedef typename decay<Fp>::type Cont;
     shared_ptr<shared_future_deferred_continuation_shared_state<F, Rp, Cont> >
         h(new shared_future_deferred_continuation_shared_state<F, Rp, Cont>(f, boost::forward<Fp>(c)));
+    h->set_stop_token(st);
     h->init(lock);
 
     return BOOST_THREAD_FUTURE<Rp>(h);
@@ -4926,11 +6749,12 @@ namespace detail {
   template<typename F, typename Rp, typename Fp>
   BOOST_THREAD_FUTURE<Rp>
   make_shared_future_async_continuation_shared_state(
-      boost::unique_lock<boost::mutex> &lock, F f,
+      stop_token const& st, boost::unique_lock<boost::mutex> &lock, F f,
       BOOST_THREAD_FWD_REF(Fp) c) {
     typedef typename decay<Fp>::type Cont;
     shared_ptr<shared_future_async_continuation_shared_state<F,Rp, Cont> >
         h(new shared_future_async_continuation_shared_state<F,Rp, Cont>(f, boost::forward<Fp>(c)));
+    h->set_stop_token(st);
     h->init(lock);
 
     return BOOST_THREAD_FUTURE<Rp>(h);
@@ -4941,11 +6765,12 @@ namespace detail {
   template<typename F, typename Rp, typename Fp>
   BOOST_THREAD_FUTURE<Rp>
   make_shared_future_sync_continuation_shared_state(
-      boost::unique_lock<boost::mutex> &lock, F f,
+      stop_token const& st, boost::unique_lock<boost::mutex> &lock, F f,
       BOOST_THREAD_FWD_REF(Fp) c) {
     typedef typename decay<Fp>::type Cont;
     shared_ptr<shared_future_sync_continuation_shared_state<F,Rp, Cont> >
         h(new shared_future_sync_continuation_shared_state<F,Rp, Cont>(f, boost::forward<Fp>(c)));
+    h->set_stop_token(st);
     h->init(lock);
 
     return BOOST_THREAD_FUTURE<Rp>(h);
@@ -4956,17 +6781,92 @@ namespace detail {
 #ifdef BOOST_THREAD_PROVIDES_EXECUTORS
   template<typename Ex, typename F, typename Rp, typename Fp>
   BOOST_THREAD_FUTURE<Rp>
-  make_shared_future_executor_continuation_shared_state(Ex& ex,
+  make_shared_future_executor_continuation_shared_state(Ex& ex, stop_token const& st,
       boost::unique_lock<boost::mutex> &lock, F f,
       BOOST_THREAD_FWD_REF(Fp) c) {
     typedef typename decay<Fp>::type Cont;
     shared_ptr<shared_future_executor_continuation_shared_state<F, Rp, Cont> >
         h(new shared_future_executor_continuation_shared_state<F, Rp, Cont>(f, boost::forward<Fp>(c)));
+    h->set_stop_token(st);
     h->init(lock, ex);
 
     return BOOST_THREAD_FUTURE<Rp>(h);
   }
 #endif
+}
+
+namespace detail
+{
+  //////////////////////
+  // detail::ready_continuation_result
+  //////////////////////
+  // Calls the continuation of a future made ready without a shared state on the calling thread.
+  // The result is stored in the returned future, which needs no shared state either.
+  template <class Rp>
+  struct ready_continuation_result
+  {
+    template <class F, class Fp>
+    static BOOST_THREAD_FUTURE<Rp> call(BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c)
+    {
+      BOOST_THREAD_FUTURE<Rp> r;
+      try {
+        r.ready_.set_value(c(boost::move(f)));
+      } catch (...) {
+        r.ready_.set_exception(current_exception());
+      }
+      return BOOST_THREAD_MAKE_RV_REF(r);
+    }
+  };
+
+  template <>
+  struct ready_continuation_result<void>
+  {
+    template <class F, class Fp>
+    static BOOST_THREAD_FUTURE<void> call(BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c)
+    {
+      BOOST_THREAD_FUTURE<void> r;
+      try {
+        c(boost::move(f));
+        r.ready_.set_value();
+      } catch (...) {
+        r.ready_.set_exception(current_exception());
+      }
+      return BOOST_THREAD_MAKE_RV_REF(r);
+    }
+  };
+
+#ifdef BOOST_THREAD_PROVIDES_EXECUTORS
+  //////////////////////
+  // detail::ready_continuation
+  //////////////////////
+  // Task submitted to an executor to call the continuation of a future made ready without a shared state.
+  template <class F, class Fp>
+  struct ready_continuation
+  {
+    F parent;
+    Fp continuation;
+
+    BOOST_THREAD_MOVABLE_ONLY(ready_continuation)
+
+    template <class C>
+    ready_continuation(BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(C) c)
+    : parent(boost::move(f)),
+      continuation(boost::forward<C>(c))
+    {
+    }
+
+    ready_continuation(BOOST_THREAD_RV_REF(ready_continuation) x)
+    : parent(boost::move(x.parent)),
+      continuation(boost::move(x.continuation))
+    {
+    }
+
+    typename boost::result_of<Fp(F)>::type operator()()
+    {
+      return continuation(boost::move(parent));
+    }
+  };
+#endif
 }
 
   ////////////////////////////////
@@ -4977,7 +6877,26 @@ namespace detail {
   template <typename F>
   inline BOOST_THREAD_FUTURE<typename boost::result_of<F(BOOST_THREAD_FUTURE<R>)>::type>
   BOOST_THREAD_FUTURE<R>::then(launch policy, BOOST_THREAD_FWD_REF(F) func) {
+    return this->then(policy, stop_token(), boost::forward<F>(func));
+  }
+
+  ////////////////////////////////
+  // template<typename F>
+  // auto future<R>::then(launch policy, stop_token const&, F&& func) -> BOOST_THREAD_FUTURE<decltype(func(*this))>;
+  ////////////////////////////////
+  template <typename R>
+  template <typename F>
+  inline BOOST_THREAD_FUTURE<typename boost::result_of<F(BOOST_THREAD_FUTURE<R>)>::type>
+  BOOST_THREAD_FUTURE<R>::then(launch policy, stop_token const& st, BOOST_THREAD_FWD_REF(F) func) {
     typedef typename boost::result_of<F(BOOST_THREAD_FUTURE<R>)>::type future_type;
+    if (! this->future_ && this->valid() && ! st.stop_possible()
+        && ! (underlying_cast<int>(policy) & (int(launch::async) | int(launch::deferred)))) {
+      // made ready without a shared state: there is nothing to wait for
+      return BOOST_THREAD_MAKE_RV_REF((boost::detail::ready_continuation_result<future_type>::call(
+                  boost::move(*this), boost::forward<F>(func)
+              )));
+    }
+    this->materialize();
     BOOST_THREAD_ASSERT_PRECONDITION(this->future_.get()!=0, future_uninitialized());
 
     // keep state alive as we move ourself but hold the lock
@@ -4985,15 +6904,15 @@ namespace detail {
     boost::unique_lock<boost::mutex> lock(sentinel->mutex);
 
     if (underlying_cast<int>(policy) & int(launch::async)) {
-      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_async_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type>(
+      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_async_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type>(st,
                   lock, boost::move(*this), boost::forward<F>(func)
               )));
     } else if (underlying_cast<int>(policy) & int(launch::deferred)) {
-      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_deferred_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type>(
+      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_deferred_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type>(st,
                   lock, boost::move(*this), boost::forward<F>(func)
               )));
     } else if (underlying_cast<int>(policy) & int(launch::sync)) {
-      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_sync_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type>(
+      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_sync_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type>(st,
                   lock, boost::move(*this), boost::forward<F>(func)
               )));
 #ifdef BOOST_THREAD_PROVIDES_EXECUTORS
@@ -5001,7 +6920,7 @@ namespace detail {
       assert(this->future_->get_executor());
       typedef executor Ex;
       Ex& ex = *(this->future_->get_executor());
-      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_executor_continuation_shared_state<Ex, BOOST_THREAD_FUTURE<R>, future_type>(ex,
+      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_executor_continuation_shared_state<Ex, BOOST_THREAD_FUTURE<R>, future_type>(ex, st,
                     lock, boost::move(*this), boost::forward<F>(func)
                 )));
 #endif
@@ -5009,15 +6928,15 @@ namespace detail {
 
         launch policy_ = this->launch_policy(lock);
         if (underlying_cast<int>(policy_) & int(launch::async)) {
-          return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_async_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type>(
+          return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_async_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type>(st,
                       lock, boost::move(*this), boost::forward<F>(func)
                   )));
         } else if (underlying_cast<int>(policy_) & int(launch::deferred)) {
-          return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_deferred_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type>(
+          return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_deferred_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type>(st,
                       lock, boost::move(*this), boost::forward<F>(func)
                   )));
         } else if (underlying_cast<int>(policy_) & int(launch::sync)) {
-          return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_sync_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type>(
+          return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_sync_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type>(st,
                       lock, boost::move(*this), boost::forward<F>(func)
                   )));
 #ifdef BOOST_THREAD_PROVIDES_EXECUTORS
@@ -5025,17 +6944,17 @@ namespace detail {
           assert(this->future_->get_executor());
           typedef executor Ex;
           Ex& ex = *(this->future_->get_executor());
-          return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_executor_continuation_shared_state<Ex, BOOST_THREAD_FUTURE<R>, future_type>(ex,
+          return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_executor_continuation_shared_state<Ex, BOOST_THREAD_FUTURE<R>, future_type>(ex, st,
                         lock, boost::move(*this), boost::forward<F>(func)
                     )));
 #endif
         } else {
-          return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_async_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type>(
+          return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_async_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type>(st,
                       lock, boost::move(*this), boost::forward<F>(func)
                   )));
         }
     } else {
-      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_async_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type>(
+      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_async_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type>(st,
                   lock, boost::move(*this), boost::forward<F>(func)
               )));
     }
@@ -5047,16 +6966,34 @@ namespace detail {
   ////////////////////////////////
   template <typename R>
   template <typename Ex, typename F>
-  inline BOOST_THREAD_FUTURE<typename boost::result_of<F(BOOST_THREAD_FUTURE<R>)>::type>
+  inline typename boost::detail::disable_if_stop_token<Ex, BOOST_THREAD_FUTURE<typename boost::result_of<F(BOOST_THREAD_FUTURE<R>)>::type> >::type
   BOOST_THREAD_FUTURE<R>::then(Ex& ex, BOOST_THREAD_FWD_REF(F) func) {
+    return this->then(ex, stop_token(), boost::forward<F>(func));
+  }
+
+  ////////////////////////////////
+  // template<typename Ex, typename F>
+  // auto future<R>::then(Ex&, stop_token const&, F&& func) -> BOOST_THREAD_FUTURE<decltype(func(*this))>;
+  ////////////////////////////////
+  template <typename R>
+  template <typename Ex, typename F>
+  inline BOOST_THREAD_FUTURE<typename boost::result_of<F(BOOST_THREAD_FUTURE<R>)>::type>
+  BOOST_THREAD_FUTURE<R>::then(Ex& ex, stop_token const& st, BOOST_THREAD_FWD_REF(F) func) {
     typedef typename boost::result_of<F(BOOST_THREAD_FUTURE<R>)>::type future_type;
+    if (! this->future_ && this->valid()) {
+      // made ready without a shared state: the continuation is submitted right away
+      typedef boost::detail::ready_continuation<BOOST_THREAD_FUTURE<R>, typename decay<F>::type> task_type;
+      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_executor_shared_state<future_type>(ex, st,
+                  task_type(boost::move(*this), boost::forward<F>(func))
+              )));
+    }
     BOOST_THREAD_ASSERT_PRECONDITION(this->future_.get()!=0, future_uninitialized());
 
     // keep state alive as we move ourself but hold the lock
     shared_ptr<detail::shared_state_base> sentinel(this->future_);
     boost::unique_lock<boost::mutex> lock(sentinel->mutex);
 
-    return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_executor_continuation_shared_state<Ex, BOOST_THREAD_FUTURE<R>, future_type>(ex,
+    return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_executor_continuation_shared_state<Ex, BOOST_THREAD_FUTURE<R>, future_type>(ex, st,
                   lock, boost::move(*this), boost::forward<F>(func)
               )));
   }
@@ -5069,11 +7006,23 @@ namespace detail {
   template <typename F>
   inline BOOST_THREAD_FUTURE<typename boost::result_of<F(BOOST_THREAD_FUTURE<R>)>::type>
   BOOST_THREAD_FUTURE<R>::then(BOOST_THREAD_FWD_REF(F) func)  {
+    return this->then(stop_token(), boost::forward<F>(func));
+  }
+
+  ////////////////////////////////
+  // template<typename F>
+  // auto future<R>::then(stop_token const&, F&& func) -> BOOST_THREAD_FUTURE<decltype(func(*this))>;
+  ////////////////////////////////
+  template <typename R>
+  template <typename F>
+  inline BOOST_THREAD_FUTURE<typename boost::result_of<F(BOOST_THREAD_FUTURE<R>)>::type>
+  BOOST_THREAD_FUTURE<R>::then(stop_token const& st, BOOST_THREAD_FWD_REF(F) func)  {
 
 #ifndef BOOST_THREAD_CONTINUATION_SYNC
-    return this->then(this->launch_policy(), boost::forward<F>(func));
+    return this->then(this->launch_policy(), st, boost::forward<F>(func));
 #else
     typedef typename boost::result_of<F(BOOST_THREAD_FUTURE<R>)>::type future_type;
+    this->materialize();
     BOOST_THREAD_ASSERT_PRECONDITION(this->future_.get()!=0, future_uninitialized());
 
     // keep state alive as we move ourself but hold the lock
@@ -5082,11 +7031,11 @@ namespace detail {
 
     launch policy = this->launch_policy(lock);
     if (underlying_cast<int>(policy) & int(launch::deferred)) {
-      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_deferred_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type>(
+      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_deferred_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type>(st,
                   lock, boost::move(*this), boost::forward<F>(func)
               )));
     } else {
-      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_async_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type>(
+      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_async_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type>(st,
                   lock, boost::move(*this), boost::forward<F>(func)
               )));
     }
@@ -5102,8 +7051,23 @@ namespace detail {
   template <typename F>
   inline BOOST_THREAD_FUTURE<typename boost::result_of<F(BOOST_THREAD_FUTURE<BOOST_THREAD_FUTURE<R2> >)>::type>
   BOOST_THREAD_FUTURE<BOOST_THREAD_FUTURE<R2> >::then(launch policy, BOOST_THREAD_FWD_REF(F) func) {
+    return this->then(policy, stop_token(), boost::forward<F>(func));
+  }
+
+  template <typename R2>
+  template <typename F>
+  inline BOOST_THREAD_FUTURE<typename boost::result_of<F(BOOST_THREAD_FUTURE<BOOST_THREAD_FUTURE<R2> >)>::type>
+  BOOST_THREAD_FUTURE<BOOST_THREAD_FUTURE<R2> >::then(launch policy, stop_token const& st, BOOST_THREAD_FWD_REF(F) func) {
     typedef BOOST_THREAD_FUTURE<R2> R;
     typedef typename boost::result_of<F(BOOST_THREAD_FUTURE<R>)>::type future_type;
+    if (! this->future_ && this->valid() && ! st.stop_possible()
+        && ! (underlying_cast<int>(policy) & (int(launch::async) | int(launch::deferred)))) {
+      // made ready without a shared state: there is nothing to wait for
+      return BOOST_THREAD_MAKE_RV_REF((boost::detail::ready_continuation_result<future_type>::call(
+                  boost::move(*this), boost::forward<F>(func)
+              )));
+    }
+    this->materialize();
     BOOST_THREAD_ASSERT_PRECONDITION(this->future_.get()!=0, future_uninitialized());
 
     // keep state alive as we move ourself but hold the lock
@@ -5111,15 +7075,15 @@ namespace detail {
     boost::unique_lock<boost::mutex> lock(sentinel->mutex);
 
     if (underlying_cast<int>(policy) & int(launch::async)) {
-      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_async_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type>(
+      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_async_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type>(st,
                   lock, boost::move(*this), boost::forward<F>(func)
               )));
     } else if (underlying_cast<int>(policy) & int(launch::deferred)) {
-      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_deferred_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type>(
+      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_deferred_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type>(st,
                   lock, boost::move(*this), boost::forward<F>(func)
               )));
     } else if (underlying_cast<int>(policy) & int(launch::sync)) {
-      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_sync_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type>(
+      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_sync_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type>(st,
                   lock, boost::move(*this), boost::forward<F>(func)
               )));
 #ifdef BOOST_THREAD_PROVIDES_EXECUTORS
@@ -5127,7 +7091,7 @@ namespace detail {
       assert(this->future_->get_executor());
       typedef executor Ex;
       Ex& ex = *(this->future_->get_executor());
-      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_executor_continuation_shared_state<Ex, BOOST_THREAD_FUTURE<R>, future_type>(ex,
+      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_executor_continuation_shared_state<Ex, BOOST_THREAD_FUTURE<R>, future_type>(ex, st,
                     lock, boost::move(*this), boost::forward<F>(func)
                 )));
 #endif
@@ -5135,15 +7099,15 @@ namespace detail {
         launch policy_ = this->launch_policy(lock);
 
         if (underlying_cast<int>(policy_) & int(launch::async)) {
-          return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_async_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type>(
+          return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_async_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type>(st,
                       lock, boost::move(*this), boost::forward<F>(func)
                   )));
         } else if (underlying_cast<int>(policy_) & int(launch::deferred)) {
-          return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_deferred_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type>(
+          return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_deferred_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type>(st,
                       lock, boost::move(*this), boost::forward<F>(func)
                   )));
         } else if (underlying_cast<int>(policy_) & int(launch::sync)) {
-          return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_sync_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type>(
+          return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_sync_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type>(st,
                       lock, boost::move(*this), boost::forward<F>(func)
                   )));
 #ifdef BOOST_THREAD_PROVIDES_EXECUTORS
@@ -5151,17 +7115,17 @@ namespace detail {
           assert(this->future_->get_executor());
           typedef executor Ex;
           Ex& ex = *(this->future_->get_executor());
-          return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_executor_continuation_shared_state<Ex, BOOST_THREAD_FUTURE<R>, future_type>(ex,
+          return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_executor_continuation_shared_state<Ex, BOOST_THREAD_FUTURE<R>, future_type>(ex, st,
                         lock, boost::move(*this), boost::forward<F>(func)
                     )));
 #endif
         } else {
-          return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_async_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type>(
+          return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_async_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type>(st,
                       lock, boost::move(*this), boost::forward<F>(func)
                   )));
         }
     } else {
-      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_async_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type>(
+      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_async_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type>(st,
                   lock, boost::move(*this), boost::forward<F>(func)
               )));
     }
@@ -5174,17 +7138,31 @@ namespace detail {
   ////////////////////////////////
   template <typename R2>
   template <typename Ex, typename F>
-  inline BOOST_THREAD_FUTURE<typename boost::result_of<F(BOOST_THREAD_FUTURE<BOOST_THREAD_FUTURE<R2> >)>::type>
+  inline typename boost::detail::disable_if_stop_token<Ex, BOOST_THREAD_FUTURE<typename boost::result_of<F(BOOST_THREAD_FUTURE<BOOST_THREAD_FUTURE<R2> >)>::type> >::type
   BOOST_THREAD_FUTURE<BOOST_THREAD_FUTURE<R2> >::then(Ex& ex, BOOST_THREAD_FWD_REF(F) func) {
+    return this->then(ex, stop_token(), boost::forward<F>(func));
+  }
+
+  template <typename R2>
+  template <typename Ex, typename F>
+  inline BOOST_THREAD_FUTURE<typename boost::result_of<F(BOOST_THREAD_FUTURE<BOOST_THREAD_FUTURE<R2> >)>::type>
+  BOOST_THREAD_FUTURE<BOOST_THREAD_FUTURE<R2> >::then(Ex& ex, stop_token const& st, BOOST_THREAD_FWD_REF(F) func) {
     typedef BOOST_THREAD_FUTURE<R2> R;
     typedef typename boost::result_of<F(BOOST_THREAD_FUTURE<R>)>::type future_type;
+    if (! this->future_ && this->valid()) {
+      // made ready without a shared state: the continuation is submitted right away
+      typedef boost::detail::ready_continuation<BOOST_THREAD_FUTURE<R>, typename decay<F>::type> task_type;
+      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_executor_shared_state<future_type>(ex, st,
+                  task_type(boost::move(*this), boost::forward<F>(func))
+              )));
+    }
     BOOST_THREAD_ASSERT_PRECONDITION(this->future_.get()!=0, future_uninitialized());
 
     // keep state alive as we move ourself but hold the lock
     shared_ptr<detail::shared_state_base> sentinel(this->future_);
     boost::unique_lock<boost::mutex> lock(sentinel->mutex);
 
-    return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_executor_continuation_shared_state<Ex, BOOST_THREAD_FUTURE<R>, future_type>(ex,
+    return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_executor_continuation_shared_state<Ex, BOOST_THREAD_FUTURE<R>, future_type>(ex, st,
                   lock, boost::move(*this), boost::forward<F>(func)
               )));
   }
@@ -5198,12 +7176,20 @@ namespace detail {
   template <typename F>
   inline BOOST_THREAD_FUTURE<typename boost::result_of<F(BOOST_THREAD_FUTURE<BOOST_THREAD_FUTURE<R2> >)>::type>
   BOOST_THREAD_FUTURE<BOOST_THREAD_FUTURE<R2> >::then(BOOST_THREAD_FWD_REF(F) func)  {
+    return this->then(stop_token(), boost::forward<F>(func));
+  }
+
+  template <typename R2>
+  template <typename F>
+  inline BOOST_THREAD_FUTURE<typename boost::result_of<F(BOOST_THREAD_FUTURE<BOOST_THREAD_FUTURE<R2> >)>::type>
+  BOOST_THREAD_FUTURE<BOOST_THREAD_FUTURE<R2> >::then(stop_token const& st, BOOST_THREAD_FWD_REF(F) func)  {
 
 #ifndef BOOST_THREAD_CONTINUATION_SYNC
-    return this->then(this->launch_policy(), boost::forward<F>(func));
+    return this->then(this->launch_policy(), st, boost::forward<F>(func));
 #else
     typedef BOOST_THREAD_FUTURE<R2> R;
     typedef typename boost::result_of<F(BOOST_THREAD_FUTURE<R>)>::type future_type;
+    this->materialize();
     BOOST_THREAD_ASSERT_PRECONDITION(this->future_.get()!=0, future_uninitialized());
 
     // keep state alive as we move ourself but hold the lock
@@ -5213,11 +7199,11 @@ namespace detail {
     launch policy = this->launch_policy(lock);
 
     if  (underlying_cast<int>(policy) & int(launch::deferred)) {
-      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_deferred_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type>(
+      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_deferred_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type>(st,
                   lock, boost::move(*this), boost::forward<F>(func)
               )));
     } else {
-      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_sync_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type>(
+      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_sync_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type>(st,
                   lock, boost::move(*this), boost::forward<F>(func)
               )));
     }
@@ -5232,28 +7218,40 @@ namespace detail {
   template <typename F>
   inline BOOST_THREAD_FUTURE<typename boost::result_of<F(shared_future<R>)>::type>
   shared_future<R>::then(launch policy, BOOST_THREAD_FWD_REF(F) func)  const
+  {
+    return this->then(policy, stop_token(), boost::forward<F>(func));
+  }
+
+  ////////////////////////////////
+  // template<typename F>
+  // auto shared_future<R>::then(launch policy, stop_token const&, F&& func) -> BOOST_THREAD_FUTURE<decltype(func(*this))>;
+  ////////////////////////////////
+  template <typename R>
+  template <typename F>
+  inline BOOST_THREAD_FUTURE<typename boost::result_of<F(shared_future<R>)>::type>
+  shared_future<R>::then(launch policy, stop_token const& st, BOOST_THREAD_FWD_REF(F) func)  const
   {
     typedef typename boost::result_of<F(shared_future<R>)>::type future_type;
     BOOST_THREAD_ASSERT_PRECONDITION(this->future_.get()!=0, future_uninitialized());
 
     boost::unique_lock<boost::mutex> lock(this->future_->mutex);
     if (underlying_cast<int>(policy) & int(launch::async)) {
-      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_shared_future_async_continuation_shared_state<shared_future<R>, future_type>(
+      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_shared_future_async_continuation_shared_state<shared_future<R>, future_type>(st,
                   lock, *this, boost::forward<F>(func)
               )));
     } else if (underlying_cast<int>(policy) & int(launch::deferred)) {
-      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_shared_future_deferred_continuation_shared_state<shared_future<R>, future_type>(
+      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_shared_future_deferred_continuation_shared_state<shared_future<R>, future_type>(st,
                   lock, *this, boost::forward<F>(func)
               )));
     } else if (underlying_cast<int>(policy) & int(launch::sync)) {
-      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_shared_future_sync_continuation_shared_state<shared_future<R>, future_type>(
+      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_shared_future_sync_continuation_shared_state<shared_future<R>, future_type>(st,
                   lock, *this, boost::forward<F>(func)
               )));
 #ifdef BOOST_THREAD_PROVIDES_EXECUTORS
     } else if (underlying_cast<int>(policy) & int(launch::executor)) {
       typedef executor Ex;
       Ex& ex = *(this->future_->get_executor());
-      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_shared_future_executor_continuation_shared_state<Ex, shared_future<R>, future_type>(ex,
+      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_shared_future_executor_continuation_shared_state<Ex, shared_future<R>, future_type>(ex, st,
                     lock, *this, boost::forward<F>(func)
                 )));
 #endif
@@ -5261,33 +7259,33 @@ namespace detail {
 
         launch policy_ = this->launch_policy(lock);
         if (underlying_cast<int>(policy_) & int(launch::async)) {
-          return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_shared_future_async_continuation_shared_state<shared_future<R>, future_type>(
+          return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_shared_future_async_continuation_shared_state<shared_future<R>, future_type>(st,
                       lock, *this, boost::forward<F>(func)
                   )));
         } else if (underlying_cast<int>(policy_) & int(launch::deferred)) {
-          return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_shared_future_deferred_continuation_shared_state<shared_future<R>, future_type>(
+          return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_shared_future_deferred_continuation_shared_state<shared_future<R>, future_type>(st,
                       lock, *this, boost::forward<F>(func)
                   )));
         } else if (underlying_cast<int>(policy_) & int(launch::sync)) {
-          return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_shared_future_sync_continuation_shared_state<shared_future<R>, future_type>(
+          return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_shared_future_sync_continuation_shared_state<shared_future<R>, future_type>(st,
                       lock, *this, boost::forward<F>(func)
                   )));
 #ifdef BOOST_THREAD_PROVIDES_EXECUTORS
         } else if (underlying_cast<int>(policy_) & int(launch::executor)) {
           typedef executor Ex;
           Ex& ex = *(this->future_->get_executor());
-          return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_shared_future_executor_continuation_shared_state<Ex, shared_future<R>, future_type>(ex,
+          return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_shared_future_executor_continuation_shared_state<Ex, shared_future<R>, future_type>(ex, st,
                         lock, *this, boost::forward<F>(func)
                     )));
 #endif
         } else {
-          return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_shared_future_async_continuation_shared_state<shared_future<R>, future_type>(
+          return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_shared_future_async_continuation_shared_state<shared_future<R>, future_type>(st,
                       lock, *this, boost::forward<F>(func)
                   )));
         }
 
     } else {
-      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_shared_future_async_continuation_shared_state<shared_future<R>, future_type>(
+      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_shared_future_async_continuation_shared_state<shared_future<R>, future_type>(st,
                   lock, *this, boost::forward<F>(func)
               )));
     }
@@ -5299,14 +7297,22 @@ namespace detail {
   ////////////////////////////////
   template <typename R>
   template <typename Ex, typename F>
-  inline BOOST_THREAD_FUTURE<typename boost::result_of<F(shared_future<R>)>::type>
+  inline typename boost::detail::disable_if_stop_token<Ex, BOOST_THREAD_FUTURE<typename boost::result_of<F(shared_future<R>)>::type> >::type
   shared_future<R>::then(Ex& ex, BOOST_THREAD_FWD_REF(F) func)  const
+  {
+    return this->then(ex, stop_token(), boost::forward<F>(func));
+  }
+
+  template <typename R>
+  template <typename Ex, typename F>
+  inline BOOST_THREAD_FUTURE<typename boost::result_of<F(shared_future<R>)>::type>
+  shared_future<R>::then(Ex& ex, stop_token const& st, BOOST_THREAD_FWD_REF(F) func)  const
   {
     typedef typename boost::result_of<F(shared_future<R>)>::type future_type;
     BOOST_THREAD_ASSERT_PRECONDITION(this->future_.get()!=0, future_uninitialized());
 
     boost::unique_lock<boost::mutex> lock(this->future_->mutex);
-    return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_shared_future_executor_continuation_shared_state<Ex, shared_future<R>, future_type>(ex,
+    return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_shared_future_executor_continuation_shared_state<Ex, shared_future<R>, future_type>(ex, st,
                   lock, *this, boost::forward<F>(func)
               )));
   }
@@ -5320,8 +7326,19 @@ namespace detail {
   template <typename F>
   inline BOOST_THREAD_FUTURE<typename boost::result_of<F(shared_future<R>)>::type>
   shared_future<R>::then(BOOST_THREAD_FWD_REF(F) func)  const {
+    return this->then(stop_token(), boost::forward<F>(func));
+  }
+
+  ////////////////////////////////
+  // template<typename F>
+  // auto shared_future<R>::then(stop_token const&, F&& func) -> BOOST_THREAD_FUTURE<decltype(func(*this))>;
+  ////////////////////////////////
+  template <typename R>
+  template <typename F>
+  inline BOOST_THREAD_FUTURE<typename boost::result_of<F(shared_future<R>)>::type>
+  shared_future<R>::then(stop_token const& st, BOOST_THREAD_FWD_REF(F) func)  const {
 #ifndef BOOST_THREAD_CONTINUATION_SYNC
-    return this->then(this->launch_policy(), boost::forward<F>(func));
+    return this->then(this->launch_policy(), st, boost::forward<F>(func));
 #else
     typedef typename boost::result_of<F(shared_future<R>)>::type future_type;
     BOOST_THREAD_ASSERT_PRECONDITION(this->future_.get()!=0, future_uninitialized());
@@ -5329,11 +7346,11 @@ namespace detail {
     boost::unique_lock<boost::mutex> lock(this->future_->mutex);
     launch policy = this->launch_policy(lock);
     if (underlying_cast<int>(policy) & int(launch::deferred)) {
-      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_shared_future_deferred_continuation_shared_state<shared_future<R>, future_type>(
+      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_shared_future_deferred_continuation_shared_state<shared_future<R>, future_type>(st,
                   lock, *this, boost::forward<F>(func)
               )));
     } else {
-      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_shared_future_sync_continuation_shared_state<shared_future<R>, future_type>(
+      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_shared_future_sync_continuation_shared_state<shared_future<R>, future_type>(st,
                   lock, *this, boost::forward<F>(func)
               )));
     }
@@ -5415,24 +7432,28 @@ namespace detail
       {
         if (wrapped.has_exception()) {
           this->mark_exceptional_finish_internal(wrapped.get_exception_ptr(), lk);
-        } else {
-          unwrapped = wrapped.get();
-          if (unwrapped.valid())
-          {
-            lk.unlock();
-            boost::unique_lock<boost::mutex> lk2(unwrapped.future_->mutex);
-            unwrapped.future_->set_continuation_ptr(this->shared_from_this(), lk2);
-          } else {
-            this->mark_exceptional_finish_internal(boost::copy_exception(future_uninitialized()), lk);
-          }
+          return;
         }
-      } else {
-        // assert(unwrapped.is_ready());
-        if (unwrapped.has_exception()) {
-          this->mark_exceptional_finish_internal(unwrapped.get_exception_ptr(), lk);
-        } else {
-          this->mark_finished_with_result_internal(unwrapped.get(), lk);
+        unwrapped = wrapped.get();
+        if (! unwrapped.valid())
+        {
+          this->mark_exceptional_finish_internal(boost::copy_exception(future_uninitialized()), lk);
+          return;
         }
+        if (unwrapped.future_)
+        {
+          lk.unlock();
+          boost::unique_lock<boost::mutex> lk2(unwrapped.future_->mutex);
+          unwrapped.future_->set_continuation_ptr(this->shared_from_this(), lk2);
+          return;
+        }
+        // the inner future has been made ready without a shared state
+      }
+      // assert(unwrapped.is_ready());
+      if (unwrapped.has_exception()) {
+        this->mark_exceptional_finish_internal(unwrapped.get_exception_ptr(), lk);
+      } else {
+            this->mark_finished_with_result_internal(unwrapped.get(), lk);
       }
     }
   };
@@ -5455,24 +7476,28 @@ namespace detail
       {
         if (wrapped.has_exception()) {
           this->mark_exceptional_finish_internal(wrapped.get_exception_ptr(), lk);
-        } else {
-          unwrapped = wrapped.get();
-          if (unwrapped.valid())
-          {
-            lk.unlock();
-            boost::unique_lock<boost::mutex> lk2(unwrapped.future_->mutex);
-            unwrapped.future_->set_continuation_ptr(this->shared_from_this(), lk2);
-          } else {
-            this->mark_exceptional_finish_internal(boost::copy_exception(future_uninitialized()), lk);
-          }
+          return;
         }
-      } else {
-        // assert(unwrapped.is_ready());
-        if (unwrapped.has_exception()) {
-          this->mark_exceptional_finish_internal(unwrapped.get_exception_ptr(), lk);
-        } else {
-          this->mark_finished_with_result_internal(lk);
+        unwrapped = wrapped.get();
+        if (! unwrapped.valid())
+        {
+          this->mark_exceptional_finish_internal(boost::copy_exception(future_uninitialized()), lk);
+          return;
+        }
+        if (unwrapped.future_)
+        {
+          lk.unlock();
+          boost::unique_lock<boost::mutex> lk2(unwrapped.future_->mutex);
+          unwrapped.future_->set_continuation_ptr(this->shared_from_this(), lk2);
+          return;
         }
+        // the inner future has been made ready without a shared state
+      }
+      // assert(unwrapped.is_ready());
+      if (unwrapped.has_exception()) {
+        this->mark_exceptional_finish_internal(unwrapped.get_exception_ptr(), lk);
+      } else {
+            this->mark_finished_with_result_internal(lk);
       }
     }
   };
@@ -5496,6 +7521,22 @@ namespace detail
   BOOST_THREAD_FUTURE<R2>
   BOOST_THREAD_FUTURE<BOOST_THREAD_FUTURE<R2> >::unwrap()
   {
+    if (! this->future_ && this->valid())
+    {
+      // made ready without a shared state: the inner future is the result
+      if (this->has_exception())
+      {
+        BOOST_THREAD_FUTURE<R2> res((exceptional_ptr(this->get_exception_ptr())));
+        this->ready_.reset();
+        return BOOST_THREAD_MAKE_RV_REF(res);
+      }
+      BOOST_THREAD_FUTURE<R2> inner(this->ready_.get(true));
+      if (! inner.valid())
+      {
+        return BOOST_THREAD_MAKE_RV_REF(BOOST_THREAD_FUTURE<R2>(exceptional_ptr(future_uninitialized())));
+      }
+      return BOOST_THREAD_MAKE_RV_REF(inner);
+    }
     BOOST_THREAD_ASSERT_PRECONDITION(this->future_.get()!=0, future_uninitialized());
 
     // keep state alive as we move ourself but hold the lock
@@ -0,0 +1,358 @@
+//  (C) Copyright 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_THREAD_FUTURES_COROUTINE_HPP
+#define BOOST_THREAD_FUTURES_COROUTINE_HPP
+
+#include <boost/thread/detail/config.hpp>
+
+#if defined BOOST_THREAD_PROVIDES_COROUTINES
+
+#include <boost/thread/future.hpp>
+
+#include <boost/exception_ptr.hpp>
+#include <boost/optional.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/type_traits/is_void.hpp>
+
+#include <coroutine>
+#include <exception>
+#include <utility>
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+  namespace detail
+  {
+    /// Awaiter suspending a coroutine until a future is ready. It registers itself on the shared state, so no
+    /// continuation is created and no thread is blocked. The coroutine is resumed on the thread making the future ready.
+    template <class Future>
+    class future_awaiter : private ready_callback_link
+    {
+      Future future_;
+      std::coroutine_handle<> handle_;
+      bool registered_;
+
+      void on_ready()
+      {
+        handle_.resume();
+      }
+
+    public:
+      explicit future_awaiter(Future&& f) : future_(std::move(f)), registered_(false) {}
+      explicit future_awaiter(Future const& f) : future_(f), registered_(false) {}
+      future_awaiter(future_awaiter const&) = delete;
+      future_awaiter& operator=(future_awaiter const&) = delete;
+
+      ~future_awaiter()
+      {
+        // The awaiting coroutine has been destroyed while suspended.
+        if (registered_) future_.future_->remove_ready_callback(*this);
+      }
+
+      bool await_ready() const
+      {
+        return ! future_.valid() || future_.is_ready();
+      }
+
+      bool await_suspend(std::coroutine_handle<> h)
+      {
+        handle_ = h;
+        // Once registered the coroutine may be resumed, and this awaiter destroyed, before add_ready_callback() returns.
+        registered_ = true;
+        if (future_.future_->add_ready_callback(*this))
+        {
+          registered_ = false;
+          return false;
+        }
+        return true;
+      }
+
+      decltype(auto) await_resume()
+      {
+        registered_ = false;
+        return future_.get();
+      }
+    };
+
+    template <class Executor>
+    class schedule_awaiter
+    {
+      Executor& ex_;
+
+    public:
+      explicit schedule_awaiter(Executor& ex) : ex_(ex) {}
+
+      bool await_ready() const BOOST_NOEXCEPT
+      {
+        return false;
+      }
+
+      void await_suspend(std::coroutine_handle<> h)
+      {
+        ex_.submit([h]() { h.resume(); });
+      }
+
+      void await_resume() const BOOST_NOEXCEPT
+      {
+      }
+    };
+
+    // Coroutine type used to run a task eagerly and store its result in a promise. Its frame destroys itself on completion.
+    struct detached_coroutine
+    {
+      struct promise_type
+      {
+        detached_coroutine get_return_object() BOOST_NOEXCEPT { return detached_coroutine(); }
+        std::suspend_never initial_suspend() const BOOST_NOEXCEPT { return std::suspend_never(); }
+        std::suspend_never final_suspend() const BOOST_NOEXCEPT { return std::suspend_never(); }
+        void return_void() const BOOST_NOEXCEPT {}
+        void unhandled_exception() const BOOST_NOEXCEPT { std::terminate(); }
+      };
+    };
+
+    template <class T>
+    class task_promise_base
+    {
+      std::coroutine_handle<> continuation_;
+      std::exception_ptr exception_;
+
+      struct final_awaiter
+      {
+        bool await_ready() const BOOST_NOEXCEPT
+        {
+          return false;
+        }
+        template <class Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> h) BOOST_NOEXCEPT
+        {
+          std::coroutine_handle<> next = h.promise().continuation_;
+          return next ? next : std::noop_coroutine();
+        }
+        void await_resume() const BOOST_NOEXCEPT
+        {
+        }
+      };
+
+    public:
+      std::suspend_always initial_suspend() const BOOST_NOEXCEPT
+      {
+        return std::suspend_always();
+      }
+      final_awaiter final_suspend() const BOOST_NOEXCEPT
+      {
+        return final_awaiter();
+      }
+      void unhandled_exception() BOOST_NOEXCEPT
+      {
+        exception_ = std::current_exception();
+      }
+      void set_continuation(std::coroutine_handle<> h) BOOST_NOEXCEPT
+      {
+        continuation_ = h;
+      }
+      void rethrow_if_exception()
+      {
+        if (exception_) std::rethrow_exception(exception_);
+      }
+    };
+  }
+
+  template <class T>
+  class task;
+
+  namespace detail
+  {
+    template <class T>
+    struct task_promise : task_promise_base<T>
+    {
+      boost::optional<T> result_;
+
+      task<T> get_return_object() BOOST_NOEXCEPT;
+
+      template <class U>
+      void return_value(U&& value)
+      {
+        result_.emplace(std::forward<U>(value));
+      }
+      T result()
+      {
+        this->rethrow_if_exception();
+        return static_cast<T&&>(*result_);
+      }
+    };
+
+    template <>
+    struct task_promise<void> : task_promise_base<void>
+    {
+      task<void> get_return_object() BOOST_NOEXCEPT;
+
+      void return_void() BOOST_NOEXCEPT
+      {
+      }
+      void result()
+      {
+        this->rethrow_if_exception();
+      }
+    };
+  }
+
+  /**
+   * Lazily started coroutine producing a value of type T.
+   * The body does not run until the task is awaited or started; awaiting it resumes the awaiting coroutine, on the
+   * thread that completed the task, without blocking.
+   */
+  template <class T>
+  class task
+  {
+  public:
+    typedef detail::task_promise<T> promise_type;
+    typedef T value_type;
+
+  private:
+    std::coroutine_handle<promise_type> handle_;
+
+    struct awaiter
+    {
+      std::coroutine_handle<promise_type> handle_;
+
+      bool await_ready() const BOOST_NOEXCEPT
+      {
+        return ! handle_ || handle_.done();
+      }
+      std::coroutine_handle<> await_suspend(std::coroutine_handle<> h) BOOST_NOEXCEPT
+      {
+        handle_.promise().set_continuation(h);
+        return handle_;
+      }
+      T await_resume()
+      {
+        if (! handle_) boost::throw_exception(future_uninitialized());
+        return handle_.promise().result();
+      }
+    };
+
+    static detail::detached_coroutine run(task t, promise<T> p)
+    {
+      try
+      {
+        if constexpr (is_void<T>::value)
+        {
+          co_await std::move(t);
+          p.set_value();
+        }
+        else
+        {
+          p.set_value(co_await std::move(t));
+        }
+      }
+      catch (...)
+      {
+        p.set_exception(boost::current_exception());
+      }
+    }
+
+  public:
+    task() BOOST_NOEXCEPT : handle_() {}
+    explicit task(std::coroutine_handle<promise_type> h) BOOST_NOEXCEPT : handle_(h) {}
+    task(task const&) = delete;
+    task& operator=(task const&) = delete;
+
+    task(task&& other) BOOST_NOEXCEPT : handle_(other.handle_)
+    {
+      other.handle_ = nullptr;
+    }
+    task& operator=(task&& other) BOOST_NOEXCEPT
+    {
+      task tmp(std::move(other));
+      swap(tmp);
+      return *this;
+    }
+    ~task()
+    {
+      if (handle_) handle_.destroy();
+    }
+
+    void swap(task& other) BOOST_NOEXCEPT
+    {
+      std::swap(handle_, other.handle_);
+    }
+
+    bool valid() const BOOST_NOEXCEPT
+    {
+      return handle_ != nullptr;
+    }
+
+    awaiter operator co_await() && BOOST_NOEXCEPT
+    {
+      return awaiter{handle_};
+    }
+
+    /**
+     * Effects: Runs the task on the calling thread until its first suspension point.
+     * Returns: A future ready when the task completes, which can be passed to when_all() or when_any().
+     * Postconditions: valid() == false.
+     */
+    BOOST_THREAD_FUTURE<T> start()
+    {
+      if (! handle_) boost::throw_exception(future_uninitialized());
+      promise<T> p;
+      BOOST_THREAD_FUTURE<T> f = p.get_future();
+      run(std::move(*this), std::move(p));
+      return f;
+    }
+  };
+
+  namespace detail
+  {
+    template <class T>
+    task<T> task_promise<T>::get_return_object() BOOST_NOEXCEPT
+    {
+      return task<T>(std::coroutine_handle<task_promise<T> >::from_promise(*this));
+    }
+
+    inline task<void> task_promise<void>::get_return_object() BOOST_NOEXCEPT
+    {
+      return task<void>(std::coroutine_handle<task_promise<void> >::from_promise(*this));
+    }
+  }
+
+  /// co_await on a future suspends the coroutine until the future is ready and returns the result of get().
+  template <class R>
+  detail::future_awaiter<BOOST_THREAD_FUTURE<R> > operator co_await(BOOST_THREAD_FUTURE<R>&& f)
+  {
+    return detail::future_awaiter<BOOST_THREAD_FUTURE<R> >(std::move(f));
+  }
+
+  /// Postconditions: f.valid() == false, as after then().
+  template <class R>
+  detail::future_awaiter<BOOST_THREAD_FUTURE<R> > operator co_await(BOOST_THREAD_FUTURE<R>& f)
+  {
+    return detail::future_awaiter<BOOST_THREAD_FUTURE<R> >(std::move(f));
+  }
+
+  template <class R>
+  detail::future_awaiter<shared_future<R> > operator co_await(shared_future<R> const& f)
+  {
+    return detail::future_awaiter<shared_future<R> >(f);
+  }
+
+  /**
+   * co_await schedule(ex) resumes the coroutine on one of the threads of execution of the executor ex.
+   * Throws: Whatever ex.submit() throws, e.g. sync_queue_is_closed if ex has been closed.
+   */
+  template <class Executor>
+  detail::schedule_awaiter<Executor> schedule(Executor& ex)
+  {
+    return detail::schedule_awaiter<Executor>(ex);
+  }
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif // BOOST_THREAD_PROVIDES_COROUTINES
+#endif // header
@@ -85,6 +85,15 @@ namespace boost
         {}
     };
 
+    class BOOST_SYMBOL_VISIBLE task_cancelled:
+        public future_error
+    {
+    public:
+        task_cancelled():
+          future_error(system::make_error_code(future_errc::cancelled))
+        {}
+    };
+
     class promise_moved:
         public future_error
     {
@@ -12,12 +12,14 @@
 
 #include <boost/thread/detail/move.hpp>
 #include <boost/thread/futures/is_future_type.hpp>
-#include <boost/thread/lock_algorithms.hpp>
 #include <boost/thread/mutex.hpp>
 #include <boost/thread/condition_variable.hpp>
 
+#include <boost/assert.hpp>
 #include <boost/core/enable_if.hpp>
-#include <boost/scoped_array.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <cstddef>
 
 #include <iterator>
 #include <vector>
@@ -26,87 +28,132 @@ namespace boost
 {
   namespace detail
   {
-    template <class Future>
-    class waiter_for_any_in_seq
+    struct shared_state_base;
+    class any_ready_notifier;
+
+    // Registration of a waiter on a shared state. The links are owned by the
+    // waiter and chained in place by the shared state, so waiting for N
+    // futures needs no per-future allocation.
+    struct any_ready_link
     {
-      struct registered_waiter;
-      typedef std::vector<int>::size_type count_type;
+      any_ready_notifier* notifier;
+      std::size_t index;
+      any_ready_link* prev;
+      any_ready_link* next;
+      bool linked;
+
+      any_ready_link() :
+        notifier(0), index(0), prev(0), next(0), linked(false)
+      {
+      }
+    };
+
+    // Single-shot notifier shared by all the links of a waiter. Each shared
+    // state reports its index once when it becomes ready, so the waiter learns
+    // which future completed without scanning nor locking the whole set.
+    class any_ready_notifier
+    {
+      boost::mutex mtx_;
+      boost::condition_variable cv_;
+      std::vector<std::size_t> ready_;
+      std::size_t consumed_;
 
-      struct registered_waiter
+    public:
+      any_ready_notifier() :
+        consumed_(0)
       {
-        typedef Future future_type;
-        future_type* future_;
-        typedef typename Future::notify_when_ready_handle notify_when_ready_handle;
-        notify_when_ready_handle handle;
-        count_type index;
-
-        registered_waiter(future_type & a_future,
-            notify_when_ready_handle handle_, count_type index_) :
-          future_(&a_future), handle(handle_), index(index_)
+      }
+
+      void reserve(std::size_t n)
+      {
+        ready_.reserve(n);
+      }
+
+      // Called by the shared state with its mutex locked. The storage has
+      // been reserved up front, so this never allocates.
+      void notify(std::size_t index)
+      {
+        boost::lock_guard<boost::mutex> lk(mtx_);
+        ready_.push_back(index);
+        cv_.notify_one();
+      }
+
+      std::size_t wait_next()
+      {
+        boost::unique_lock<boost::mutex> lk(mtx_);
+        while (consumed_ == ready_.size())
         {
+          cv_.wait(lk);
         }
-      };
+        return ready_[consumed_++];
+      }
+    };
 
-      struct all_futures_lock
+    template <class StatePtr>
+    class any_ready_waiter
+    {
+    public:
+      typedef std::vector<int>::size_type count_type;
+
+    private:
+      struct registered_state
       {
-#ifdef _MANAGED
-        typedef std::ptrdiff_t count_type_portable;
-#else
-        typedef count_type count_type_portable;
-#endif
-        count_type_portable count;
-        boost::scoped_array<boost::unique_lock<boost::mutex> > locks;
+        StatePtr state;
+        any_ready_link link;
 
-        all_futures_lock(std::vector<registered_waiter>& waiters) :
-          count(waiters.size()), locks(new boost::unique_lock<boost::mutex>[count])
+        registered_state(StatePtr const& a_state, count_type index) :
+          state(a_state)
         {
-          for (count_type_portable i = 0; i < count; ++i)
-          {
-            locks[i] = BOOST_THREAD_MAKE_RV_REF(boost::unique_lock<boost::mutex>(waiters[i].future_->mutex()));
-          }
+          link.index = index;
         }
+      };
+
+      any_ready_notifier notifier_;
+      std::vector<registered_state> states_;
+      count_type future_count_;
+      count_type armed_;
+      count_type returned_;
 
-        void lock()
+      any_ready_waiter(any_ready_waiter const&);
+      any_ready_waiter& operator=(any_ready_waiter const&);
+
+      void arm()
+      {
+        if (armed_ == 0)
         {
-          boost::lock(locks.get(), locks.get() + count);
+          notifier_.reserve(states_.size());
         }
-
-        void unlock()
+        for (; armed_ < states_.size(); ++armed_)
         {
-          for (count_type_portable i = 0; i < count; ++i)
+          registered_state& r = states_[armed_];
+          r.link.notifier = &notifier_;
+          if (r.state->notify_when_ready(r.link))
           {
-            locks[i].unlock();
+            notifier_.notify(r.link.index);
           }
         }
-      };
-
-      boost::condition_variable_any cv;
-      std::vector<registered_waiter> waiters_;
-      count_type future_count;
+      }
 
     public:
-      waiter_for_any_in_seq() :
-        future_count(0)
+      any_ready_waiter() :
+        future_count_(0), armed_(0), returned_(0)
+      {
+      }
+
+      void reserve(count_type n)
       {
+        states_.reserve(n);
       }
 
       template <typename F>
       void add(F& f)
       {
+        BOOST_ASSERT(armed_ == 0);
         if (f.valid())
         {
-          registered_waiter waiter(f, f.notify_when_ready(cv), future_count);
-          try
-          {
-            waiters_.push_back(waiter);
-          }
-          catch (...)
-          {
-            f.future_->unnotify_when_ready(waiter.handle);
-            throw;
-          }
-          ++future_count;
+          states_.push_back(registered_state(f.materialize(), future_count_));
         }
+        ++future_count_;
       }
 
 #ifndef BOOST_NO_CXX11_VARIADIC_TEMPLATES
@@ -118,27 +165,29 @@ namespace boost
       }
 #endif
 
+      // Number of registered futures not yet returned by wait().
+      count_type pending() const
+      {
+        return states_.size() - returned_;
+      }
+
+      // Returns the index of the next future to become ready, in completion
+      // order. Each index is returned once.
       count_type wait()
       {
-        all_futures_lock lk(waiters_);
-        for (;;)
-        {
-          for (count_type i = 0; i < waiters_.size(); ++i)
-          {
-            if (waiters_[i].future_->is_ready(lk.locks[i]))
-            {
-              return waiters_[i].index;
-            }
-          }
-          cv.wait(lk);
-        }
+        arm();
+        count_type index = notifier_.wait_next();
+        ++returned_;
+        return index;
       }
 
-      ~waiter_for_any_in_seq()
+      ~any_ready_waiter()
       {
-        for (count_type i = 0; i < waiters_.size(); ++i)
+        // Unlinking takes each state mutex in turn, which also waits for any
+        // notification still in flight.
+        for (count_type i = 0; i < armed_; ++i)
         {
-          waiters_[i].future_->unnotify_when_ready(waiters_[i].handle);
+          states_[i].state->unnotify_when_ready(states_[i].link);
         }
       }
     };
@@ -149,7 +198,8 @@ namespace boost
   {
     if (begin == end) return end;
 
-    detail::waiter_for_any_in_seq<typename std::iterator_traits<Iterator>::value_type> waiter;
+    detail::any_ready_waiter<boost::shared_ptr<detail::shared_state_base> > waiter;
+    waiter.reserve(std::distance(begin, end));
     for (Iterator current = begin; current != end; ++current)
     {
       waiter.add(*current);
@@ -158,6 +208,51 @@ namespace boost
     std::advance( begin, waiter.wait() );
     return begin;
   }
+
+  // Waits repeatedly on a range of futures, returning them in the order they
+  // become ready. The futures must outlive the queue.
+  template <typename Iterator>
+  class wait_for_any_queue
+  {
+    typedef detail::any_ready_waiter<boost::shared_ptr<detail::shared_state_base> > waiter_type;
+
+    Iterator begin_;
+    Iterator end_;
+    waiter_type waiter_;
+
+  public:
+    typedef typename waiter_type::count_type size_type;
+
+    wait_for_any_queue(Iterator begin, Iterator end) :
+      begin_(begin), end_(end)
+    {
+      waiter_.reserve(std::distance(begin, end));
+      for (Iterator current = begin; current != end; ++current)
+      {
+        waiter_.add(*current);
+      }
+    }
+
+    size_type pending() const
+    {
+      return waiter_.pending();
+    }
+
+    bool empty() const
+    {
+      return waiter_.pending() == 0;
+    }
+
+    // Blocks until one of the futures not yet returned is ready and returns
+    // an iterator to it, or returns end if every future has been returned.
+    Iterator wait_next()
+    {
+      if (empty()) return end_;
+      Iterator it = begin_;
+      std::advance(it, waiter_.wait());
+      return it;
+    }
+  };
 }
 
 #endif // header
@@ -0,0 +1,38 @@
+#ifndef BOOST_THREAD_MCS_MUTEX_HPP
+#define BOOST_THREAD_MCS_MUTEX_HPP
+
+//  mcs_mutex.hpp
+//
+//  (C) Copyright 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/thread/detail/platform.hpp>
+#if defined(BOOST_THREAD_PLATFORM_PTHREAD)
+#include <boost/thread/pthread/mcs_mutex.hpp>
+#include <boost/thread/lockable_traits.hpp>
+
+namespace boost
+{
+  namespace sync
+  {
+#ifdef BOOST_THREAD_NO_AUTO_DETECT_MUTEX_TYPES
+    template<>
+    struct is_basic_lockable<mcs_mutex>
+    {
+      BOOST_STATIC_CONSTANT(bool, value = true);
+    };
+    template<>
+    struct is_lockable<mcs_mutex>
+    {
+      BOOST_STATIC_CONSTANT(bool, value = true);
+    };
+#endif
+  }
+}
+#endif
+// mcs_mutex is not provided on Windows yet.
+
+#endif
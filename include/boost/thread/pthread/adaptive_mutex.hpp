@@ -0,0 +1,200 @@
+#ifndef BOOST_THREAD_PTHREAD_ADAPTIVE_MUTEX_HPP
+#define BOOST_THREAD_PTHREAD_ADAPTIVE_MUTEX_HPP
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/thread/detail/config.hpp>
+#include <boost/thread/detail/delete.hpp>
+#include <boost/thread/detail/backoff.hpp>
+#include <boost/thread/pthread/futex.hpp>
+#if defined BOOST_THREAD_PROVIDES_NESTED_LOCKS
+#include <boost/thread/lock_types.hpp>
+#endif
+#if defined BOOST_THREAD_USES_DATETIME
+#include <boost/thread/thread_time.hpp>
+#include <boost/thread/xtime.hpp>
+#endif
+#ifdef BOOST_THREAD_USES_CHRONO
+#include <boost/chrono/system_clocks.hpp>
+#endif
+#include <boost/atomic.hpp>
+#include <boost/assert.hpp>
+#include <algorithm>
+
+#ifndef BOOST_THREAD_ADAPTIVE_MUTEX_MAX_SPIN
+#define BOOST_THREAD_ADAPTIVE_MUTEX_MAX_SPIN 2048
+#endif
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+  /**
+   * Mutex for short critical sections: a thread which finds it locked spins for a while, the mutex being often
+   * unlocked before the thread would have been parked and woken up again, and only then parks on a futex.
+   *
+   * The spinning budget, counted in calls to detail::cpu_relax(), adapts to the recent hold times: it is twice the
+   * moving average of the spinning that was needed to acquire the mutex, so that it grows while the mutex is held a
+   * bit longer, and it shrinks each time spinning fails, so that the threads don't burn their time slice when the
+   * mutex is held for long or when there are more threads than cores.
+   */
+  class BOOST_THREAD_CAPABILITY("mutex") adaptive_mutex
+  {
+  private:
+    // 0: unlocked, 1: locked, 2: locked and some threads can be parked.
+    detail::futex_word state_;
+    atomic<unsigned> spin_estimate_;
+    unsigned max_spin_;
+
+    static const unsigned min_spin = 16;
+    static const unsigned max_pause = 32;
+
+    bool try_acquire()
+    {
+      uint32_t expected = 0;
+      return state_.compare_exchange_strong(expected, 1, memory_order_acquire, memory_order_relaxed);
+    }
+
+    // Returns: whether the mutex has been acquired while spinning.
+    bool spin()
+    {
+      if (max_spin_ == 0) return false;
+      unsigned const estimate = spin_estimate_.load(memory_order_relaxed);
+      unsigned const budget = (std::min)(max_spin_, 2 * estimate + min_spin);
+      detail::spin_backoff backoff(max_pause);
+      unsigned spun = 0;
+      while (spun < budget)
+      {
+        spun += backoff.pause();
+        if (state_.load(memory_order_relaxed) == 0 && try_acquire())
+        {
+          // the estimate is shared by all the threads, which can lose some of the updates.
+          spin_estimate_.store(spun > estimate ? estimate + (spun - estimate + 7) / 8 : estimate - (estimate - spun) / 8,
+              memory_order_relaxed);
+          return true;
+        }
+      }
+      spin_estimate_.store(estimate - (estimate + 7) / 8, memory_order_relaxed);
+      return false;
+    }
+
+    void park()
+    {
+      uint32_t s = state_.exchange(2, memory_order_acquire);
+      while (s != 0)
+      {
+        detail::futex_wait(state_, 2);
+        s = state_.exchange(2, memory_order_acquire);
+      }
+    }
+
+    template <class Deadline>
+    bool lock_until(Deadline const& deadline)
+    {
+      if (try_acquire()) return true;
+      if (deadline.remaining() <= detail::platform_duration::zero()) return false;
+      if (spin()) return true;
+      uint32_t s = state_.exchange(2, memory_order_acquire);
+      while (s != 0)
+      {
+        // a thread timing out leaves the state to 2, and the next unlock wakes up a thread for nothing.
+        if (! detail::futex_wait_until(state_, 2, deadline)) return false;
+        s = state_.exchange(2, memory_order_acquire);
+      }
+      return true;
+    }
+
+  public:
+    BOOST_THREAD_NO_COPYABLE(adaptive_mutex)
+
+    /**
+     * \b Effects: Constructs an unlocked mutex whose threads spin at most \c max_spin calls to detail::cpu_relax()
+     * before parking. If \c max_spin is 0, the threads park as soon as the mutex is locked.
+     */
+    explicit adaptive_mutex(unsigned max_spin = BOOST_THREAD_ADAPTIVE_MUTEX_MAX_SPIN) BOOST_NOEXCEPT :
+      state_(0), spin_estimate_(0), max_spin_(max_spin)
+    {
+    }
+
+    ~adaptive_mutex()
+    {
+    }
+
+    /**
+     * \b Returns: The maximal spinning budget.
+     */
+    unsigned max_spin() const BOOST_NOEXCEPT
+    {
+      return max_spin_;
+    }
+
+    void lock() BOOST_THREAD_ACQUIRE()
+    {
+      if (try_acquire()) return;
+      if (spin()) return;
+      park();
+    }
+
+    bool try_lock() BOOST_THREAD_TRY_ACQUIRE(true)
+    {
+      return try_acquire();
+    }
+
+    void unlock() BOOST_THREAD_RELEASE()
+    {
+      uint32_t const s = state_.exchange(0, memory_order_release);
+      BOOST_ASSERT(s != 0);
+      if (s == 2) detail::futex_wake_one(state_);
+    }
+
+#if defined BOOST_THREAD_USES_DATETIME
+    bool timed_lock(system_time const& abs_time)
+    {
+      return lock_until(detail::futex_real_deadline(abs_time));
+    }
+    template<typename TimeDuration>
+    bool timed_lock(TimeDuration const & relative_time)
+    {
+      if (relative_time.is_pos_infinity())
+      {
+        lock();
+        return true;
+      }
+      if (relative_time.is_special())
+      {
+        return true;
+      }
+      return lock_until(detail::futex_relative_deadline(detail::platform_duration(relative_time)));
+    }
+    bool timed_lock(boost::xtime const & absolute_time)
+    {
+      return timed_lock(system_time(absolute_time));
+    }
+#endif
+#ifdef BOOST_THREAD_USES_CHRONO
+    template <class Rep, class Period>
+    bool try_lock_for(const chrono::duration<Rep, Period>& rel_time)
+    {
+      return try_lock_until(chrono::steady_clock::now() + rel_time);
+    }
+    template <class Clock, class Duration>
+    bool try_lock_until(const chrono::time_point<Clock, Duration>& t)
+    {
+      return lock_until(detail::futex_chrono_deadline<Clock, Duration>(t));
+    }
+#endif
+
+#if defined BOOST_THREAD_PROVIDES_NESTED_LOCKS
+    typedef unique_lock<adaptive_mutex> scoped_timed_lock;
+    typedef detail::try_lock_wrapper<adaptive_mutex> scoped_try_lock;
+    typedef scoped_timed_lock scoped_lock;
+#endif
+  };
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
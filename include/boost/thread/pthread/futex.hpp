@@ -0,0 +1,329 @@
+#ifndef BOOST_THREAD_PTHREAD_FUTEX_HPP
+#define BOOST_THREAD_PTHREAD_FUTEX_HPP
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/thread/detail/config.hpp>
+#include <boost/thread/detail/platform_time.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/assert.hpp>
+#include <boost/atomic.hpp>
+#if defined BOOST_THREAD_USES_DATETIME
+#include <boost/thread/thread_time.hpp>
+#endif
+#ifdef BOOST_THREAD_USES_CHRONO
+#include <boost/chrono/system_clocks.hpp>
+#include <boost/chrono/ceil.hpp>
+#endif
+#include <algorithm>
+#include <climits>
+
+#if defined(__linux__) && ! defined(BOOST_THREAD_DONT_USE_FUTEX)
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include <errno.h>
+#define BOOST_THREAD_USES_FUTEX
+#else
+#include <boost/thread/pthread/pthread_helpers.hpp>
+#include <boost/preprocessor/repetition/enum.hpp>
+#include <pthread.h>
+#include <errno.h>
+#endif
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+  namespace detail
+  {
+    typedef atomic<uint32_t> futex_word;
+
+#if defined BOOST_THREAD_USES_FUTEX
+    BOOST_STATIC_ASSERT_MSG(sizeof(futex_word) == sizeof(uint32_t), "Boost.Thread: unsupported platform");
+
+    inline long futex_call(futex_word& word, int op, uint32_t val, timespec const* timeout, uint32_t val3 = 0) BOOST_NOEXCEPT
+    {
+      return ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), op, val, timeout, 0, val3);
+    }
+
+    /**
+     * Blocks the calling thread while \c word contains \c expected, until it is woken up by futex_wake_one/futex_wake_all.
+     * The wait can end spuriously, so that the caller must check its condition again.
+     */
+    inline void futex_wait(futex_word& word, uint32_t expected) BOOST_NOEXCEPT
+    {
+      futex_call(word, FUTEX_WAIT_PRIVATE, expected, 0);
+    }
+
+    /**
+     * As futex_wait, but the wait ends at the latest after the relative time \c d.
+     */
+    inline void futex_wait_for(futex_word& word, uint32_t expected, platform_duration const& d) BOOST_NOEXCEPT
+    {
+      if (d <= platform_duration::zero()) return;
+      // the relative timeout of FUTEX_WAIT is measured on CLOCK_MONOTONIC.
+      futex_call(word, FUTEX_WAIT_PRIVATE, expected, &d.getTs());
+    }
+
+    // Returns: false if the wait has timed out.
+    inline bool futex_wait_bitset(futex_word& word, uint32_t expected, timespec const& abs_time, int clock) BOOST_NOEXCEPT
+    {
+      return ! (futex_call(word, FUTEX_WAIT_BITSET_PRIVATE | clock, expected, &abs_time, FUTEX_BITSET_MATCH_ANY) == -1
+                && errno == ETIMEDOUT);
+    }
+
+    /**
+     * As futex_wait, but the wait ends at the latest at the absolute time \c t, measured by the kernel on
+     * CLOCK_REALTIME, so that the adjustments of the system clock are taken in account without polling.
+     * Returns: false if the wait has timed out.
+     */
+    inline bool futex_wait_until(futex_word& word, uint32_t expected, real_platform_timepoint const& t) BOOST_NOEXCEPT
+    {
+      return futex_wait_bitset(word, expected, t.getTs(), FUTEX_CLOCK_REALTIME);
+    }
+
+#if defined BOOST_THREAD_HAS_MONO_CLOCK
+    /**
+     * As futex_wait, but the wait ends at the latest at the absolute time \c t, measured on CLOCK_MONOTONIC.
+     * Returns: false if the wait has timed out.
+     */
+    inline bool futex_wait_until(futex_word& word, uint32_t expected, mono_platform_timepoint const& t) BOOST_NOEXCEPT
+    {
+      return futex_wait_bitset(word, expected, t.getTs(), 0);
+    }
+#endif
+
+    inline void futex_wake_one(futex_word& word) BOOST_NOEXCEPT
+    {
+      futex_call(word, FUTEX_WAKE_PRIVATE, 1, 0);
+    }
+
+    inline void futex_wake_all(futex_word& word) BOOST_NOEXCEPT
+    {
+      futex_call(word, FUTEX_WAKE_PRIVATE, INT_MAX, 0);
+    }
+#else
+    // Without futex, the waiters are parked on a condition variable chosen by hashing the address of the word.
+    struct futex_bucket
+    {
+      pthread_mutex_t m;
+      pthread_cond_t cv;
+    };
+
+#define BOOST_THREAD_FUTEX_BUCKET(z, n, data) { PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER }
+
+    inline futex_bucket& futex_bucket_of(futex_word const& word) BOOST_NOEXCEPT
+    {
+      static futex_bucket buckets[16] = { BOOST_PP_ENUM(16, BOOST_THREAD_FUTEX_BUCKET, ~) };
+      return buckets[(reinterpret_cast<std::size_t>(&word) / sizeof(futex_word)) % 16];
+    }
+
+#undef BOOST_THREAD_FUTEX_BUCKET
+
+    inline void futex_wait(futex_word& word, uint32_t expected) BOOST_NOEXCEPT
+    {
+      futex_bucket& b = futex_bucket_of(word);
+      BOOST_VERIFY(!posix::pthread_mutex_lock(&b.m));
+      if (word.load(memory_order_relaxed) == expected)
+      {
+        posix::pthread_cond_wait(&b.cv, &b.m);
+      }
+      BOOST_VERIFY(!posix::pthread_mutex_unlock(&b.m));
+    }
+
+    inline void futex_wait_for(futex_word& word, uint32_t expected, platform_duration const& d) BOOST_NOEXCEPT
+    {
+      if (d <= platform_duration::zero()) return;
+      // the condition variables of the buckets use the default clock.
+      real_platform_timepoint const ts(real_platform_clock::now() + d);
+      futex_bucket& b = futex_bucket_of(word);
+      BOOST_VERIFY(!posix::pthread_mutex_lock(&b.m));
+      if (word.load(memory_order_relaxed) == expected)
+      {
+        ::pthread_cond_timedwait(&b.cv, &b.m, &ts.getTs());
+      }
+      BOOST_VERIFY(!posix::pthread_mutex_unlock(&b.m));
+    }
+
+    inline bool futex_wait_until(futex_word& word, uint32_t expected, real_platform_timepoint const& t) BOOST_NOEXCEPT
+    {
+      int res = 0;
+      futex_bucket& b = futex_bucket_of(word);
+      BOOST_VERIFY(!posix::pthread_mutex_lock(&b.m));
+      if (word.load(memory_order_relaxed) == expected)
+      {
+        res = ::pthread_cond_timedwait(&b.cv, &b.m, &t.getTs());
+      }
+      BOOST_VERIFY(!posix::pthread_mutex_unlock(&b.m));
+      return res != ETIMEDOUT;
+    }
+
+#if defined BOOST_THREAD_HAS_MONO_CLOCK
+    inline bool futex_wait_until(futex_word& word, uint32_t expected, mono_platform_timepoint const& t) BOOST_NOEXCEPT
+    {
+      platform_duration const d = t - mono_platform_clock::now();
+      if (d <= platform_duration::zero()) return false;
+      futex_wait_for(word, expected, d);
+      return true;
+    }
+#endif
+
+    inline void futex_wake_all(futex_word& word) BOOST_NOEXCEPT
+    {
+      futex_bucket& b = futex_bucket_of(word);
+      BOOST_VERIFY(!posix::pthread_mutex_lock(&b.m));
+      BOOST_VERIFY(!posix::pthread_cond_broadcast(&b.cv));
+      BOOST_VERIFY(!posix::pthread_mutex_unlock(&b.m));
+    }
+
+    inline void futex_wake_one(futex_word& word) BOOST_NOEXCEPT
+    {
+      // the bucket can be shared with other words, whose waiters must not consume the notification.
+      futex_wake_all(word);
+    }
+#endif
+
+    // The deadlines of the timed waits, whose remaining() function returns the time to wait before checking the
+    // deadline again.
+#if defined BOOST_THREAD_USES_DATETIME
+    struct futex_real_deadline
+    {
+      real_platform_timepoint ts;
+
+      explicit futex_real_deadline(system_time const& abs_time) : ts(abs_time) {}
+      explicit futex_real_deadline(real_platform_timepoint const& abs_time) : ts(abs_time) {}
+
+      platform_duration remaining() const
+      {
+        // the system clock can be adjusted while waiting.
+        return (std::min)(platform_duration(ts - real_platform_clock::now()),
+                          platform_milliseconds(BOOST_THREAD_POLL_INTERVAL_MILLISECONDS));
+      }
+    };
+#if defined BOOST_THREAD_HAS_MONO_CLOCK
+    struct futex_mono_deadline
+    {
+      mono_platform_timepoint ts;
+
+      explicit futex_mono_deadline(platform_duration const& d) : ts(mono_platform_clock::now() + d) {}
+
+      platform_duration remaining() const
+      {
+        return ts - mono_platform_clock::now();
+      }
+    };
+    typedef futex_mono_deadline futex_relative_deadline;
+#else
+    struct futex_relative_deadline : futex_real_deadline
+    {
+      explicit futex_relative_deadline(platform_duration const& d) :
+        futex_real_deadline(real_platform_clock::now() + d) {}
+    };
+#endif
+#endif
+#ifdef BOOST_THREAD_USES_CHRONO
+    template <class Clock, class Duration>
+    struct futex_chrono_deadline
+    {
+      typedef typename common_type<Duration, typename Clock::duration>::type common_duration;
+      chrono::time_point<Clock, Duration> abs_time;
+
+      explicit futex_chrono_deadline(chrono::time_point<Clock, Duration> const& t) : abs_time(t) {}
+
+      platform_duration remaining() const
+      {
+        common_duration d(abs_time - Clock::now());
+        if (d <= common_duration::zero()) return platform_duration::zero();
+        if (! Clock::is_steady)
+        {
+          // the clock can be adjusted while waiting.
+          d = (std::min)(d, common_duration(chrono::milliseconds(BOOST_THREAD_POLL_INTERVAL_MILLISECONDS)));
+        }
+        return platform_duration(d);
+      }
+    };
+#endif
+
+    /**
+     * As futex_wait, but the wait ends at the latest when \c deadline expires.
+     * Returns: false if the deadline had expired before waiting.
+     */
+    template <class Deadline>
+    bool futex_wait_until(futex_word& word, uint32_t expected, Deadline const& deadline) BOOST_NOEXCEPT
+    {
+      platform_duration d = deadline.remaining();
+      if (d <= platform_duration::zero()) return false;
+      futex_wait_for(word, expected, d);
+      return true;
+    }
+
+    /**
+     * Mutex on a futex word: 0 if unlocked, 1 if locked, 2 if locked and some threads can be waiting (U. Drepper,
+     * "Futexes Are Tricky"). Locking and unlocking an uncontended mutex is a single atomic operation.
+     */
+    class futex_mutex
+    {
+      futex_word state_;
+
+    public:
+      futex_mutex() BOOST_NOEXCEPT : state_(0) {}
+
+      bool try_lock() BOOST_NOEXCEPT
+      {
+        uint32_t expected = 0;
+        return state_.compare_exchange_strong(expected, 1, memory_order_acquire, memory_order_relaxed);
+      }
+
+      void lock() BOOST_NOEXCEPT
+      {
+        if (try_lock()) return;
+        uint32_t s = state_.exchange(2, memory_order_acquire);
+        while (s != 0)
+        {
+          futex_wait(state_, 2);
+          s = state_.exchange(2, memory_order_acquire);
+        }
+      }
+
+      /**
+       * \b Effects: As lock(), but gives up when \c t, an absolute time or a deadline, expires.
+       *
+       * \b Returns: whether the mutex has been locked.
+       */
+      template <class Timepoint>
+      bool try_lock_until(Timepoint const& t) BOOST_NOEXCEPT
+      {
+        if (try_lock()) return true;
+        uint32_t s = state_.exchange(2, memory_order_acquire);
+        while (s != 0)
+        {
+          // the state is left to 2 on timeout, and the next unlock() wakes up a thread for nothing.
+          if (! futex_wait_until(state_, 2, t)) return false;
+          s = state_.exchange(2, memory_order_acquire);
+        }
+        return true;
+      }
+
+      void unlock() BOOST_NOEXCEPT
+      {
+        uint32_t const s = state_.exchange(0, memory_order_release);
+        BOOST_ASSERT(s != 0);
+        if (s == 2) futex_wake_one(state_);
+      }
+
+      futex_word* native_handle() BOOST_NOEXCEPT
+      {
+        return &state_;
+      }
+    };
+  }
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
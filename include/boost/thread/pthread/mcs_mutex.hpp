@@ -0,0 +1,159 @@
+#ifndef BOOST_THREAD_PTHREAD_MCS_MUTEX_HPP
+#define BOOST_THREAD_PTHREAD_MCS_MUTEX_HPP
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/thread/detail/config.hpp>
+#include <boost/thread/detail/delete.hpp>
+#include <boost/thread/detail/backoff.hpp>
+#include <boost/thread/pthread/futex.hpp>
+#if defined BOOST_THREAD_PROVIDES_NESTED_LOCKS
+#include <boost/thread/lock_types.hpp>
+#endif
+#include <boost/atomic.hpp>
+#include <boost/assert.hpp>
+
+#ifndef BOOST_THREAD_MCS_MUTEX_MAX_SPIN
+#define BOOST_THREAD_MCS_MUTEX_MAX_SPIN 2048
+#endif
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+  /**
+   * Queue lock (Mellor-Crummey and Scott) for highly contended mutexes.
+   *
+   * The waiting threads are linked in a queue, each one spinning on its own node, so that the only cache line
+   * written by all the threads is the tail of the queue, once per lock(). The owner hands the mutex over to the
+   * next thread of the queue when unlocking it, so that the threads get the mutex in FIFO order, without barging.
+   * A waiter which has not been granted the mutex after spinning for a while parks on its node.
+   *
+   * The lock interface has no node parameter: as in the K42 variant of the algorithm, the mutex contains the node
+   * of its owner, and the node of a waiter lives on its stack while it is waiting, its successor in the queue being
+   * moved to the mutex when it is granted the ownership.
+   */
+  class BOOST_THREAD_CAPABILITY("mutex") mcs_mutex
+  {
+  private:
+    struct node
+    {
+      atomic<node*> next;
+      // 1: waiting, 2: waiting and parked, 0: granted.
+      detail::futex_word wait;
+      char pad[64 - sizeof(atomic<node*>) - sizeof(detail::futex_word)];
+
+      node() : next(0), wait(1) {}
+    };
+
+    // the last thread of the queue, head_ if the owner has no successor, 0 if the mutex is unlocked.
+    atomic<node*> tail_;
+    // the successor of the owner in head_.next.
+    node head_;
+    unsigned max_spin_;
+
+    void wait_for_grant(node& me)
+    {
+      detail::spin_backoff backoff;
+      for (unsigned spun = 0; spun < max_spin_; spun += backoff.pause())
+      {
+        if (me.wait.load(memory_order_acquire) == 0) return;
+      }
+      if (me.wait.exchange(2, memory_order_acquire) == 0) return;
+      while (me.wait.load(memory_order_acquire) != 0)
+      {
+        detail::futex_wait(me.wait, 2);
+      }
+    }
+
+    static node* wait_for_next(node& n)
+    {
+      node* succ;
+      detail::spin_backoff backoff;
+      while ((succ = n.next.load(memory_order_acquire)) == 0)
+      {
+        backoff.pause();
+      }
+      return succ;
+    }
+
+  public:
+    BOOST_THREAD_NO_COPYABLE(mcs_mutex)
+
+    /**
+     * \b Effects: Constructs an unlocked mutex whose waiters spin at most \c max_spin calls to detail::cpu_relax()
+     * before parking. If \c max_spin is 0, the waiters park as soon as they are queued.
+     */
+    explicit mcs_mutex(unsigned max_spin = BOOST_THREAD_MCS_MUTEX_MAX_SPIN) BOOST_NOEXCEPT :
+      tail_(0), max_spin_(max_spin)
+    {
+    }
+
+    ~mcs_mutex()
+    {
+    }
+
+    void lock() BOOST_THREAD_ACQUIRE()
+    {
+      node* prev = tail_.load(memory_order_relaxed);
+      for (;;)
+      {
+        if (prev == 0)
+        {
+          if (tail_.compare_exchange_weak(prev, &head_, memory_order_acquire, memory_order_relaxed)) return;
+          continue;
+        }
+        node me;
+        if (! tail_.compare_exchange_weak(prev, &me, memory_order_acq_rel, memory_order_relaxed)) continue;
+        prev->next.store(&me, memory_order_release);
+        wait_for_grant(me);
+
+        // me is the owner's node until its successor, if any, is moved to head_.
+        node* succ = me.next.load(memory_order_acquire);
+        if (succ == 0)
+        {
+          head_.next.store(0, memory_order_relaxed);
+          node* expected = &me;
+          if (tail_.compare_exchange_strong(expected, &head_, memory_order_acq_rel, memory_order_relaxed)) return;
+          // a thread has been queued behind me, but has not linked its node yet.
+          succ = wait_for_next(me);
+        }
+        head_.next.store(succ, memory_order_relaxed);
+        return;
+      }
+    }
+
+    bool try_lock() BOOST_THREAD_TRY_ACQUIRE(true)
+    {
+      node* expected = 0;
+      return tail_.compare_exchange_strong(expected, &head_, memory_order_acquire, memory_order_relaxed);
+    }
+
+    void unlock() BOOST_THREAD_RELEASE()
+    {
+      BOOST_ASSERT(tail_.load(memory_order_relaxed) != 0);
+      node* succ = head_.next.load(memory_order_acquire);
+      if (succ == 0)
+      {
+        node* expected = &head_;
+        if (tail_.compare_exchange_strong(expected, 0, memory_order_release, memory_order_relaxed)) return;
+        succ = wait_for_next(head_);
+      }
+      // once granted, the successor can return from lock() and its node be gone, so that the futex can be woken up
+      // at an address which is no more waited on, which is harmless.
+      if (succ->wait.exchange(0, memory_order_release) == 2) detail::futex_wake_one(succ->wait);
+    }
+
+#if defined BOOST_THREAD_PROVIDES_NESTED_LOCKS
+    typedef unique_lock<mcs_mutex> scoped_lock;
+    typedef detail::try_lock_wrapper<mcs_mutex> scoped_try_lock;
+#endif
+  };
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
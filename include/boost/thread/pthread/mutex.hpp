@@ -29,6 +29,12 @@
 #include <boost/chrono/ceil.hpp>
 #endif
 #include <boost/thread/detail/delete.hpp>
+#if ! defined BOOST_THREAD_USES_PTHREAD_TIMEDLOCK
+#include <boost/thread/pthread/futex.hpp>
+#if defined BOOST_THREAD_USES_FUTEX
+#define BOOST_THREAD_TIMED_MUTEX_USES_FUTEX
+#endif
+#endif
 
 
 #include <boost/config/abi_prefix.hpp>
@@ -99,13 +105,25 @@ namespace boost
     class timed_mutex
     {
     private:
+#if defined BOOST_THREAD_TIMED_MUTEX_USES_FUTEX
+        detail::futex_mutex m;
+#else
         pthread_mutex_t m;
 #ifndef BOOST_THREAD_USES_PTHREAD_TIMEDLOCK
         pthread_cond_t cond;
         bool is_locked;
+#endif
 #endif
     public:
         BOOST_THREAD_NO_COPYABLE(timed_mutex)
+#if defined BOOST_THREAD_TIMED_MUTEX_USES_FUTEX
+        timed_mutex()
+        {
+        }
+        ~timed_mutex()
+        {
+        }
+#else
         timed_mutex()
         {
             int const res=posix::pthread_mutex_init(&m);
@@ -130,6 +148,7 @@ namespace boost
             BOOST_VERIFY(!posix::pthread_cond_destroy(&cond));
 #endif
         }
+#endif
 
 #if defined BOOST_THREAD_USES_DATETIME
         template<typename TimeDuration>
@@ -164,7 +183,32 @@ namespace boost
             return timed_lock(system_time(absolute_time));
         }
 #endif
-#ifdef BOOST_THREAD_USES_PTHREAD_TIMEDLOCK
+#if defined BOOST_THREAD_TIMED_MUTEX_USES_FUTEX
+        void lock()
+        {
+            m.lock();
+        }
+
+        void unlock()
+        {
+            m.unlock();
+        }
+
+        bool try_lock()
+        {
+            return m.try_lock();
+        }
+
+    private:
+        // the deadline is measured by the kernel on the clock of the time point, without polling.
+        template <class Timepoint>
+        bool do_try_lock_until(Timepoint const &timeout)
+        {
+            return m.try_lock_until(timeout);
+        }
+    public:
+
+#elif defined BOOST_THREAD_USES_PTHREAD_TIMEDLOCK
         void lock()
         {
             int res = posix::pthread_mutex_lock(&m);
@@ -256,7 +300,7 @@ namespace boost
         bool timed_lock(system_time const & abs_time)
         {
             const detail::real_platform_timepoint ts(abs_time);
-#if defined BOOST_THREAD_INTERNAL_CLOCK_IS_MONO
+#if defined BOOST_THREAD_INTERNAL_CLOCK_IS_MONO && ! defined BOOST_THREAD_TIMED_MUTEX_USES_FUTEX
             detail::platform_duration d(ts - detail::real_platform_clock::now());
             d = (std::min)(d, detail::platform_milliseconds(BOOST_THREAD_POLL_INTERVAL_MILLISECONDS));
             while ( ! do_try_lock_until(detail::internal_platform_clock::now() + d) )
@@ -297,14 +341,30 @@ namespace boost
           detail::internal_platform_timepoint ts(t);
           return do_try_lock_until(ts);
         }
+#if defined BOOST_THREAD_TIMED_MUTEX_USES_FUTEX && defined BOOST_THREAD_INTERNAL_CLOCK_IS_MONO
+        template <class Duration>
+        bool try_lock_until(const chrono::time_point<chrono::system_clock, Duration>& t)
+        {
+          detail::real_platform_timepoint ts(t);
+          return do_try_lock_until(ts);
+        }
+#endif
 #endif
 
 #define BOOST_THREAD_DEFINES_TIMED_MUTEX_NATIVE_HANDLE
+#if defined BOOST_THREAD_TIMED_MUTEX_USES_FUTEX
+        typedef detail::futex_word* native_handle_type;
+        native_handle_type native_handle()
+        {
+            return m.native_handle();
+        }
+#else
         typedef pthread_mutex_t* native_handle_type;
         native_handle_type native_handle()
         {
             return &m;
         }
+#endif
 
 #if defined BOOST_THREAD_PROVIDES_NESTED_LOCKS
         typedef unique_lock<timed_mutex> scoped_timed_lock;
@@ -38,6 +38,13 @@
 #define BOOST_USE_PTHREAD_RECURSIVE_TIMEDLOCK
 #endif
 
+#if ! defined BOOST_USE_PTHREAD_RECURSIVE_TIMEDLOCK
+#include <boost/thread/pthread/futex.hpp>
+#if defined BOOST_THREAD_USES_FUTEX
+#define BOOST_THREAD_RECURSIVE_TIMED_MUTEX_USES_FUTEX
+#endif
+#endif
+
 #include <boost/config/abi_prefix.hpp>
 
 namespace boost
@@ -181,15 +188,30 @@ namespace boost
     class recursive_timed_mutex
     {
     private:
+#if defined BOOST_THREAD_RECURSIVE_TIMED_MUTEX_USES_FUTEX
+        detail::futex_mutex m;
+        // only compared to pthread_self(), so that only the owner sees its own identifier.
+        atomic<pthread_t> owner;
+        unsigned count;
+#else
         pthread_mutex_t m;
 #ifndef BOOST_USE_PTHREAD_RECURSIVE_TIMEDLOCK
         pthread_cond_t cond;
         bool is_locked;
         pthread_t owner;
         unsigned count;
+#endif
 #endif
     public:
         BOOST_THREAD_NO_COPYABLE(recursive_timed_mutex)
+#if defined BOOST_THREAD_RECURSIVE_TIMED_MUTEX_USES_FUTEX
+        recursive_timed_mutex() : owner(pthread_t()), count(0)
+        {
+        }
+        ~recursive_timed_mutex()
+        {
+        }
+#else
         recursive_timed_mutex()
         {
 #ifdef BOOST_USE_PTHREAD_RECURSIVE_TIMEDLOCK
@@ -236,6 +258,7 @@ namespace boost
             BOOST_VERIFY(!posix::pthread_cond_destroy(&cond));
 #endif
         }
+#endif
 
 #if defined BOOST_THREAD_USES_DATETIME
         template<typename TimeDuration>
@@ -267,7 +290,63 @@ namespace boost
         }
 #endif
 
-#ifdef BOOST_USE_PTHREAD_RECURSIVE_TIMEDLOCK
+#if defined BOOST_THREAD_RECURSIVE_TIMED_MUTEX_USES_FUTEX
+        void lock()
+        {
+            if (pthread_equal(owner.load(memory_order_relaxed), pthread_self()))
+            {
+                ++count;
+                return;
+            }
+            m.lock();
+            set_owner();
+        }
+
+        void unlock()
+        {
+            BOOST_ASSERT(pthread_equal(owner.load(memory_order_relaxed), pthread_self()));
+            if(!--count)
+            {
+                owner.store(pthread_t(), memory_order_relaxed);
+                m.unlock();
+            }
+        }
+
+        bool try_lock() BOOST_NOEXCEPT
+        {
+            if (pthread_equal(owner.load(memory_order_relaxed), pthread_self()))
+            {
+                ++count;
+                return true;
+            }
+            if (! m.try_lock()) return false;
+            set_owner();
+            return true;
+        }
+
+    private:
+        void set_owner()
+        {
+            owner.store(pthread_self(), memory_order_relaxed);
+            count = 1;
+        }
+
+        // the deadline is measured by the kernel on the clock of the time point, without polling.
+        template <class Timepoint>
+        bool do_try_lock_until(Timepoint const &timeout)
+        {
+            if (pthread_equal(owner.load(memory_order_relaxed), pthread_self()))
+            {
+                ++count;
+                return true;
+            }
+            if (! m.try_lock_until(timeout)) return false;
+            set_owner();
+            return true;
+        }
+    public:
+
+#elif defined BOOST_USE_PTHREAD_RECURSIVE_TIMEDLOCK
         void lock()
         {
             BOOST_VERIFY(!posix::pthread_mutex_lock(&m));
@@ -371,7 +450,7 @@ namespace boost
         bool timed_lock(system_time const & abs_time)
         {
             const detail::real_platform_timepoint ts(abs_time);
-#if defined BOOST_THREAD_INTERNAL_CLOCK_IS_MONO
+#if defined BOOST_THREAD_INTERNAL_CLOCK_IS_MONO && ! defined BOOST_THREAD_RECURSIVE_TIMED_MUTEX_USES_FUTEX
             detail::platform_duration d(ts - detail::real_platform_clock::now());
             d = (std::min)(d, detail::platform_milliseconds(BOOST_THREAD_POLL_INTERVAL_MILLISECONDS));
             while ( ! do_try_lock_until(detail::internal_platform_clock::now() + d) )
@@ -413,14 +492,30 @@ namespace boost
           detail::internal_platform_timepoint ts(t);
           return do_try_lock_until(ts);
         }
+#if defined BOOST_THREAD_RECURSIVE_TIMED_MUTEX_USES_FUTEX && defined BOOST_THREAD_INTERNAL_CLOCK_IS_MONO
+        template <class Duration>
+        bool try_lock_until(const chrono::time_point<chrono::system_clock, Duration>& t)
+        {
+          detail::real_platform_timepoint ts(t);
+          return do_try_lock_until(ts);
+        }
+#endif
 #endif
 
 #define BOOST_THREAD_DEFINES_RECURSIVE_TIMED_MUTEX_NATIVE_HANDLE
+#if defined BOOST_THREAD_RECURSIVE_TIMED_MUTEX_USES_FUTEX
+        typedef detail::futex_word* native_handle_type;
+        native_handle_type native_handle()
+        {
+            return m.native_handle();
+        }
+#else
         typedef pthread_mutex_t* native_handle_type;
         native_handle_type native_handle()
         {
             return &m;
         }
+#endif
 
 #if defined BOOST_THREAD_PROVIDES_NESTED_LOCKS
         typedef unique_lock<recursive_timed_mutex> scoped_timed_lock;
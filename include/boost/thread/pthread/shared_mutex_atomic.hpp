@@ -0,0 +1,467 @@
+#ifndef BOOST_THREAD_PTHREAD_SHARED_MUTEX_ATOMIC_HPP
+#define BOOST_THREAD_PTHREAD_SHARED_MUTEX_ATOMIC_HPP
+
+//  (C) Copyright 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/thread/detail/config.hpp>
+#include <boost/thread/pthread/futex.hpp>
+#include <boost/thread/detail/delete.hpp>
+#include <boost/assert.hpp>
+#include <boost/cstdint.hpp>
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+    /**
+     * The reader count and the writer, upgrade and waiting writer bits are packed in a single atomic word, so that an
+     * uncontended lock_shared/unlock_shared is a single CAS/fetch_sub on this word.
+     * A thread which must wait sets the parked bit and sleeps on the word; the thread releasing the mutex wakes the
+     * parked threads only if this bit is set.
+     *
+     * As with the mutex based implementation, a waiting writer (or an upgrader waiting to become the writer) blocks the
+     * new readers and upgraders, so that the writers are not starved.
+     */
+    class shared_mutex
+    {
+    private:
+        typedef uint32_t state_type;
+
+        static const state_type writer = 0x80000000u;
+        static const state_type upgrader = 0x40000000u;
+        static const state_type writer_waiting = 0x20000000u;
+        static const state_type parked = 0x10000000u;
+        /// the number of threads owning the mutex in shared or upgrade mode.
+        static const state_type readers = 0x0FFFFFFFu;
+
+        enum acquisition
+        {
+            shared_acq,
+            upgrade_acq,
+            exclusive_acq,
+            upgrade_to_exclusive_acq,
+            shared_to_exclusive_acq,
+            shared_to_upgrade_acq
+        };
+
+        detail::futex_word state;
+
+        // Returns: whether the acquisition a is possible in the state s, next being the state after it.
+        static bool can_acquire(acquisition a, state_type s, state_type& next)
+        {
+            switch (a)
+            {
+            case shared_acq:
+                BOOST_ASSERT((s & readers) != readers);
+                next = s + 1;
+                return ! (s & (writer | writer_waiting));
+            case upgrade_acq:
+                next = (s + 1) | upgrader;
+                return ! (s & (writer | writer_waiting | upgrader));
+            case exclusive_acq:
+                next = (s | writer) & ~writer_waiting;
+                return ! (s & (writer | upgrader | readers));
+            case upgrade_to_exclusive_acq:
+                next = ((s - 1) | writer) & ~(upgrader | writer_waiting);
+                return (s & readers) == 1;
+            case shared_to_exclusive_acq:
+                next = ((s - 1) | writer) & ~writer_waiting;
+                return (s & readers) == 1;
+            case shared_to_upgrade_acq:
+                next = s | upgrader;
+                return ! (s & (writer_waiting | upgrader));
+            }
+            return false;
+        }
+
+        // Returns: whether the acquisition a must block the new readers while waiting.
+        static bool is_exclusive(acquisition a)
+        {
+            return a == exclusive_acq || a == upgrade_to_exclusive_acq || a == shared_to_exclusive_acq;
+        }
+
+        bool try_acquire(acquisition a)
+        {
+            state_type s = state.load(memory_order_relaxed);
+            state_type next;
+            while (can_acquire(a, s, next))
+            {
+                if (state.compare_exchange_weak(s, next, memory_order_acquire, memory_order_relaxed)) return true;
+            }
+            return false;
+        }
+
+        // Effects: Acquires the mutex if possible, or marks the state as having parked threads.
+        // Returns: whether the mutex has been acquired, s being otherwise the value on which the thread can wait.
+        bool acquire_or_park(acquisition a, state_type& s)
+        {
+            for (;;)
+            {
+                state_type next;
+                if (can_acquire(a, s, next))
+                {
+                    if (state.compare_exchange_weak(s, next, memory_order_acquire, memory_order_relaxed)) return true;
+                    continue;
+                }
+                next = s | parked | (is_exclusive(a) ? writer_waiting : 0);
+                if (next == s || state.compare_exchange_weak(s, next, memory_order_relaxed, memory_order_relaxed))
+                {
+                    s = next;
+                    return false;
+                }
+            }
+        }
+
+        void acquire(acquisition a)
+        {
+            state_type s = state.load(memory_order_relaxed);
+            while (! acquire_or_park(a, s))
+            {
+                detail::futex_wait(state, s);
+                s = state.load(memory_order_relaxed);
+            }
+        }
+
+        template <class Deadline>
+        bool acquire_until(acquisition a, Deadline const& deadline)
+        {
+            state_type s = state.load(memory_order_relaxed);
+            while (! acquire_or_park(a, s))
+            {
+                if (! detail::futex_wait_until(state, s, deadline))
+                {
+                    abandon(a);
+                    return false;
+                }
+                s = state.load(memory_order_relaxed);
+            }
+            return true;
+        }
+
+        // Effects: Withdraws the waiting writer bit set by a writer which has timed out.
+        void abandon(acquisition a)
+        {
+            if (! is_exclusive(a)) return;
+            // The other waiting writers, if any, are woken up and set this bit again.
+            state_type s = state.load(memory_order_relaxed);
+            while (! state.compare_exchange_weak(s, s & ~(writer_waiting | parked), memory_order_relaxed, memory_order_relaxed))
+            {
+            }
+            if (s & parked) detail::futex_wake_all(state);
+        }
+
+        // Effects: Replaces the state s by transform(s) without the parked bit, and wakes up the parked threads if any.
+        template <class Transform>
+        void release(Transform transform)
+        {
+            state_type s = state.load(memory_order_relaxed);
+            while (! state.compare_exchange_weak(s, transform(s) & ~parked, memory_order_release, memory_order_relaxed))
+            {
+            }
+            if (s & parked) detail::futex_wake_all(state);
+        }
+
+        void wake_parked()
+        {
+            if (state.fetch_and(~parked, memory_order_relaxed) & parked) detail::futex_wake_all(state);
+        }
+
+        struct unlock_upgrade_transform
+        {
+            state_type operator()(state_type s) const { return (s - 1) & ~upgrader; }
+        };
+        struct unlock_and_lock_upgrade_transform
+        {
+            state_type operator()(state_type s) const { return ((s & ~writer) + 1) | upgrader; }
+        };
+        struct unlock_and_lock_shared_transform
+        {
+            state_type operator()(state_type s) const { return (s & ~writer) + 1; }
+        };
+        struct unlock_upgrade_and_lock_shared_transform
+        {
+            state_type operator()(state_type s) const { return s & ~upgrader; }
+        };
+
+#if defined BOOST_THREAD_USES_DATETIME
+        template <typename TimeDuration>
+        bool timed_acquire(acquisition a, TimeDuration const& relative_time)
+        {
+            if (relative_time.is_pos_infinity())
+            {
+                acquire(a);
+                return true;
+            }
+            if (relative_time.is_special())
+            {
+                return try_acquire(a);
+            }
+            return acquire_until(a, detail::futex_relative_deadline(detail::platform_duration(relative_time)));
+        }
+#endif
+#ifdef BOOST_THREAD_USES_CHRONO
+        template <class Clock, class Duration>
+        bool acquire_until(acquisition a, chrono::time_point<Clock, Duration> const& abs_time)
+        {
+            return acquire_until(a, detail::futex_chrono_deadline<Clock, Duration>(abs_time));
+        }
+#endif
+
+    public:
+
+        BOOST_THREAD_NO_COPYABLE(shared_mutex)
+
+        shared_mutex() : state(0)
+        {
+        }
+
+        ~shared_mutex()
+        {
+            BOOST_ASSERT( (state.load(memory_order_relaxed) & ~parked) == 0 );
+        }
+
+        void lock_shared()
+        {
+            state_type s = state.load(memory_order_relaxed);
+            if (! (s & (writer | writer_waiting)) &&
+                state.compare_exchange_weak(s, s + 1, memory_order_acquire, memory_order_relaxed))
+            {
+                return;
+            }
+            acquire(shared_acq);
+        }
+
+        bool try_lock_shared()
+        {
+            return try_acquire(shared_acq);
+        }
+
+#if defined BOOST_THREAD_USES_DATETIME
+        bool timed_lock_shared(system_time const& timeout)
+        {
+            return acquire_until(shared_acq, detail::futex_real_deadline(timeout));
+        }
+
+        template<typename TimeDuration>
+        bool timed_lock_shared(TimeDuration const & relative_time)
+        {
+            return timed_acquire(shared_acq, relative_time);
+        }
+#endif
+#ifdef BOOST_THREAD_USES_CHRONO
+        template <class Rep, class Period>
+        bool try_lock_shared_for(const chrono::duration<Rep, Period>& rel_time)
+        {
+          return try_lock_shared_until(chrono::steady_clock::now() + rel_time);
+        }
+        template <class Clock, class Duration>
+        bool try_lock_shared_until(const chrono::time_point<Clock, Duration>& abs_time)
+        {
+          return acquire_until(shared_acq, abs_time);
+        }
+#endif
+        void unlock_shared()
+        {
+            state_type s = state.fetch_sub(1, memory_order_release) - 1;
+            BOOST_ASSERT( (s & readers) != readers );
+            BOOST_ASSERT( ! (s & writer) );
+            // The waiting threads can go on only if there is no more reader, or if the only one left is waiting to
+            // become the writer.
+            if ((s & parked) && (s & readers) <= 1)
+            {
+                wake_parked();
+            }
+        }
+
+        void lock()
+        {
+            acquire(exclusive_acq);
+        }
+
+#if defined BOOST_THREAD_USES_DATETIME
+        bool timed_lock(system_time const& timeout)
+        {
+            return acquire_until(exclusive_acq, detail::futex_real_deadline(timeout));
+        }
+
+        template<typename TimeDuration>
+        bool timed_lock(TimeDuration const & relative_time)
+        {
+            return timed_acquire(exclusive_acq, relative_time);
+        }
+#endif
+#ifdef BOOST_THREAD_USES_CHRONO
+        template <class Rep, class Period>
+        bool try_lock_for(const chrono::duration<Rep, Period>& rel_time)
+        {
+          return try_lock_until(chrono::steady_clock::now() + rel_time);
+        }
+        template <class Clock, class Duration>
+        bool try_lock_until(const chrono::time_point<Clock, Duration>& abs_time)
+        {
+          return acquire_until(exclusive_acq, abs_time);
+        }
+#endif
+
+        bool try_lock()
+        {
+            return try_acquire(exclusive_acq);
+        }
+
+        void unlock()
+        {
+            state_type s = state.fetch_and(~(writer | parked), memory_order_release);
+            BOOST_ASSERT( (s & writer) && (s & readers) == 0 );
+            if (s & parked) detail::futex_wake_all(state);
+        }
+
+        void lock_upgrade()
+        {
+            acquire(upgrade_acq);
+        }
+
+#if defined BOOST_THREAD_USES_DATETIME
+        bool timed_lock_upgrade(system_time const& timeout)
+        {
+            return acquire_until(upgrade_acq, detail::futex_real_deadline(timeout));
+        }
+
+        template<typename TimeDuration>
+        bool timed_lock_upgrade(TimeDuration const & relative_time)
+        {
+            return timed_acquire(upgrade_acq, relative_time);
+        }
+#endif
+#ifdef BOOST_THREAD_USES_CHRONO
+        template <class Rep, class Period>
+        bool try_lock_upgrade_for(const chrono::duration<Rep, Period>& rel_time)
+        {
+          return try_lock_upgrade_until(chrono::steady_clock::now() + rel_time);
+        }
+        template <class Clock, class Duration>
+        bool try_lock_upgrade_until(const chrono::time_point<Clock, Duration>& abs_time)
+        {
+          return acquire_until(upgrade_acq, abs_time);
+        }
+#endif
+        bool try_lock_upgrade()
+        {
+            return try_acquire(upgrade_acq);
+        }
+
+        void unlock_upgrade()
+        {
+            BOOST_ASSERT( state.load(memory_order_relaxed) & upgrader );
+            release(unlock_upgrade_transform());
+        }
+
+        // Upgrade <-> Exclusive
+        void unlock_upgrade_and_lock()
+        {
+            BOOST_ASSERT( state.load(memory_order_relaxed) & upgrader );
+            acquire(upgrade_to_exclusive_acq);
+        }
+
+        void unlock_and_lock_upgrade()
+        {
+            BOOST_ASSERT( state.load(memory_order_relaxed) & writer );
+            release(unlock_and_lock_upgrade_transform());
+        }
+
+        bool try_unlock_upgrade_and_lock()
+        {
+          BOOST_ASSERT( state.load(memory_order_relaxed) & upgrader );
+          return try_acquire(upgrade_to_exclusive_acq);
+        }
+#ifdef BOOST_THREAD_USES_CHRONO
+        template <class Rep, class Period>
+        bool
+        try_unlock_upgrade_and_lock_for(
+                                const chrono::duration<Rep, Period>& rel_time)
+        {
+          return try_unlock_upgrade_and_lock_until(
+                                 chrono::steady_clock::now() + rel_time);
+        }
+        template <class Clock, class Duration>
+        bool
+        try_unlock_upgrade_and_lock_until(
+                          const chrono::time_point<Clock, Duration>& abs_time)
+        {
+          BOOST_ASSERT( state.load(memory_order_relaxed) & upgrader );
+          return acquire_until(upgrade_to_exclusive_acq, abs_time);
+        }
+#endif
+
+        // Shared <-> Exclusive
+        void unlock_and_lock_shared()
+        {
+            BOOST_ASSERT( state.load(memory_order_relaxed) & writer );
+            release(unlock_and_lock_shared_transform());
+        }
+
+#ifdef BOOST_THREAD_PROVIDES_SHARED_MUTEX_UPWARDS_CONVERSIONS
+        bool try_unlock_shared_and_lock()
+        {
+          return try_acquire(shared_to_exclusive_acq);
+        }
+#ifdef BOOST_THREAD_USES_CHRONO
+        template <class Rep, class Period>
+        bool
+        try_unlock_shared_and_lock_for(
+                                const chrono::duration<Rep, Period>& rel_time)
+        {
+          return try_unlock_shared_and_lock_until(
+                                 chrono::steady_clock::now() + rel_time);
+        }
+        template <class Clock, class Duration>
+        bool
+        try_unlock_shared_and_lock_until(
+                          const chrono::time_point<Clock, Duration>& abs_time)
+        {
+          return acquire_until(shared_to_exclusive_acq, abs_time);
+        }
+#endif
+#endif
+
+        // Shared <-> Upgrade
+        void unlock_upgrade_and_lock_shared()
+        {
+            BOOST_ASSERT( state.load(memory_order_relaxed) & upgrader );
+            release(unlock_upgrade_and_lock_shared_transform());
+        }
+
+#ifdef BOOST_THREAD_PROVIDES_SHARED_MUTEX_UPWARDS_CONVERSIONS
+        bool try_unlock_shared_and_lock_upgrade()
+        {
+          return try_acquire(shared_to_upgrade_acq);
+        }
+#ifdef BOOST_THREAD_USES_CHRONO
+        template <class Rep, class Period>
+        bool
+        try_unlock_shared_and_lock_upgrade_for(
+                                const chrono::duration<Rep, Period>& rel_time)
+        {
+          return try_unlock_shared_and_lock_upgrade_until(
+                                 chrono::steady_clock::now() + rel_time);
+        }
+        template <class Clock, class Duration>
+        bool
+        try_unlock_shared_and_lock_upgrade_until(
+                          const chrono::time_point<Clock, Duration>& abs_time)
+        {
+          return acquire_until(shared_to_upgrade_acq, abs_time);
+        }
+#endif
+#endif
+    };
+
+    typedef shared_mutex upgrade_mutex;
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
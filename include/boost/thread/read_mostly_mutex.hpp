@@ -0,0 +1,252 @@
+#ifndef BOOST_THREAD_READ_MOSTLY_MUTEX_HPP
+#define BOOST_THREAD_READ_MOSTLY_MUTEX_HPP
+
+//  (C) Copyright 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/thread/detail/config.hpp>
+#include <boost/thread/detail/delete.hpp>
+#include <boost/thread/detail/thread_slots.hpp>
+#include <boost/thread/thread_only.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/lock_types.hpp>
+#include <boost/thread/condition_variable.hpp>
+#if defined BOOST_THREAD_PROVIDES_INTERRUPTIONS
+#include <boost/thread/detail/thread_interruption.hpp>
+#endif
+#ifdef BOOST_THREAD_USES_CHRONO
+#include <boost/chrono/system_clocks.hpp>
+#endif
+#include <boost/atomic.hpp>
+#include <boost/assert.hpp>
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+  /**
+   * Multiple-reader / single-writer mutex for data read by many threads and written rarely.
+   *
+   * The readers are counted in an array of slots, each one on its own cache line, and a reader only increments and
+   * decrements the slot of its thread, so that the readers running on different cores don't share any written cache
+   * line. A writer revokes the read access by setting a flag checked by the readers after they have incremented their
+   * slot, and waits until all the slots are zero. The readers arriving while a writer is pending or running wait
+   * until it has unlocked the mutex.
+   *
+   * Acquiring the mutex for writing is therefore much more expensive than with shared_mutex, as all the slots must be
+   * scanned, and the mutex takes a cache line per slot.
+   */
+  class read_mostly_mutex
+  {
+  private:
+    struct slot
+    {
+      atomic<unsigned> readers;
+
+      slot() : readers(0) {}
+    };
+
+    detail::thread_slots<slot> slots_;
+    /// whether a writer owns the mutex or is waiting for the readers to leave.
+    atomic<bool> writer_;
+    /// same as writer_, but protected by mtx_.
+    bool writing_;
+    mutex mtx_;
+    /// notified when the writer unlocks the mutex.
+    condition_variable readers_cv_;
+    /// notified when the last reader of a slot leaves while a writer is pending, and when the writer unlocks the mutex.
+    condition_variable writer_cv_;
+
+    atomic<unsigned>& my_slot()
+    {
+      return slots_.this_thread_slot().readers;
+    }
+
+    bool no_readers() const
+    {
+      for (std::size_t i = 0; i < slots_.size(); ++i)
+      {
+        if (slots_[i].readers.load(memory_order_seq_cst) != 0) return false;
+      }
+      return true;
+    }
+
+    // Effects: Tries to enter the slot, the slot being left if a writer is there.
+    bool try_enter(atomic<unsigned>& s)
+    {
+      s.fetch_add(1, memory_order_seq_cst);
+      // The seq_cst increment and load on the reader side and the seq_cst store and scan on the writer side ensure
+      // that either the reader sees the writer flag, or the writer sees the reader.
+      if (! writer_.load(memory_order_seq_cst)) return true;
+      leave(s);
+      return false;
+    }
+
+    void leave(atomic<unsigned>& s)
+    {
+      if (s.fetch_sub(1, memory_order_seq_cst) == 1 && writer_.load(memory_order_seq_cst))
+      {
+        lock_guard<mutex> lk(mtx_);
+        writer_cv_.notify_all();
+      }
+    }
+
+    // Effects: Withdraws the writer which has not been able to acquire the mutex.
+    void withdraw(unique_lock<mutex>&)
+    {
+      writing_ = false;
+      writer_.store(false, memory_order_seq_cst);
+      readers_cv_.notify_all();
+      writer_cv_.notify_all();
+    }
+
+  public:
+    BOOST_THREAD_NO_COPYABLE(read_mostly_mutex)
+
+    /**
+     * \b Effects: Constructs a mutex counting its readers in \c slot_count slots, rounded to the next power of two.
+     * If \c slot_count is 0, twice the number of hardware threads is used.
+     *
+     * \b Throws: \c thread_resource_error or \c std::bad_alloc on failure.
+     */
+    explicit read_mostly_mutex(unsigned slot_count = 0) :
+      slots_(slot_count),
+      writer_(false),
+      writing_(false)
+    {
+    }
+
+    ~read_mostly_mutex()
+    {
+      BOOST_ASSERT( ! writing_ );
+      BOOST_ASSERT( no_readers() );
+    }
+
+    /**
+     * \b Returns: The number of reader slots.
+     */
+    std::size_t slot_count() const BOOST_NOEXCEPT
+    {
+      return slots_.size();
+    }
+
+    void lock_shared()
+    {
+      atomic<unsigned>& s = my_slot();
+      while (! try_enter(s))
+      {
+#if defined BOOST_THREAD_PROVIDES_INTERRUPTIONS
+        boost::this_thread::disable_interruption do_not_disturb;
+#endif
+        unique_lock<mutex> lk(mtx_);
+        while (writing_) readers_cv_.wait(lk);
+      }
+    }
+
+    bool try_lock_shared()
+    {
+      return try_enter(my_slot());
+    }
+
+#ifdef BOOST_THREAD_USES_CHRONO
+    template <class Rep, class Period>
+    bool try_lock_shared_for(const chrono::duration<Rep, Period>& rel_time)
+    {
+      return try_lock_shared_until(chrono::steady_clock::now() + rel_time);
+    }
+    template <class Clock, class Duration>
+    bool try_lock_shared_until(const chrono::time_point<Clock, Duration>& abs_time)
+    {
+      atomic<unsigned>& s = my_slot();
+      while (! try_enter(s))
+      {
+#if defined BOOST_THREAD_PROVIDES_INTERRUPTIONS
+        boost::this_thread::disable_interruption do_not_disturb;
+#endif
+        unique_lock<mutex> lk(mtx_);
+        while (writing_)
+        {
+          if (readers_cv_.wait_until(lk, abs_time) == cv_status::timeout && writing_) return false;
+        }
+      }
+      return true;
+    }
+#endif
+
+    void unlock_shared()
+    {
+      leave(my_slot());
+    }
+
+    void lock()
+    {
+#if defined BOOST_THREAD_PROVIDES_INTERRUPTIONS
+      boost::this_thread::disable_interruption do_not_disturb;
+#endif
+      unique_lock<mutex> lk(mtx_);
+      while (writing_) writer_cv_.wait(lk);
+      writing_ = true;
+      writer_.store(true, memory_order_seq_cst);
+      while (! no_readers()) writer_cv_.wait(lk);
+    }
+
+    bool try_lock()
+    {
+      unique_lock<mutex> lk(mtx_);
+      if (writing_) return false;
+      writing_ = true;
+      writer_.store(true, memory_order_seq_cst);
+      if (no_readers()) return true;
+      withdraw(lk);
+      return false;
+    }
+
+#ifdef BOOST_THREAD_USES_CHRONO
+    template <class Rep, class Period>
+    bool try_lock_for(const chrono::duration<Rep, Period>& rel_time)
+    {
+      return try_lock_until(chrono::steady_clock::now() + rel_time);
+    }
+    template <class Clock, class Duration>
+    bool try_lock_until(const chrono::time_point<Clock, Duration>& abs_time)
+    {
+#if defined BOOST_THREAD_PROVIDES_INTERRUPTIONS
+      boost::this_thread::disable_interruption do_not_disturb;
+#endif
+      unique_lock<mutex> lk(mtx_);
+      while (writing_)
+      {
+        if (writer_cv_.wait_until(lk, abs_time) == cv_status::timeout && writing_) return false;
+      }
+      writing_ = true;
+      writer_.store(true, memory_order_seq_cst);
+      while (! no_readers())
+      {
+        if (writer_cv_.wait_until(lk, abs_time) == cv_status::timeout && ! no_readers())
+        {
+          withdraw(lk);
+          return false;
+        }
+      }
+      return true;
+    }
+#endif
+
+    void unlock()
+    {
+      lock_guard<mutex> lk(mtx_);
+      BOOST_ASSERT( writing_ );
+      writing_ = false;
+      writer_.store(false, memory_order_seq_cst);
+      readers_cv_.notify_all();
+      writer_cv_.notify_all();
+    }
+  };
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
@@ -0,0 +1,214 @@
+#ifndef BOOST_THREAD_SEQLOCK_HPP
+#define BOOST_THREAD_SEQLOCK_HPP
+
+//  seqlock.hpp
+//
+//  (C) Copyright 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/thread/detail/config.hpp>
+#include <boost/thread/detail/delete.hpp>
+#include <boost/thread/detail/backoff.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/lock_guard.hpp>
+#include <boost/thread/lockable_traits.hpp>
+#if defined BOOST_THREAD_PROVIDES_NESTED_LOCKS
+#include <boost/thread/lock_types.hpp>
+#endif
+#include <boost/atomic.hpp>
+#include <boost/atomic/atomic_ref.hpp>
+#include <boost/type_traits/alignment_of.hpp>
+#include <boost/type_traits/aligned_storage.hpp>
+#include <boost/type_traits/is_trivially_copyable.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/assert.hpp>
+#include <cstring>
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+  namespace detail
+  {
+    // Copies a value which can be written concurrently, the copy being validated afterwards by the caller.
+    template <typename T, bool Atomic = atomics::atomic_ref<T>::is_always_lock_free
+                                        && alignment_of<T>::value >= atomics::atomic_ref<T>::required_alignment>
+    struct seqlock_copy
+    {
+      static T apply(T const& value)
+      {
+        typename aligned_storage<sizeof(T), alignment_of<T>::value>::type buffer;
+        std::memcpy(&buffer, &value, sizeof(T));
+        return *static_cast<T const*>(static_cast<void const*>(&buffer));
+      }
+    };
+    // the values which boost::atomic can load without a lock are copied with a single load, which is never torn.
+    template <typename T>
+    struct seqlock_copy<T, true>
+    {
+      static T apply(T const& value)
+      {
+        return atomics::atomic_ref<T>(const_cast<T&>(value)).load(memory_order_relaxed);
+      }
+    };
+  }
+
+  /**
+   * Sequence lock, for small data which is read much more often than it is written.
+   *
+   * The writers lock it as a mutex, which makes the sequence number odd until they unlock it. The readers don't lock
+   * it: they copy the data, and retry if the sequence number tells that a writer has been there meanwhile, so that
+   * they never write to the shared memory, unless they have to wait for a writer holding the lock for long.
+   *
+   * The data read this way must be trivially copyable, as a reader can copy it while it is being written.
+   */
+  class BOOST_THREAD_CAPABILITY("mutex") seqlock
+  {
+  private:
+    // odd while a writer owns the lock.
+    atomic<unsigned> seq_;
+    // serializes the writers.
+    mutable boost::mutex mtx_;
+
+    void begin_write()
+    {
+      seq_.store(seq_.load(memory_order_relaxed) + 1, memory_order_relaxed);
+      // the data written after may not be seen before the odd sequence number.
+      atomic_thread_fence(memory_order_release);
+    }
+
+  public:
+    BOOST_THREAD_NO_COPYABLE(seqlock)
+
+    seqlock() BOOST_NOEXCEPT : seq_(0)
+    {
+    }
+
+    ~seqlock()
+    {
+    }
+
+    void lock() BOOST_THREAD_ACQUIRE()
+    {
+      mtx_.lock();
+      begin_write();
+    }
+
+    bool try_lock() BOOST_THREAD_TRY_ACQUIRE(true)
+    {
+      if (! mtx_.try_lock()) return false;
+      begin_write();
+      return true;
+    }
+
+    void unlock() BOOST_THREAD_RELEASE()
+    {
+      unsigned const s = seq_.load(memory_order_relaxed);
+      BOOST_ASSERT(s & 1);
+      seq_.store(s + 1, memory_order_release);
+      mtx_.unlock();
+    }
+
+    /**
+     * \b Effects: Waits until no writer owns the lock.
+     *
+     * \b Returns: The sequence number to be passed to read_retry() once the data has been copied.
+     */
+    unsigned read_begin() const
+    {
+      unsigned s;
+      detail::spin_backoff backoff;
+      while ((s = seq_.load(memory_order_acquire)) & 1)
+      {
+        if (backoff.saturated())
+        {
+          // waits for the writer to unlock the mutex.
+          boost::lock_guard<boost::mutex> lk(mtx_);
+          backoff.reset();
+        }
+        else
+        {
+          backoff.pause();
+        }
+      }
+      return s;
+    }
+
+    /**
+     * \b Returns: Whether a writer has locked the seqlock since the call to read_begin() that returned \c seq, in
+     * which case the data copied since must be discarded.
+     */
+    bool read_retry(unsigned seq) const
+    {
+      // the data copied before may not be seen after the sequence number.
+      atomic_thread_fence(memory_order_acquire);
+      return seq_.load(memory_order_relaxed) != seq;
+    }
+
+    /**
+     * \b Requires: \c T is trivially copyable and \c value is written only by the owners of the lock.
+     *
+     * \b Returns: A copy of \c value, which is valid only if read_retry() returns false once it has been made.
+     */
+    template <typename T>
+    static T copy(T const& value)
+    {
+      BOOST_STATIC_ASSERT_MSG(is_trivially_copyable<T>::value, "seqlock::copy requires a trivially copyable type");
+      return detail::seqlock_copy<T>::apply(value);
+    }
+
+    /**
+     * \b Requires: \c T is trivially copyable and \c value is written only by the owners of the lock.
+     *
+     * \b Returns: A copy of \c value, as it was while no writer owned the lock.
+     */
+    template <typename T>
+    T read(T const& value) const
+    {
+      BOOST_STATIC_ASSERT_MSG(is_trivially_copyable<T>::value, "seqlock::read requires a trivially copyable type");
+      for (;;)
+      {
+        unsigned const s = read_begin();
+        T const result = copy(value);
+        if (! read_retry(s)) return result;
+      }
+    }
+
+#if defined BOOST_THREAD_PROVIDES_NESTED_LOCKS
+    typedef unique_lock<seqlock> scoped_lock;
+    typedef detail::try_lock_wrapper<seqlock> scoped_try_lock;
+#endif
+  };
+
+  namespace detail
+  {
+    template <typename T, typename Lockable>
+    struct synchronized_value_reads_optimistically;
+    // the observers of synchronized_value<T, seqlock> use seqlock::read().
+    template <typename T>
+    struct synchronized_value_reads_optimistically<T, seqlock> : is_trivially_copyable<T> {};
+  }
+
+  namespace sync
+  {
+#ifdef BOOST_THREAD_NO_AUTO_DETECT_MUTEX_TYPES
+    template<>
+    struct is_basic_lockable<seqlock>
+    {
+      BOOST_STATIC_CONSTANT(bool, value = true);
+    };
+    template<>
+    struct is_lockable<seqlock>
+    {
+      BOOST_STATIC_CONSTANT(bool, value = true);
+    };
+#endif
+  }
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
@@ -24,6 +24,8 @@
 #elif defined(BOOST_THREAD_PLATFORM_PTHREAD)
 #if defined(BOOST_THREAD_V2_SHARED_MUTEX)
 #include <boost/thread/v2/shared_mutex.hpp>
+#elif defined(BOOST_THREAD_ATOMIC_SHARED_MUTEX)
+#include <boost/thread/pthread/shared_mutex_atomic.hpp>
 #else
 #include <boost/thread/pthread/shared_mutex.hpp>
 #endif
@@ -0,0 +1,370 @@
+#ifndef BOOST_THREAD_SNAPSHOT_VALUE_HPP
+#define BOOST_THREAD_SNAPSHOT_VALUE_HPP
+
+//  (C) Copyright 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/thread/detail/config.hpp>
+#include <boost/thread/detail/delete.hpp>
+#include <boost/thread/detail/move.hpp>
+#include <boost/thread/detail/thread_slots.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/lock_types.hpp>
+#include <boost/thread/lock_guard.hpp>
+#include <boost/atomic.hpp>
+#include <boost/assert.hpp>
+#include <boost/thread/csbl/memory/unique_ptr.hpp>
+#include <boost/utility/result_of.hpp>
+#include <vector>
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+  namespace detail
+  {
+    /**
+     * Epoch based reclamation for a single shared pointer.
+     *
+     * The readers are counted in an array of slots, as in read_mostly_mutex, and each slot has a counter for the even
+     * epochs and one for the odd epochs. A reader increments the counter of the current epoch in the slot of its
+     * thread before loading the pointer, so that the readers are always in the current or in the previous epoch.
+     *
+     * A writer starts a new epoch only once the readers of the previous epoch are gone: the pointers replaced before
+     * the start of the current epoch can then no more be used by any reader, and can be reclaimed.
+     */
+    class snapshot_epochs
+    {
+    private:
+      struct slot
+      {
+        atomic<unsigned> readers[2];
+
+        slot()
+        {
+          readers[0].store(0, memory_order_relaxed);
+          readers[1].store(0, memory_order_relaxed);
+        }
+      };
+
+      thread_slots<slot> slots_;
+      atomic<unsigned> epoch_;
+
+      bool no_readers(unsigned parity) const
+      {
+        for (std::size_t i = 0; i < slots_.size(); ++i)
+        {
+          if (slots_[i].readers[parity].load(memory_order_seq_cst) != 0) return false;
+        }
+        return true;
+      }
+
+    public:
+      BOOST_THREAD_NO_COPYABLE(snapshot_epochs)
+
+      explicit snapshot_epochs(unsigned slot_count = 0) :
+        slots_(slot_count),
+        epoch_(0)
+      {
+      }
+
+      ~snapshot_epochs()
+      {
+        BOOST_ASSERT( no_readers(0) && no_readers(1) );
+      }
+
+      /**
+       * Effects: Enters the current epoch. The shared pointer must be loaded afterwards, with memory_order_seq_cst.
+       * Returns: The counter to be passed to leave().
+       */
+      atomic<unsigned>* enter()
+      {
+        slot& s = slots_.this_thread_slot();
+        for (;;)
+        {
+          unsigned const e = epoch_.load(memory_order_seq_cst);
+          atomic<unsigned>& readers = s.readers[e & 1];
+          readers.fetch_add(1, memory_order_seq_cst);
+          // The seq_cst increment and load on the reader side and the seq_cst increment and scan on the writer side
+          // ensure that either the reader sees the new epoch, or the writer sees the reader.
+          if (((epoch_.load(memory_order_seq_cst) ^ e) & 1) == 0) return &readers;
+          leave(&readers);
+        }
+      }
+
+      void leave(atomic<unsigned>* readers)
+      {
+        readers->fetch_sub(1, memory_order_release);
+      }
+
+      /**
+       * Requires: The writers are serialized.
+       * Effects: Starts a new epoch if the readers of the previous one are gone.
+       * Returns: Whether a new epoch has been started, in which case the pointers replaced before the start of the
+       * epoch which has just ended can be reclaimed.
+       */
+      bool try_advance()
+      {
+        unsigned const e = epoch_.load(memory_order_relaxed);
+        if (! no_readers((e + 1) & 1)) return false;
+        epoch_.fetch_add(1, memory_order_seq_cst);
+        return true;
+      }
+    };
+  }
+
+  template <typename T>
+  class snapshot_value;
+
+  /**
+   * Read handle on a snapshot of a snapshot_value: the snapshot is neither modified nor reclaimed while the handle
+   * exists.
+   *
+   * @param T the value type.
+   */
+  template <typename T>
+  class snapshot_ptr
+  {
+  public:
+    typedef T value_type;
+  private:
+    detail::snapshot_epochs* epochs_;
+    atomic<unsigned>* readers_;
+    T const* value_;
+
+    friend class snapshot_value<T>;
+    snapshot_ptr(detail::snapshot_epochs& epochs, atomic<T*> const& current) :
+      epochs_(&epochs), readers_(epochs.enter()), value_(current.load(memory_order_seq_cst))
+    {
+    }
+
+  public:
+    BOOST_THREAD_MOVABLE_ONLY( snapshot_ptr )
+
+    /**
+     * Move constructor.
+     * @effects takes over the snapshot of @c other.
+     */
+    snapshot_ptr(BOOST_THREAD_RV_REF(snapshot_ptr) other) BOOST_NOEXCEPT :
+      epochs_(BOOST_THREAD_RV(other).epochs_), readers_(BOOST_THREAD_RV(other).readers_), value_(BOOST_THREAD_RV(other).value_)
+    {
+      BOOST_THREAD_RV(other).epochs_ = 0;
+    }
+
+    /**
+     * @effects releases the snapshot, which can be reclaimed if it is no more the current one.
+     */
+    ~snapshot_ptr()
+    {
+      if (epochs_) epochs_->leave(readers_);
+    }
+
+    /**
+     * @return a constant pointer to the snapshot
+     */
+    const T* operator->() const
+    {
+      return value_;
+    }
+
+    /**
+     * @return a constant reference to the snapshot
+     */
+    const T& operator*() const
+    {
+      return *value_;
+    }
+  };
+
+  /**
+   * Value for large objects read by many threads and modified rarely.
+   *
+   * The readers get an immutable snapshot of the value without locking: they only write to a counter shared with the
+   * threads of the same reader slot. The writers copy the current snapshot, modify the copy and publish it, and they
+   * reclaim the previous snapshots which can no more be used by any reader. A writer never waits for the readers, so
+   * that a thread can update the value while it holds a snapshot of it.
+   *
+   * The interface follows the one of synchronized_value: synchronize(), operator->() and operator() give access to the
+   * current snapshot, and update() replaces the call to the non-const operator().
+   *
+   * @param T the value type.
+   */
+  template <typename T>
+  class snapshot_value
+  {
+  public:
+    typedef T value_type;
+  private:
+    atomic<T*> current_;
+    mutable detail::snapshot_epochs epochs_;
+    /// serializes the writers and protects the retired snapshots.
+    mutex update_mtx_;
+    /// the snapshots replaced during the current epoch.
+    std::vector<T*> retired_;
+    /// the snapshots replaced during the previous epoch, reclaimed once its readers are gone.
+    std::vector<T*> expiring_;
+
+    static void destroy(std::vector<T*>& snapshots)
+    {
+      for (std::size_t i = 0; i < snapshots.size(); ++i) delete snapshots[i];
+      snapshots.clear();
+    }
+
+    // Requires: update_mtx_ is locked.
+    void reclaim_retired()
+    {
+      // a second epoch is started when the readers of the epoch which has just ended are gone as well.
+      for (int i = 0; i < 2 && ! (retired_.empty() && expiring_.empty()); ++i)
+      {
+        if (! epochs_.try_advance()) return;
+        destroy(expiring_);
+        expiring_.swap(retired_);
+      }
+    }
+
+    // Requires: update_mtx_ is locked.
+    void publish(csbl::unique_ptr<T>& value)
+    {
+      retired_.reserve(retired_.size() + 1);
+      retired_.push_back(current_.exchange(value.release(), memory_order_seq_cst));
+      reclaim_retired();
+    }
+
+  public:
+    BOOST_THREAD_NO_COPYABLE( snapshot_value )
+
+    /**
+     * Default constructor.
+     *
+     * Requires: T is DefaultConstructible
+     */
+    snapshot_value() :
+      current_(new T())
+    {
+    }
+
+    /**
+     * Constructor from copy constructible value.
+     *
+     * Requires: T is CopyConstructible
+     */
+    explicit snapshot_value(T const& other) :
+      current_(new T(other))
+    {
+    }
+
+    /**
+     * Move Constructor.
+     *
+     * Requires: T is Movable
+     */
+    explicit snapshot_value(BOOST_THREAD_RV_REF(T) other) :
+      current_(new T(boost::move(other)))
+    {
+    }
+
+    /**
+     * Requires: No snapshot_ptr of this object exists.
+     */
+    ~snapshot_value()
+    {
+      destroy(retired_);
+      destroy(expiring_);
+      delete current_.load(memory_order_relaxed);
+    }
+
+    /**
+     * Effects: Publishes a copy of @c val.
+     */
+    snapshot_value& operator=(value_type const& val)
+    {
+      csbl::unique_ptr<T> value(new T(val));
+      lock_guard<mutex> lk(update_mtx_);
+      publish(value);
+      return *this;
+    }
+    snapshot_value& operator=(BOOST_THREAD_RV_REF(value_type) val)
+    {
+      csbl::unique_ptr<T> value(new T(boost::move(val)));
+      lock_guard<mutex> lk(update_mtx_);
+      publish(value);
+      return *this;
+    }
+
+    /**
+     * Requires: T is CopyConstructible
+     *
+     * Effects: Calls @c fct on a copy of the current snapshot and publishes the copy, the writers being serialized.
+     * Nothing is published if @c fct throws.
+     */
+    template <typename F>
+    void update(F fct)
+    {
+      lock_guard<mutex> lk(update_mtx_);
+      csbl::unique_ptr<T> value(new T(*current_.load(memory_order_relaxed)));
+      fct(*value);
+      publish(value);
+    }
+
+    /**
+     * Effects: Destroys the previous snapshots which are no more used. Each update does it as well.
+     */
+    void reclaim()
+    {
+      lock_guard<mutex> lk(update_mtx_);
+      reclaim_retired();
+    }
+
+    /**
+     * Requires: T is CopyConstructible
+     * Return: A copy of the current snapshot.
+     */
+    T get() const
+    {
+      return *synchronize();
+    }
+#if ! defined(BOOST_NO_CXX11_EXPLICIT_CONVERSION_OPERATORS)
+    explicit operator T() const
+    {
+      return get();
+    }
+#endif
+
+    /**
+     * Essentially calling a method obj->foo(x, y, z) calls the method foo(x, y, z) on the current snapshot, which is
+     * held as long as the call itself.
+     */
+    snapshot_ptr<T> operator->() const
+    {
+      return BOOST_THREAD_MAKE_RV_REF((snapshot_ptr<T>(epochs_, current_)));
+    }
+
+    /**
+     * Return: A read handle on the current snapshot, which stays valid and unchanged while the handle exists, even if
+     * a new value is published meanwhile.
+     */
+    snapshot_ptr<T> synchronize() const
+    {
+      return BOOST_THREAD_MAKE_RV_REF((snapshot_ptr<T>(epochs_, current_)));
+    }
+
+    /**
+     * Call function on the current snapshot.
+     */
+    template <typename F>
+    inline
+    typename boost::result_of<F(value_type const&)>::type
+    operator()(F fct) const
+    {
+      snapshot_ptr<T> p(epochs_, current_);
+      return fct(*p);
+    }
+  };
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
@@ -0,0 +1,304 @@
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+// (C) Copyright 2026 The Boost.Thread Contributors
+
+#ifndef BOOST_THREAD_STOP_TOKEN_HPP
+#define BOOST_THREAD_STOP_TOKEN_HPP
+
+#include <boost/thread/detail/config.hpp>
+#include <boost/thread/detail/delete.hpp>
+#include <boost/thread/detail/move.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/lock_types.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread_only.hpp>
+
+#include <boost/atomic.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/smart_ptr/make_shared.hpp>
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+  namespace detail
+  {
+    /// Node of the intrusive list of callbacks registered on a stop_state.
+    struct stop_callback_base
+    {
+      stop_callback_base* prev;
+      stop_callback_base* next;
+      bool linked;
+
+      stop_callback_base() : prev(0), next(0), linked(false) {}
+      virtual void run() = 0;
+    protected:
+      ~stop_callback_base() {}
+    };
+
+    class stop_state
+    {
+      atomic<bool> stop_requested_;
+      atomic<unsigned> sources_;
+      mutex mtx_;
+      condition_variable callback_done_;
+      stop_callback_base* callbacks_;
+      stop_callback_base* running_;
+      boost::thread::id requester_;
+
+      void unlink(stop_callback_base* cb)
+      {
+        if (cb->prev) cb->prev->next = cb->next;
+        else callbacks_ = cb->next;
+        if (cb->next) cb->next->prev = cb->prev;
+        cb->linked = false;
+      }
+
+    public:
+      BOOST_THREAD_NO_COPYABLE(stop_state)
+      stop_state() : stop_requested_(false), sources_(1), callbacks_(0), running_(0) {}
+
+      bool stop_requested() const BOOST_NOEXCEPT
+      {
+        return stop_requested_.load(memory_order_acquire);
+      }
+      bool stop_possible() const BOOST_NOEXCEPT
+      {
+        return stop_requested() || sources_.load(memory_order_acquire) != 0;
+      }
+      void add_source() BOOST_NOEXCEPT
+      {
+        sources_.fetch_add(1, memory_order_relaxed);
+      }
+      void remove_source() BOOST_NOEXCEPT
+      {
+        sources_.fetch_sub(1, memory_order_acq_rel);
+      }
+
+      /**
+       * \b Effects: Sets the stop flag and runs the registered callbacks on the calling thread, without holding the lock.
+       *
+       * \b Returns: false if a stop had already been requested.
+       */
+      bool request_stop()
+      {
+        unique_lock<mutex> lk(mtx_);
+        if (stop_requested_.load(memory_order_relaxed))
+        {
+          return false;
+        }
+        stop_requested_.store(true, memory_order_release);
+        requester_ = this_thread::get_id();
+        while (callbacks_)
+        {
+          stop_callback_base* cb = callbacks_;
+          unlink(cb);
+          running_ = cb;
+          lk.unlock();
+          // cb may be destroyed by its own run().
+          cb->run();
+          lk.lock();
+          running_ = 0;
+          callback_done_.notify_all();
+        }
+        return true;
+      }
+
+      /**
+       * \b Effects: Links cb unless a stop has already been requested.
+       *
+       * \b Returns: false if cb was not linked, in which case the caller must run it.
+       */
+      bool add_callback(stop_callback_base* cb)
+      {
+        lock_guard<mutex> lk(mtx_);
+        if (stop_requested_.load(memory_order_relaxed))
+        {
+          return false;
+        }
+        cb->prev = 0;
+        cb->next = callbacks_;
+        if (callbacks_) callbacks_->prev = cb;
+        callbacks_ = cb;
+        cb->linked = true;
+        return true;
+      }
+
+      /**
+       * \b Effects: Unlinks cb. If cb is being run by another thread, waits until it has returned.
+       */
+      void remove_callback(stop_callback_base* cb)
+      {
+        unique_lock<mutex> lk(mtx_);
+        if (cb->linked)
+        {
+          unlink(cb);
+          return;
+        }
+        if (requester_ != this_thread::get_id())
+        {
+          while (running_ == cb)
+          {
+            callback_done_.wait(lk);
+          }
+        }
+      }
+    };
+  }
+
+  class stop_source;
+  template <class Callback>
+  class stop_callback;
+
+  /**
+   * Observes the stop state of the stop_source it has been obtained from.
+   * Polling it costs one atomic load.
+   */
+  class stop_token
+  {
+    friend class stop_source;
+    template <class Callback>
+    friend class stop_callback;
+
+    shared_ptr<detail::stop_state> state_;
+
+    explicit stop_token(shared_ptr<detail::stop_state> const& st) : state_(st) {}
+
+  public:
+    /**
+     * \b Effects: Constructs a token with no associated stop state: stop_possible() is false.
+     */
+    stop_token() BOOST_NOEXCEPT {}
+
+    /**
+     * \b Returns: whether a stop has been requested on the associated stop state.
+     */
+    bool stop_requested() const BOOST_NOEXCEPT
+    {
+      return state_ && state_->stop_requested();
+    }
+
+    /**
+     * \b Returns: whether a stop has been requested or can still be requested.
+     */
+    bool stop_possible() const BOOST_NOEXCEPT
+    {
+      return state_ && state_->stop_possible();
+    }
+
+    void swap(stop_token& other) BOOST_NOEXCEPT
+    {
+      state_.swap(other.state_);
+    }
+
+    friend bool operator==(stop_token const& x, stop_token const& y) BOOST_NOEXCEPT
+    {
+      return x.state_ == y.state_;
+    }
+    friend bool operator!=(stop_token const& x, stop_token const& y) BOOST_NOEXCEPT
+    {
+      return x.state_ != y.state_;
+    }
+  };
+
+  /**
+   * Owns a stop state and allows to request a stop on it. Copies share the same stop state.
+   */
+  class stop_source
+  {
+    shared_ptr<detail::stop_state> state_;
+
+  public:
+    stop_source() : state_(make_shared<detail::stop_state>()) {}
+
+    stop_source(stop_source const& other) BOOST_NOEXCEPT : state_(other.state_)
+    {
+      if (state_) state_->add_source();
+    }
+
+    stop_source& operator=(stop_source const& other) BOOST_NOEXCEPT
+    {
+      stop_source tmp(other);
+      swap(tmp);
+      return *this;
+    }
+
+    ~stop_source()
+    {
+      if (state_) state_->remove_source();
+    }
+
+    void swap(stop_source& other) BOOST_NOEXCEPT
+    {
+      state_.swap(other.state_);
+    }
+
+    stop_token get_token() const BOOST_NOEXCEPT
+    {
+      return stop_token(state_);
+    }
+
+    bool stop_requested() const BOOST_NOEXCEPT
+    {
+      return state_ && state_->stop_requested();
+    }
+
+    bool stop_possible() const BOOST_NOEXCEPT
+    {
+      return state_ != 0;
+    }
+
+    /**
+     * \b Effects: Requests a stop. The first call runs the callbacks registered on the stop state on the calling thread.
+     *
+     * \b Returns: true if this call made the stop request.
+     */
+    bool request_stop()
+    {
+      return state_ && state_->request_stop();
+    }
+  };
+
+  /**
+   * Registers a callback run when a stop is requested on the token given at construction.
+   * If the stop has already been requested the callback is run by the constructor.
+   * The destructor unregisters the callback and, if it is being run by another thread, waits until it has returned.
+   */
+  template <class Callback>
+  class stop_callback : private detail::stop_callback_base
+  {
+    shared_ptr<detail::stop_state> state_;
+    Callback callback_;
+
+    void run()
+    {
+      callback_();
+    }
+
+  public:
+    typedef Callback callback_type;
+
+    BOOST_THREAD_NO_COPYABLE(stop_callback)
+
+    template <class C>
+    stop_callback(stop_token const& st, BOOST_THREAD_FWD_REF(C) cb)
+    : state_(st.state_), callback_(boost::forward<C>(cb))
+    {
+      if (state_ && ! state_->add_callback(this))
+      {
+        state_.reset();
+        callback_();
+      }
+    }
+
+    ~stop_callback()
+    {
+      if (state_) state_->remove_callback(this);
+    }
+  };
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
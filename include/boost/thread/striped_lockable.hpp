@@ -0,0 +1,354 @@
+#ifndef BOOST_THREAD_STRIPED_LOCKABLE_HPP
+#define BOOST_THREAD_STRIPED_LOCKABLE_HPP
+
+//  striped_lockable.hpp
+//
+//  (C) Copyright 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/thread/detail/config.hpp>
+#include <boost/thread/detail/delete.hpp>
+#include <boost/thread/detail/move.hpp>
+#include <boost/thread/detail/mix_hash.hpp>
+#include <boost/thread/lock_types.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/assert.hpp>
+#include <boost/functional/hash.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+  namespace detail
+  {
+    template <bool Shared>
+    struct stripe_locking
+    {
+      template <typename Mutex>
+      static void lock(Mutex& m)
+      {
+        m.lock();
+      }
+      template <typename Mutex>
+      static void unlock(Mutex& m)
+      {
+        m.unlock();
+      }
+    };
+    template <>
+    struct stripe_locking<true>
+    {
+      template <typename Mutex>
+      static void lock(Mutex& m)
+      {
+        m.lock_shared();
+      }
+      template <typename Mutex>
+      static void unlock(Mutex& m)
+      {
+        m.unlock_shared();
+      }
+    };
+  }
+
+  template <typename Mutex, std::size_t N = 64>
+  class striped_lockable;
+
+  /**
+   * Lock on a set of stripes of a striped_lockable, exclusive or shared, acquired in the order of the stripe indices
+   * and released on destruction.
+   *
+   * @param Mutex the mutex type of the stripes.
+   * @param N the number of stripes.
+   * @param Shared whether the stripes are locked in shared mode.
+   */
+  template <typename Mutex, std::size_t N, bool Shared>
+  class striped_lock_set
+  {
+  private:
+    striped_lockable<Mutex, N>* stripes_;
+    // sorted and unique.
+    std::vector<std::size_t> owned_;
+
+    friend class striped_lockable<Mutex, N>;
+
+    // Effects: Locks the stripes of indices in increasing order.
+    striped_lock_set(striped_lockable<Mutex, N>& stripes, std::vector<std::size_t>& indices) :
+      stripes_(&stripes)
+    {
+      std::sort(indices.begin(), indices.end());
+      indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+      owned_.reserve(indices.size());
+      try
+      {
+        for (std::size_t i = 0; i < indices.size(); ++i)
+        {
+          detail::stripe_locking<Shared>::lock(stripes.stripe(indices[i]));
+          owned_.push_back(indices[i]);
+        }
+      }
+      catch (...)
+      {
+        unlock();
+        throw;
+      }
+    }
+
+  public:
+    BOOST_THREAD_MOVABLE_ONLY( striped_lock_set )
+
+    /**
+     * Move constructor.
+     * @effects takes over the stripes owned by @c other.
+     */
+    striped_lock_set(BOOST_THREAD_RV_REF(striped_lock_set) other) BOOST_NOEXCEPT :
+      stripes_(BOOST_THREAD_RV(other).stripes_)
+    {
+      owned_.swap(BOOST_THREAD_RV(other).owned_);
+    }
+
+    ~striped_lock_set()
+    {
+      unlock();
+    }
+
+    /**
+     * @effects unlocks the stripes owned, in the reverse order.
+     */
+    void unlock()
+    {
+      while (! owned_.empty())
+      {
+        detail::stripe_locking<Shared>::unlock(stripes_->stripe(owned_.back()));
+        owned_.pop_back();
+      }
+    }
+
+    /**
+     * @return the number of stripes owned.
+     */
+    std::size_t size() const BOOST_NOEXCEPT
+    {
+      return owned_.size();
+    }
+
+    /**
+     * @return whether the stripe of index @c i is owned.
+     */
+    bool owns_stripe(std::size_t i) const
+    {
+      return std::binary_search(owned_.begin(), owned_.end(), i);
+    }
+
+    /**
+     * @return whether the stripe of @c key is owned.
+     */
+    template <typename Key>
+    bool owns_lock_for(Key const& key) const
+    {
+      return owns_stripe(stripes_->index_of(key));
+    }
+  };
+
+  /**
+   * Table of N mutexes, the stripes, protecting the parts of a sharded structure selected by hashing the keys.
+   *
+   * Each stripe is aligned on its own cache line, so that the threads locking different stripes don't slow each other down.
+   * The stripes of several keys are locked in the order of their indices, once each, so that the threads locking
+   * several keys can't deadlock.
+   *
+   * @param Mutex the mutex type of the stripes, a shared mutex for lock_shared_for(), lock_all_shared_for() and
+   * lock_all_shared().
+   * @param N the number of stripes.
+   */
+  template <typename Mutex, std::size_t N>
+  class striped_lockable
+  {
+    BOOST_STATIC_ASSERT_MSG(N > 0, "striped_lockable needs at least one stripe");
+  public:
+    typedef Mutex mutex_type;
+    typedef striped_lock_set<Mutex, N, false> lock_set_type;
+    typedef striped_lock_set<Mutex, N, true> shared_lock_set_type;
+
+  private:
+    // aligned, and therefore padded, to a cache line.
+    struct BOOST_ALIGNMENT(64) padded_stripe
+    {
+      Mutex mtx;
+    };
+
+    padded_stripe stripes_[N];
+
+    template <typename Key>
+    void add_index(std::vector<std::size_t>& indices, Key const& key) const
+    {
+      indices.push_back(index_of(key));
+    }
+
+  public:
+    BOOST_THREAD_NO_COPYABLE( striped_lockable )
+
+    striped_lockable()
+    {
+    }
+
+    /**
+     * @return the number of stripes.
+     */
+    static std::size_t size() BOOST_NOEXCEPT
+    {
+      return N;
+    }
+
+    /**
+     * @return the index of the stripe protecting @c key, computed from boost::hash<Key>.
+     */
+    template <typename Key>
+    std::size_t index_of(Key const& key) const
+    {
+      return detail::mix_hash(boost::hash<Key>()(key)) % N;
+    }
+
+    /**
+     * @return the stripe of index @c i.
+     */
+    Mutex& stripe(std::size_t i)
+    {
+      BOOST_ASSERT(i < N);
+      return stripes_[i].mtx;
+    }
+
+    /**
+     * @return the stripe protecting @c key.
+     */
+    template <typename Key>
+    Mutex& mutex_for(Key const& key)
+    {
+      return stripe(index_of(key));
+    }
+
+    /**
+     * @return a lock owning the stripe of @c key.
+     */
+    template <typename Key>
+    unique_lock<Mutex> lock_for(Key const& key)
+    {
+      return BOOST_THREAD_MAKE_RV_REF((unique_lock<Mutex>(mutex_for(key))));
+    }
+
+    /**
+     * @return a lock owning the stripe of @c key in shared mode.
+     */
+    template <typename Key>
+    shared_lock<Mutex> lock_shared_for(Key const& key)
+    {
+      return BOOST_THREAD_MAKE_RV_REF((shared_lock<Mutex>(mutex_for(key))));
+    }
+
+#if ! defined BOOST_NO_CXX11_VARIADIC_TEMPLATES
+    /**
+     * @return a lock owning the stripes of @c keys, each one locked once, in the order of their indices.
+     */
+    template <typename ...Keys>
+    lock_set_type lock_all_for(Keys const& ...keys)
+    {
+      std::size_t const indices[] = { index_of(keys)... };
+      std::vector<std::size_t> v(indices, indices + sizeof...(Keys));
+      return BOOST_THREAD_MAKE_RV_REF((lock_set_type(*this, v)));
+    }
+    /**
+     * @return a lock owning the stripes of @c keys in shared mode, each one locked once, in the order of their indices.
+     */
+    template <typename ...Keys>
+    shared_lock_set_type lock_all_shared_for(Keys const& ...keys)
+    {
+      std::size_t const indices[] = { index_of(keys)... };
+      std::vector<std::size_t> v(indices, indices + sizeof...(Keys));
+      return BOOST_THREAD_MAKE_RV_REF((shared_lock_set_type(*this, v)));
+    }
+#else
+    template <typename K1, typename K2>
+    lock_set_type lock_all_for(K1 const& k1, K2 const& k2)
+    {
+      std::vector<std::size_t> v;
+      add_index(v, k1);
+      add_index(v, k2);
+      return BOOST_THREAD_MAKE_RV_REF((lock_set_type(*this, v)));
+    }
+    template <typename K1, typename K2, typename K3>
+    lock_set_type lock_all_for(K1 const& k1, K2 const& k2, K3 const& k3)
+    {
+      std::vector<std::size_t> v;
+      add_index(v, k1);
+      add_index(v, k2);
+      add_index(v, k3);
+      return BOOST_THREAD_MAKE_RV_REF((lock_set_type(*this, v)));
+    }
+    template <typename K1, typename K2>
+    shared_lock_set_type lock_all_shared_for(K1 const& k1, K2 const& k2)
+    {
+      std::vector<std::size_t> v;
+      add_index(v, k1);
+      add_index(v, k2);
+      return BOOST_THREAD_MAKE_RV_REF((shared_lock_set_type(*this, v)));
+    }
+    template <typename K1, typename K2, typename K3>
+    shared_lock_set_type lock_all_shared_for(K1 const& k1, K2 const& k2, K3 const& k3)
+    {
+      std::vector<std::size_t> v;
+      add_index(v, k1);
+      add_index(v, k2);
+      add_index(v, k3);
+      return BOOST_THREAD_MAKE_RV_REF((shared_lock_set_type(*this, v)));
+    }
+#endif
+
+    /**
+     * @return a lock owning the stripes of the keys in [first, last), each one locked once, in the order of their
+     * indices.
+     */
+    template <typename InputIterator>
+    lock_set_type lock_range_for(InputIterator first, InputIterator last)
+    {
+      std::vector<std::size_t> v;
+      for (; first != last; ++first) add_index(v, *first);
+      return BOOST_THREAD_MAKE_RV_REF((lock_set_type(*this, v)));
+    }
+    template <typename InputIterator>
+    shared_lock_set_type lock_range_shared_for(InputIterator first, InputIterator last)
+    {
+      std::vector<std::size_t> v;
+      for (; first != last; ++first) add_index(v, *first);
+      return BOOST_THREAD_MAKE_RV_REF((shared_lock_set_type(*this, v)));
+    }
+
+    /**
+     * @return a lock owning all the stripes, to access the whole structure, e.g. to resize it.
+     */
+    lock_set_type lock_all()
+    {
+      std::vector<std::size_t> v(N);
+      for (std::size_t i = 0; i < N; ++i) v[i] = i;
+      return BOOST_THREAD_MAKE_RV_REF((lock_set_type(*this, v)));
+    }
+    /**
+     * @return a lock owning all the stripes in shared mode, to read the whole structure, e.g. to iterate over it.
+     */
+    shared_lock_set_type lock_all_shared()
+    {
+      std::vector<std::size_t> v(N);
+      for (std::size_t i = 0; i < N; ++i) v[i] = i;
+      return BOOST_THREAD_MAKE_RV_REF((shared_lock_set_type(*this, v)));
+    }
+  };
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
@@ -19,6 +19,7 @@
 #include <boost/thread/strict_lock.hpp>
 #include <boost/core/invoke_swap.hpp>
 #include <boost/type_traits/declval.hpp>
+#include <boost/type_traits/integral_constant.hpp>
 //#include <boost/type_traits.hpp>
 //#include <boost/thread/detail/is_nothrow_default_constructible.hpp>
 //#if ! defined BOOST_NO_CXX11_HDR_TYPE_TRAITS
@@ -27,8 +28,8 @@
 
 #if ! defined(BOOST_THREAD_NO_SYNCHRONIZE)
 #include <tuple> // todo change to <boost/tuple.hpp> once Boost.Tuple or Boost.Fusion provides Move semantics on C++98 compilers.
-#include <functional>
 #endif
+#include <functional>
 
 #include <boost/utility/result_of.hpp>
 
@@ -383,10 +384,47 @@ namespace boost
   {
    typedef const_unique_lock_ptr<typename SV::value_type, typename SV::mutex_type> type;
   };
+  namespace detail
+  {
+    /**
+     * Whether the observers of synchronized_value<T, Lockable> copy the value without locking the mutex.
+     * Specialized by the mutexes supporting it, e.g. seqlock.
+     */
+    template <typename T, typename Lockable>
+    struct synchronized_value_reads_optimistically : false_type {};
+
+    /**
+     * Whether the calls of synchronized_value<T, Lockable>::operator() are executed by the combiner of the mutex.
+     * Specialized by the combining mutexes, e.g. flat_combining_mutex.
+     */
+    template <typename Lockable>
+    struct synchronized_value_combines_calls : false_type {};
+
+    // call of a function on the protected value, to be executed by the combiner.
+    template <typename F, typename V>
+    struct synchronized_value_call
+    {
+      typedef typename boost::result_of<F(V&)>::type result_type;
+      F& fct;
+      V& value;
+
+      synchronized_value_call(F& fct, V& value) : fct(fct), value(value) {}
+
+      result_type operator()()
+      {
+        return fct(value);
+      }
+    };
+  }
+
   /**
    * cloaks a value type and the mutex used to protect it together.
    * @param T the value type.
    * @param Lockable the mutex type protecting the value type.
+   *
+   * When Lockable is seqlock and T is trivially copyable, get() and the relational operators copy the value
+   * optimistically instead of locking the mutex. When Lockable is flat_combining_mutex, the calls of operator() are
+   * combined.
    */
   template <typename T, typename Lockable = mutex>
   class synchronized_value
@@ -419,6 +457,69 @@ namespace boost
   private:
     T value_;
     mutable mutex_type mtx_;
+
+    typedef integral_constant<bool, detail::synchronized_value_reads_optimistically<T, Lockable>::value> optimistic_reads;
+    typedef integral_constant<bool, detail::synchronized_value_combines_calls<Lockable>::value> combining_calls;
+
+    T get(false_type) const
+    {
+      strict_lock<mutex_type> lk(mtx_);
+      return value_;
+    }
+    T get(true_type) const
+    {
+      return mtx_.read(value_);
+    }
+
+    template <typename F, typename V>
+    typename boost::result_of<F(V&)>::type call(F& fct, V& value, false_type) const
+    {
+      strict_lock<mutex_type> lk(mtx_);
+      return fct(value);
+    }
+    template <typename F, typename V>
+    typename boost::result_of<F(V&)>::type call(F& fct, V& value, true_type) const
+    {
+      detail::synchronized_value_call<F, V> c(fct, value);
+      return mtx_.combine(c);
+    }
+
+    template <typename Compare>
+    bool compare(value_type const& rhs, Compare cmp, false_type) const
+    {
+      unique_lock<mutex_type> lk1(mtx_);
+
+      return cmp(value_, rhs);
+    }
+    template <typename Compare>
+    bool compare(value_type const& rhs, Compare cmp, true_type) const
+    {
+      return cmp(mtx_.read(value_), rhs);
+    }
+
+    template <typename Compare>
+    bool compare(synchronized_value const& rhs, Compare cmp, false_type) const
+    {
+      unique_lock<mutex_type> lk1(mtx_, defer_lock);
+      unique_lock<mutex_type> lk2(rhs.mtx_, defer_lock);
+      lock(lk1,lk2);
+
+      return cmp(value_, rhs.value_);
+    }
+    template <typename Compare>
+    bool compare(synchronized_value const& rhs, Compare cmp, true_type) const
+    {
+      for (;;)
+      {
+        unsigned const s1 = mtx_.read_begin();
+        unsigned const s2 = rhs.mtx_.read_begin();
+        T const lhs_value = mtx_.copy(value_);
+        T const rhs_value = rhs.mtx_.copy(rhs.value_);
+        // both values have been stable since the second read_begin(), so that they are compared as they were at the
+        // same time.
+        if (! mtx_.read_retry(s1) && ! rhs.mtx_.read_retry(s2)) return cmp(lhs_value, rhs_value);
+      }
+    }
   public:
     // construction/destruction
     /**
@@ -519,13 +620,13 @@ namespace boost
      * Explicit conversion to value type.
      *
      * Requires: T is CopyConstructible
-     * Return: A copy of the protected value obtained on a scope protected by the mutex.
+     * Return: A copy of the protected value obtained on a scope protected by the mutex, or copied optimistically
+     * when the mutex is a seqlock and T is trivially copyable.
      *
      */
     T get() const
     {
-      strict_lock<mutex_type> lk(mtx_);
-      return value_;
+      return get(optimistic_reads());
     }
     /**
      * Explicit conversion to value type.
@@ -618,6 +719,9 @@ namespace boost
      *
      * @requires fct(value_) is well formed.
      *
+     * When the mutex is a flat_combining_mutex, fct can be executed by the thread owning the mutex together with the
+     * calls of the other waiting threads.
+     *
      * Example
      *   void fun(synchronized_value<vector<int>> & v) {
      *     v ( [](vector<int>> & vec)
@@ -632,16 +736,14 @@ namespace boost
     typename boost::result_of<F(value_type&)>::type
     operator()(BOOST_THREAD_RV_REF(F) fct)
     {
-      strict_lock<mutex_type> lk(mtx_);
-      return fct(value_);
+      return call(fct, value_, combining_calls());
     }
     template <typename F>
     inline
     typename boost::result_of<F(value_type const&)>::type
     operator()(BOOST_THREAD_RV_REF(F) fct) const
     {
-      strict_lock<mutex_type> lk(mtx_);
-      return fct(value_);
+      return call(fct, value_, combining_calls());
     }
 
 
@@ -651,31 +753,27 @@ namespace boost
     typename boost::result_of<F(value_type&)>::type
     operator()(F const & fct)
     {
-      strict_lock<mutex_type> lk(mtx_);
-      return fct(value_);
+      return call(fct, value_, combining_calls());
     }
     template <typename F>
     inline
     typename boost::result_of<F(value_type const&)>::type
     operator()(F const & fct) const
     {
-      strict_lock<mutex_type> lk(mtx_);
-      return fct(value_);
+      return call(fct, value_, combining_calls());
     }
 
     template <typename R>
     inline
     R operator()(R(*fct)(value_type&))
     {
-      strict_lock<mutex_type> lk(mtx_);
-      return fct(value_);
+      return call(fct, value_, combining_calls());
     }
     template <typename R>
     inline
     R operator()(R(*fct)(value_type const&)) const
     {
-      strict_lock<mutex_type> lk(mtx_);
-      return fct(value_);
+      return call(fct, value_, combining_calls());
     }
 #endif
 
@@ -840,11 +938,7 @@ namespace boost
      */
     bool operator==(synchronized_value const& rhs)  const
     {
-      unique_lock<mutex_type> lk1(mtx_, defer_lock);
-      unique_lock<mutex_type> lk2(rhs.mtx_, defer_lock);
-      lock(lk1,lk2);
-
-      return value_ == rhs.value_;
+      return compare(rhs, std::equal_to<T>(), optimistic_reads());
     }
     /**
      * @requires T is LessThanComparable
@@ -852,11 +946,7 @@ namespace boost
      */
     bool operator<(synchronized_value const& rhs) const
     {
-      unique_lock<mutex_type> lk1(mtx_, defer_lock);
-      unique_lock<mutex_type> lk2(rhs.mtx_, defer_lock);
-      lock(lk1,lk2);
-
-      return value_ < rhs.value_;
+      return compare(rhs, std::less<T>(), optimistic_reads());
     }
     /**
      * @requires T is GreaterThanComparable
@@ -864,63 +954,39 @@ namespace boost
      */
     bool operator>(synchronized_value const& rhs) const
     {
-      unique_lock<mutex_type> lk1(mtx_, defer_lock);
-      unique_lock<mutex_type> lk2(rhs.mtx_, defer_lock);
-      lock(lk1,lk2);
-
-      return value_ > rhs.value_;
+      return compare(rhs, std::greater<T>(), optimistic_reads());
     }
     bool operator<=(synchronized_value const& rhs) const
     {
-      unique_lock<mutex_type> lk1(mtx_, defer_lock);
-      unique_lock<mutex_type> lk2(rhs.mtx_, defer_lock);
-      lock(lk1,lk2);
-
-      return value_ <= rhs.value_;
+      return compare(rhs, std::less_equal<T>(), optimistic_reads());
     }
     bool operator>=(synchronized_value const& rhs) const
     {
-      unique_lock<mutex_type> lk1(mtx_, defer_lock);
-      unique_lock<mutex_type> lk2(rhs.mtx_, defer_lock);
-      lock(lk1,lk2);
-
-      return value_ >= rhs.value_;
+      return compare(rhs, std::greater_equal<T>(), optimistic_reads());
     }
     bool operator==(value_type const& rhs) const
     {
-      unique_lock<mutex_type> lk1(mtx_);
-
-      return value_ == rhs;
+      return compare(rhs, std::equal_to<T>(), optimistic_reads());
     }
     bool operator!=(value_type const& rhs) const
     {
-      unique_lock<mutex_type> lk1(mtx_);
-
-      return value_ != rhs;
+      return compare(rhs, std::not_equal_to<T>(), optimistic_reads());
     }
     bool operator<(value_type const& rhs) const
     {
-      unique_lock<mutex_type> lk1(mtx_);
-
-      return value_ < rhs;
+      return compare(rhs, std::less<T>(), optimistic_reads());
     }
     bool operator<=(value_type const& rhs) const
     {
-      unique_lock<mutex_type> lk1(mtx_);
-
-      return value_ <= rhs;
+      return compare(rhs, std::less_equal<T>(), optimistic_reads());
     }
     bool operator>(value_type const& rhs) const
     {
-      unique_lock<mutex_type> lk1(mtx_);
-
-      return value_ > rhs;
+      return compare(rhs, std::greater<T>(), optimistic_reads());
     }
     bool operator>=(value_type const& rhs) const
     {
-      unique_lock<mutex_type> lk1(mtx_);
-
-      return value_ >= rhs;
+      return compare(rhs, std::greater_equal<T>(), optimistic_reads());
     }
 
   };
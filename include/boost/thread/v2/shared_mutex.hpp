@@ -150,6 +150,9 @@ public:
  */
 
 #include <boost/thread/detail/config.hpp>
+#if defined BOOST_THREAD_ATOMIC_SHARED_MUTEX && defined BOOST_THREAD_PLATFORM_PTHREAD
+#include <boost/thread/v2/shared_mutex_atomic.hpp>
+#else
 #include <boost/thread/mutex.hpp>
 #include <boost/thread/condition_variable.hpp>
 #include <boost/thread/mutex.hpp>
@@ -1049,4 +1052,5 @@ namespace boost {
   typedef thread_v2::upgrade_mutex shared_mutex;
 }
 
+#endif // BOOST_THREAD_ATOMIC_SHARED_MUTEX
 #endif
@@ -0,0 +1,577 @@
+#ifndef BOOST_THREAD_V2_SHARED_MUTEX_ATOMIC_HPP
+#define BOOST_THREAD_V2_SHARED_MUTEX_ATOMIC_HPP
+
+//  shared_mutex_atomic.hpp
+//
+// Copyright The Boost.Thread Contributors 2026.
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/thread/detail/config.hpp>
+#include <boost/thread/pthread/futex.hpp>
+#include <boost/assert.hpp>
+#include <boost/cstdint.hpp>
+#ifdef BOOST_THREAD_USES_CHRONO
+#include <boost/chrono.hpp>
+#endif
+
+namespace boost {
+  namespace thread_v2 {
+
+    /**
+     * The state of the mutex is the one of the mutex based implementation, plus two bits telling whether some threads
+     * are parked at each gate, so that an uncontended operation is a single atomic operation on the state.
+     * The threads waiting at the first gate are parked on the state itself. The thread which has entered the first
+     * gate as the writer and waits for the readers to leave is parked on a second word, incremented by the last
+     * reader leaving.
+     */
+    class upgrade_mutex
+    {
+      typedef uint32_t count_t;
+
+      static const count_t write_entered_ = 0x80000000u;
+      static const count_t upgradable_entered_ = 0x40000000u;
+      static const count_t gate1_parked_ = 0x20000000u;
+      static const count_t gate2_parked_ = 0x10000000u;
+      static const count_t n_readers_ = 0x0FFFFFFFu;
+
+      enum gate1_entry
+      {
+        exclusive_entry,
+        shared_entry,
+        upgrade_entry,
+        shared_to_exclusive_entry,
+        shared_to_upgrade_entry
+      };
+
+      detail::futex_word state_;
+      detail::futex_word gate2_;
+
+      upgrade_mutex(const upgrade_mutex&);
+      upgrade_mutex& operator=(const upgrade_mutex&);
+
+      // Returns: whether the gate1 predicate of the entry e holds in the state s, next being the state after entering.
+      static bool can_enter(gate1_entry e, count_t s, count_t& next)
+      {
+        switch (e)
+        {
+        case exclusive_entry:
+          next = s | write_entered_;
+          return (s & (write_entered_ | upgradable_entered_)) == 0;
+        case shared_entry:
+          next = s + 1;
+          return (s & write_entered_) == 0 && (s & n_readers_) != n_readers_;
+        case upgrade_entry:
+          next = (s + 1) | upgradable_entered_;
+          return (s & (write_entered_ | upgradable_entered_)) == 0 && (s & n_readers_) != n_readers_;
+        case shared_to_exclusive_entry:
+          next = (s - 1) | write_entered_;
+          return (s & (write_entered_ | upgradable_entered_)) == 0;
+        case shared_to_upgrade_entry:
+          next = s | upgradable_entered_;
+          return (s & (write_entered_ | upgradable_entered_)) == 0;
+        }
+        return false;
+      }
+
+      // Effects: Enters the first gate if possible, or marks the state as having threads parked at this gate.
+      // Returns: whether the gate has been entered, s being otherwise the value on which the thread can wait.
+      bool try_enter_gate1(gate1_entry e, count_t& s)
+      {
+        for (;;)
+        {
+          count_t next;
+          if (can_enter(e, s, next))
+          {
+            if (state_.compare_exchange_weak(s, next, memory_order_acquire, memory_order_relaxed)) return true;
+            continue;
+          }
+          next = s | gate1_parked_;
+          if (next == s || state_.compare_exchange_weak(s, next, memory_order_relaxed, memory_order_relaxed))
+          {
+            s = next;
+            return false;
+          }
+        }
+      }
+
+      void enter_gate1(gate1_entry e)
+      {
+        count_t s = state_.load(memory_order_relaxed);
+        while (! try_enter_gate1(e, s))
+        {
+          detail::futex_wait(state_, s);
+          s = state_.load(memory_order_relaxed);
+        }
+      }
+
+      template <class Deadline>
+      bool enter_gate1_until(gate1_entry e, Deadline const& deadline)
+      {
+        count_t s = state_.load(memory_order_relaxed);
+        while (! try_enter_gate1(e, s))
+        {
+          if (! detail::futex_wait_until(state_, s, deadline)) return false;
+          s = state_.load(memory_order_relaxed);
+        }
+        return true;
+      }
+
+      bool try_enter(gate1_entry e)
+      {
+        count_t s = state_.load(memory_order_relaxed);
+        count_t next;
+        while (can_enter(e, s, next))
+        {
+          if (state_.compare_exchange_weak(s, next, memory_order_acquire, memory_order_relaxed)) return true;
+        }
+        return false;
+      }
+
+      // Requires: The calling thread has set write_entered_.
+      // Returns: whether there are no more readers, g being otherwise the value of gate2_ on which the thread can wait.
+      bool try_enter_gate2(count_t& g)
+      {
+        // gate2_ is read before the state, so that its increment by the last reader leaving is seen by futex_wait.
+        g = gate2_.load(memory_order_acquire);
+        count_t s = state_.load(memory_order_acquire);
+        for (;;)
+        {
+          if ((s & n_readers_) == 0) return true;
+          if ((s & gate2_parked_) ||
+              state_.compare_exchange_weak(s, s | gate2_parked_, memory_order_acq_rel, memory_order_acquire))
+          {
+            return false;
+          }
+        }
+      }
+
+      void enter_gate2()
+      {
+        count_t g;
+        while (! try_enter_gate2(g))
+        {
+          detail::futex_wait(gate2_, g);
+        }
+      }
+
+      template <class Deadline>
+      bool enter_gate2_until(Deadline const& deadline)
+      {
+        count_t g;
+        while (! try_enter_gate2(g))
+        {
+          if (! detail::futex_wait_until(gate2_, g, deadline)) return false;
+        }
+        return true;
+      }
+
+      void open_gate1()
+      {
+        if (state_.fetch_and(~gate1_parked_, memory_order_relaxed) & gate1_parked_) detail::futex_wake_all(state_);
+      }
+
+      void open_gate2()
+      {
+        state_.fetch_and(~gate2_parked_, memory_order_relaxed);
+        gate2_.fetch_add(1, memory_order_release);
+        detail::futex_wake_one(gate2_);
+      }
+
+      // Effects: Replaces the state s by transform(s), and opens the first gate to the threads parked there if any.
+      template <class Transform>
+      void release(Transform transform)
+      {
+        count_t s = state_.load(memory_order_relaxed);
+        while (! state_.compare_exchange_weak(s, transform(s) & ~gate1_parked_, memory_order_release, memory_order_relaxed))
+        {
+        }
+        if (s & gate1_parked_) detail::futex_wake_all(state_);
+      }
+
+      struct withdraw_writer
+      {
+        count_t operator()(count_t s) const { return s & ~(write_entered_ | gate2_parked_); }
+      };
+      struct withdraw_shared_to_writer
+      {
+        count_t operator()(count_t s) const { return (s + 1) & ~(write_entered_ | gate2_parked_); }
+      };
+      struct withdraw_upgrade_to_writer
+      {
+        count_t operator()(count_t s) const { return ((s + 1) | upgradable_entered_) & ~(write_entered_ | gate2_parked_); }
+      };
+      struct to_shared
+      {
+        count_t operator()(count_t) const { return 1; }
+      };
+      struct to_upgrade
+      {
+        count_t operator()(count_t) const { return upgradable_entered_ | 1; }
+      };
+      struct unlock_upgrade_transform
+      {
+        count_t operator()(count_t s) const { return (s - 1) & ~upgradable_entered_; }
+      };
+      struct upgrade_to_shared
+      {
+        count_t operator()(count_t s) const { return s & ~upgradable_entered_; }
+      };
+
+      template <class Deadline>
+      bool lock_until(Deadline const& deadline)
+      {
+        if (! enter_gate1_until(exclusive_entry, deadline)) return false;
+        if (! enter_gate2_until(deadline))
+        {
+          release(withdraw_writer());
+          return false;
+        }
+        return true;
+      }
+
+      // Sets write_entered_ in place of the upgrade ownership, then waits for the other readers to leave.
+      void upgrade_to_writer()
+      {
+        count_t s = state_.load(memory_order_relaxed);
+        while (! state_.compare_exchange_weak(s, ((s - 1) & ~upgradable_entered_) | write_entered_,
+            memory_order_acquire, memory_order_relaxed))
+        {
+        }
+      }
+
+    public:
+      upgrade_mutex() : state_(0), gate2_(0)
+      {
+      }
+
+      // Exclusive ownership
+
+      void lock()
+      {
+        enter_gate1(exclusive_entry);
+        enter_gate2();
+      }
+
+      bool try_lock()
+      {
+        count_t s = state_.load(memory_order_relaxed);
+        while ((s & (write_entered_ | upgradable_entered_ | n_readers_)) == 0)
+        {
+          if (state_.compare_exchange_weak(s, s | write_entered_, memory_order_acquire, memory_order_relaxed)) return true;
+        }
+        return false;
+      }
+
+#ifdef BOOST_THREAD_USES_CHRONO
+      template <class Rep, class Period>
+      bool try_lock_for(const boost::chrono::duration<Rep, Period>& rel_time)
+      {
+        return try_lock_until(chrono::steady_clock::now() + rel_time);
+      }
+      template <class Clock, class Duration>
+      bool try_lock_until(
+          const boost::chrono::time_point<Clock, Duration>& abs_time)
+      {
+        return lock_until(detail::futex_chrono_deadline<Clock, Duration>(abs_time));
+      }
+#endif
+#if defined BOOST_THREAD_USES_DATETIME
+      bool timed_lock(system_time const& abs_time)
+      {
+        return lock_until(detail::futex_real_deadline(abs_time));
+      }
+      template<typename TimeDuration>
+      bool timed_lock(TimeDuration const & rel_time)
+      {
+        return lock_until(detail::futex_relative_deadline(detail::platform_duration(rel_time)));
+      }
+#endif
+
+      void unlock()
+      {
+        count_t s = state_.exchange(0, memory_order_release);
+        BOOST_ASSERT((s & write_entered_) != 0);
+        BOOST_ASSERT((s & (upgradable_entered_ | n_readers_)) == 0);
+        // notify all since multiple *lock_shared*() calls and a *lock_upgrade*()
+        // call may be able to proceed in response to this notification
+        if (s & gate1_parked_) detail::futex_wake_all(state_);
+      }
+
+      // Shared ownership
+
+      void lock_shared()
+      {
+        count_t s = state_.load(memory_order_relaxed);
+        if ((s & write_entered_) == 0 && (s & n_readers_) != n_readers_ &&
+            state_.compare_exchange_weak(s, s + 1, memory_order_acquire, memory_order_relaxed))
+        {
+          return;
+        }
+        enter_gate1(shared_entry);
+      }
+
+      bool try_lock_shared()
+      {
+        return try_enter(shared_entry);
+      }
+
+#ifdef BOOST_THREAD_USES_CHRONO
+      template <class Rep, class Period>
+      bool try_lock_shared_for(const boost::chrono::duration<Rep, Period>& rel_time)
+      {
+        return try_lock_shared_until(chrono::steady_clock::now() + rel_time);
+      }
+      template <class Clock, class Duration>
+      bool try_lock_shared_until(
+          const boost::chrono::time_point<Clock, Duration>& abs_time)
+      {
+        return enter_gate1_until(shared_entry, detail::futex_chrono_deadline<Clock, Duration>(abs_time));
+      }
+#endif
+#if defined BOOST_THREAD_USES_DATETIME
+      bool timed_lock_shared(system_time const& abs_time)
+      {
+        return enter_gate1_until(shared_entry, detail::futex_real_deadline(abs_time));
+      }
+      template<typename TimeDuration>
+      bool timed_lock_shared(TimeDuration const & rel_time)
+      {
+        return enter_gate1_until(shared_entry, detail::futex_relative_deadline(detail::platform_duration(rel_time)));
+      }
+#endif
+
+      void unlock_shared()
+      {
+        count_t s = state_.fetch_sub(1, memory_order_acq_rel);
+        BOOST_ASSERT((s & n_readers_) > 0);
+        if (s & write_entered_)
+        {
+          if ((s & n_readers_) == 1 && (s & gate2_parked_)) open_gate2();
+        }
+        else if ((s & n_readers_) == n_readers_)
+        {
+          open_gate1();
+        }
+      }
+
+      // Upgrade ownership
+
+      void lock_upgrade()
+      {
+        enter_gate1(upgrade_entry);
+      }
+
+      bool try_lock_upgrade()
+      {
+        return try_enter(upgrade_entry);
+      }
+
+#ifdef BOOST_THREAD_USES_CHRONO
+      template <class Rep, class Period>
+      bool try_lock_upgrade_for(
+          const boost::chrono::duration<Rep, Period>& rel_time)
+      {
+        return try_lock_upgrade_until(chrono::steady_clock::now() + rel_time);
+      }
+      template <class Clock, class Duration>
+      bool try_lock_upgrade_until(
+          const boost::chrono::time_point<Clock, Duration>& abs_time)
+      {
+        return enter_gate1_until(upgrade_entry, detail::futex_chrono_deadline<Clock, Duration>(abs_time));
+      }
+#endif
+#if defined BOOST_THREAD_USES_DATETIME
+      bool timed_lock_upgrade(system_time const& abs_time)
+      {
+        return enter_gate1_until(upgrade_entry, detail::futex_real_deadline(abs_time));
+      }
+      template<typename TimeDuration>
+      bool timed_lock_upgrade(TimeDuration const & rel_time)
+      {
+        return enter_gate1_until(upgrade_entry, detail::futex_relative_deadline(detail::platform_duration(rel_time)));
+      }
+#endif
+
+      void unlock_upgrade()
+      {
+        BOOST_ASSERT((state_.load(memory_order_relaxed) & upgradable_entered_) != 0);
+        // both a *lock*() and a *lock_shared*() call may be able to proceed
+        release(unlock_upgrade_transform());
+      }
+
+      // Shared <-> Exclusive
+
+#ifdef BOOST_THREAD_PROVIDES_SHARED_MUTEX_UPWARDS_CONVERSIONS
+      bool try_unlock_shared_and_lock()
+      {
+        count_t s = state_.load(memory_order_relaxed);
+        BOOST_ASSERT((s & n_readers_) > 0);
+        while ((s & (write_entered_ | upgradable_entered_ | n_readers_)) == 1)
+        {
+          if (state_.compare_exchange_weak(s, (s - 1) | write_entered_, memory_order_acquire, memory_order_relaxed)) return true;
+        }
+        return false;
+      }
+#ifdef BOOST_THREAD_USES_CHRONO
+      template <class Rep, class Period>
+      bool try_unlock_shared_and_lock_for(
+          const boost::chrono::duration<Rep, Period>& rel_time)
+      {
+        return try_unlock_shared_and_lock_until(chrono::steady_clock::now() + rel_time);
+      }
+      template <class Clock, class Duration>
+      bool try_unlock_shared_and_lock_until(
+          const boost::chrono::time_point<Clock, Duration>& abs_time)
+      {
+        detail::futex_chrono_deadline<Clock, Duration> deadline(abs_time);
+        if (! enter_gate1_until(shared_to_exclusive_entry, deadline)) return false;
+        if (! enter_gate2_until(deadline))
+        {
+          release(withdraw_shared_to_writer());
+          return false;
+        }
+        return true;
+      }
+#endif
+#endif
+
+      void unlock_and_lock_shared()
+      {
+        BOOST_ASSERT((state_.load(memory_order_relaxed) & write_entered_) != 0);
+        // multiple *lock_shared*() calls and a *lock_upgrade*() call may be able to proceed
+        release(to_shared());
+      }
+
+      // Shared <-> Upgrade
+
+#ifdef BOOST_THREAD_PROVIDES_SHARED_MUTEX_UPWARDS_CONVERSIONS
+      bool try_unlock_shared_and_lock_upgrade()
+      {
+        BOOST_ASSERT((state_.load(memory_order_relaxed) & n_readers_) > 0);
+        return try_enter(shared_to_upgrade_entry);
+      }
+#ifdef BOOST_THREAD_USES_CHRONO
+      template <class Rep, class Period>
+      bool try_unlock_shared_and_lock_upgrade_for(
+          const boost::chrono::duration<Rep, Period>& rel_time)
+      {
+        return try_unlock_shared_and_lock_upgrade_until(chrono::steady_clock::now() + rel_time);
+      }
+      template <class Clock, class Duration>
+      bool try_unlock_shared_and_lock_upgrade_until(
+          const boost::chrono::time_point<Clock, Duration>& abs_time)
+      {
+        return enter_gate1_until(shared_to_upgrade_entry, detail::futex_chrono_deadline<Clock, Duration>(abs_time));
+      }
+#endif
+#endif
+
+      void unlock_upgrade_and_lock_shared()
+      {
+        BOOST_ASSERT((state_.load(memory_order_relaxed) & upgradable_entered_) != 0);
+        // only one *lock*() or *lock_upgrade*() call can win, but *lock_shared*() calls may also be waiting
+        release(upgrade_to_shared());
+      }
+
+      // Upgrade <-> Exclusive
+
+      void unlock_upgrade_and_lock()
+      {
+        BOOST_ASSERT((state_.load(memory_order_relaxed) & upgradable_entered_) != 0);
+        upgrade_to_writer();
+        enter_gate2();
+      }
+
+      bool try_unlock_upgrade_and_lock()
+      {
+        count_t s = state_.load(memory_order_relaxed);
+        BOOST_ASSERT((s & upgradable_entered_) != 0);
+        while ((s & n_readers_) == 1)
+        {
+          if (state_.compare_exchange_weak(s, (s & ~(upgradable_entered_ | n_readers_)) | write_entered_,
+              memory_order_acquire, memory_order_relaxed))
+          {
+            return true;
+          }
+        }
+        return false;
+      }
+
+#ifdef BOOST_THREAD_USES_CHRONO
+      template <class Rep, class Period>
+      bool try_unlock_upgrade_and_lock_for(
+          const boost::chrono::duration<Rep, Period>& rel_time)
+      {
+        return try_unlock_upgrade_and_lock_until(chrono::steady_clock::now() + rel_time);
+      }
+      template <class Clock, class Duration>
+      bool try_unlock_upgrade_and_lock_until(
+          const boost::chrono::time_point<Clock, Duration>& abs_time)
+      {
+        BOOST_ASSERT((state_.load(memory_order_relaxed) & upgradable_entered_) != 0);
+        upgrade_to_writer();
+        if (! enter_gate2_until(detail::futex_chrono_deadline<Clock, Duration>(abs_time)))
+        {
+          release(withdraw_upgrade_to_writer());
+          return false;
+        }
+        return true;
+      }
+#endif
+
+      void unlock_and_lock_upgrade()
+      {
+        BOOST_ASSERT((state_.load(memory_order_relaxed) & write_entered_) != 0);
+        // multiple *lock_shared*() calls may be able to proceed
+        release(to_upgrade());
+      }
+    };
+
+    /**
+     * shared_mutex is an upgrade_mutex whose upgrade ownership is never taken.
+     */
+    class shared_mutex : private upgrade_mutex
+    {
+    public:
+      shared_mutex() {}
+
+      // Exclusive ownership
+
+      using upgrade_mutex::lock;
+      using upgrade_mutex::try_lock;
+#ifdef BOOST_THREAD_USES_CHRONO
+      using upgrade_mutex::try_lock_for;
+      using upgrade_mutex::try_lock_until;
+#endif
+#if defined BOOST_THREAD_USES_DATETIME
+      using upgrade_mutex::timed_lock;
+#endif
+      using upgrade_mutex::unlock;
+
+      // Shared ownership
+
+      using upgrade_mutex::lock_shared;
+      using upgrade_mutex::try_lock_shared;
+#ifdef BOOST_THREAD_USES_CHRONO
+      using upgrade_mutex::try_lock_shared_for;
+      using upgrade_mutex::try_lock_shared_until;
+#endif
+#if defined BOOST_THREAD_USES_DATETIME
+      using upgrade_mutex::timed_lock_shared;
+#endif
+      using upgrade_mutex::unlock_shared;
+    };
+
+  }  // thread_v2
+}  // boost
+
+namespace boost {
+  //using thread_v2::shared_mutex;
+  using thread_v2::upgrade_mutex;
+  typedef thread_v2::upgrade_mutex shared_mutex;
+}
+
+#endif
@@ -46,6 +46,8 @@ namespace boost
         case future_errc::no_state:
             return std::string("Operation not permitted on an object without "
                           "an associated state.");
+        case future_errc::cancelled:
+            return std::string("The task has been cancelled before it started.");
         }
         return std::string("unspecified future_errc value\n");
     }
@@ -0,0 +1,137 @@
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/experimental/parallel/v1/algorithm.hpp>
+
+// for_each(ex, first, last, f), transform(ex, ...), sort(ex, ...)
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_PROVIDES_EXECUTORS
+#include <boost/config.hpp>
+#if ! defined  BOOST_NO_CXX11_DECLTYPE
+#define BOOST_RESULT_OF_USE_DECLTYPE
+#endif
+
+#include <boost/thread/experimental/parallel/v1/algorithm.hpp>
+#include <boost/thread/executors/basic_thread_pool.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/lexical_cast.hpp>
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using boost::experimental::parallel::v1::exception_list;
+namespace parallel = boost::experimental::parallel;
+
+struct twice
+{
+  void operator()(int& x) const
+  {
+    x *= 2;
+  }
+};
+
+struct negate
+{
+  int operator()(int x) const
+  {
+    return -x;
+  }
+};
+
+struct throw_on_odd
+{
+  void operator()(int x) const
+  {
+    if (x % 2 == 1) throw std::logic_error("odd");
+  }
+};
+
+struct throw_on_compare
+{
+  bool operator()(int, int) const
+  {
+    throw std::logic_error("compare");
+  }
+};
+
+int main()
+{
+  boost::basic_thread_pool pool(4);
+  const int n = 10007;
+  std::vector<int> v;
+  for (int i = 0; i < n; ++i) v.push_back(i);
+  {
+    std::vector<int> w(v);
+    parallel::for_each(pool, w.begin(), w.end(), twice());
+    bool ok = true;
+    for (int i = 0; i < n; ++i) if (w[i] != 2 * i) ok = false;
+    BOOST_TEST(ok);
+    std::vector<int> empty;
+    parallel::for_each(pool, empty.begin(), empty.end(), twice());
+  }
+  {
+    std::vector<int> out(n);
+    BOOST_TEST(parallel::transform(pool, v.begin(), v.end(), out.begin(), negate()) == out.end());
+    bool ok = true;
+    for (int i = 0; i < n; ++i) if (out[i] != -i) ok = false;
+    BOOST_TEST(ok);
+    std::vector<int> sum(n);
+    parallel::transform(pool, v.begin(), v.end(), out.begin(), sum.begin(), std::plus<int>());
+    BOOST_TEST(std::count(sum.begin(), sum.end(), 0) == n);
+  }
+  {
+    try
+    {
+      parallel::for_each(pool, v.begin(), v.end(), throw_on_odd());
+      BOOST_TEST(false);
+    }
+    catch (exception_list const& el)
+    {
+      BOOST_TEST(el.size() >= 1u);
+    }
+  }
+  {
+    std::vector<int> w;
+    for (int i = 0; i < n; ++i) w.push_back((i * 7919) % n);
+    parallel::sort(pool, w.begin(), w.end());
+    BOOST_TEST(w == v);
+    parallel::sort(pool, w.begin(), w.end(), std::greater<int>());
+    BOOST_TEST(std::is_sorted(w.begin(), w.end(), std::greater<int>()));
+    // many equal keys, which are split between the tasks of a merge.
+    std::vector<int> d;
+    for (int i = 0; i < n; ++i) d.push_back((i * 7919) % 5);
+    std::vector<int> sorted_d(d);
+    std::sort(sorted_d.begin(), sorted_d.end());
+    parallel::sort(pool, d.begin(), d.end());
+    BOOST_TEST(d == sorted_d);
+    // elements which are moved to the buffer and back.
+    std::vector<std::string> s;
+    for (int i = 0; i < n; ++i) s.push_back(boost::lexical_cast<std::string>((i * 7919) % n));
+    std::vector<std::string> sorted(s);
+    std::sort(sorted.begin(), sorted.end());
+    parallel::sort(pool, s.begin(), s.end());
+    BOOST_TEST(s == sorted);
+    std::vector<int> small(3, 1);
+    small[0] = 3;
+    parallel::sort(pool, small.begin(), small.end());
+    BOOST_TEST(small[0] == 1 && small[2] == 3);
+  }
+  {
+    std::vector<int> w(v);
+    try
+    {
+      parallel::sort(pool, w.begin(), w.end(), throw_on_compare());
+      BOOST_TEST(false);
+    }
+    catch (exception_list const& el)
+    {
+      BOOST_TEST(el.size() >= 1u);
+    }
+  }
+  return boost::report_errors();
+}
@@ -0,0 +1,97 @@
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/experimental/parallel/v1/numeric.hpp>
+
+// reduce(ex, ...), transform_reduce(ex, ...), inclusive_scan(ex, ...)
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_PROVIDES_EXECUTORS
+#include <boost/config.hpp>
+#if ! defined  BOOST_NO_CXX11_DECLTYPE
+#define BOOST_RESULT_OF_USE_DECLTYPE
+#endif
+
+#include <boost/thread/experimental/parallel/v1/numeric.hpp>
+#include <boost/thread/executors/basic_thread_pool.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using boost::experimental::parallel::v1::exception_list;
+namespace parallel = boost::experimental::parallel;
+
+struct square
+{
+  long operator()(int x) const
+  {
+    return long(x) * x;
+  }
+};
+
+struct throwing_plus
+{
+  int operator()(int, int) const
+  {
+    throw std::logic_error("plus");
+  }
+};
+
+int main()
+{
+  boost::basic_thread_pool pool(4);
+  const int n = 10007;
+  std::vector<int> v;
+  for (int i = 0; i < n; ++i) v.push_back(i);
+  const long sum = long(n) * (n - 1) / 2;
+  {
+    BOOST_TEST(parallel::reduce(pool, v.begin(), v.end(), 0L) == sum);
+    BOOST_TEST(parallel::reduce(pool, v.begin(), v.end(), 5L, std::plus<long>()) == sum + 5);
+    BOOST_TEST(parallel::reduce(pool, v.begin(), v.begin() + 1) == 0);
+    BOOST_TEST(parallel::reduce(pool, v.begin(), v.begin(), 3) == 3);
+  }
+  {
+    long squares = 0;
+    for (int i = 0; i < n; ++i) squares += long(i) * i;
+    BOOST_TEST(parallel::transform_reduce(pool, v.begin(), v.end(), 0L, std::plus<long>(), square()) == squares);
+    BOOST_TEST(parallel::transform_reduce(pool, v.begin(), v.end(), v.begin(), 0L) == squares);
+  }
+  {
+    // A non commutative operation with an associative one is scanned in order.
+    std::vector<std::string> words;
+    for (int i = 0; i < 100; ++i) words.push_back(std::string(1, char('a' + i % 26)));
+    std::vector<std::string> prefixes(words.size());
+    parallel::inclusive_scan(pool, words.begin(), words.end(), prefixes.begin(), std::plus<std::string>());
+    std::string expected;
+    bool ok = true;
+    for (std::size_t i = 0; i < words.size(); ++i)
+    {
+      expected += words[i];
+      if (prefixes[i] != expected) ok = false;
+    }
+    BOOST_TEST(ok);
+  }
+  {
+    std::vector<long> w(v.begin(), v.end());
+    BOOST_TEST(parallel::inclusive_scan(pool, w.begin(), w.end(), w.begin()) == w.end());
+    bool ok = true;
+    for (int i = 0; i < n; ++i) if (w[i] != long(i) * (i + 1) / 2) ok = false;
+    BOOST_TEST(ok);
+  }
+  {
+    try
+    {
+      parallel::reduce(pool, v.begin(), v.end(), 0, throwing_plus());
+      BOOST_TEST(false);
+    }
+    catch (exception_list const& el)
+    {
+      BOOST_TEST(el.size() >= 1u);
+    }
+  }
+  return boost::report_errors();
+}
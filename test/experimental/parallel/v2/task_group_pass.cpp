@@ -0,0 +1,159 @@
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/experimental/parallel/v2/task_group.hpp>
+
+// class task_group;
+// task_region(work_stealing_thread_pool&, F&&);
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_PROVIDES_EXECUTORS
+#include <boost/config.hpp>
+#if ! defined  BOOST_NO_CXX11_DECLTYPE
+#define BOOST_RESULT_OF_USE_DECLTYPE
+#endif
+
+#include <boost/thread/experimental/parallel/v2/task_group.hpp>
+#include <boost/thread/experimental/parallel/v2/task_region.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <stdexcept>
+
+#if ! defined BOOST_NO_CXX11_LAMBDAS && ! defined BOOST_NO_CXX11_THREAD_LOCAL
+using boost::experimental::parallel::v2::task_group;
+using boost::experimental::parallel::v2::task_region;
+using boost::experimental::parallel::v2::task_region_handle_gen;
+using boost::experimental::parallel::v1::exception_list;
+
+int fib(task_group& parent, int n)
+{
+  if (n < 2) return n;
+  int n1 = 0;
+  task_group g(parent.get_executor());
+  g.run([&]() { n1 = fib(g, n - 1); });
+  int n2 = fib(g, n - 2);
+  g.wait();
+  return n1 + n2;
+}
+
+int fib_region(boost::work_stealing_thread_pool& ex, int n)
+{
+  if (n < 2) return n;
+  int n1 = 0;
+  int n2 = 0;
+  task_region(ex, [&](task_region_handle_gen<boost::work_stealing_thread_pool>& trh)
+      {
+        trh.run([&]() { n1 = fib_region(ex, n - 1); });
+        n2 = fib_region(ex, n - 2);
+      });
+  return n1 + n2;
+}
+
+int main()
+{
+  {
+    // The recursion runs on a single worker without blocking it.
+    boost::work_stealing_thread_pool pool(1);
+    boost::future<int> f = boost::async(pool, [&pool]() {
+      task_group g(pool);
+      return fib(g, 18);
+    });
+    BOOST_TEST(f.get() == 2584);
+  }
+  {
+    boost::work_stealing_thread_pool pool(3);
+    task_group g(pool);
+    BOOST_TEST(fib(g, 20) == 6765);
+  }
+  {
+    boost::work_stealing_thread_pool pool(2);
+    boost::future<int> f = boost::async(pool, [&pool]() { return fib_region(pool, 16); });
+    BOOST_TEST(f.get() == 987);
+    BOOST_TEST(fib_region(pool, 12) == 144);
+  }
+  {
+    boost::work_stealing_thread_pool pool(2);
+    task_group g(pool);
+    boost::atomic<int> count(0);
+    for (int i = 0; i < 100; ++i)
+    {
+      g.run([&count]() { count.fetch_add(1); });
+    }
+    g.wait();
+    BOOST_TEST(count.load() == 100);
+    g.run([]() { throw std::logic_error("task"); });
+    try
+    {
+      g.wait();
+      BOOST_TEST(false);
+    }
+    catch (exception_list const& el)
+    {
+      BOOST_TEST(el.size() == 1u);
+    }
+    // The group can be reused once the exceptions have been reported.
+    BOOST_TEST(! g.is_canceled());
+    g.run([&count]() { count.fetch_add(1); });
+    g.wait();
+    BOOST_TEST(count.load() == 101);
+  }
+  {
+    // A thread outside the pool blocks once it has nothing to steal, and destroys each group as soon as it is joined.
+    boost::work_stealing_thread_pool pool(2);
+    boost::atomic<int> count(0);
+    for (int i = 0; i < 200; ++i)
+    {
+      task_group g(pool);
+      g.run([&count]() { boost::this_thread::sleep_for(boost::chrono::microseconds(50)); count.fetch_add(1); });
+      g.run([&count]() { count.fetch_add(1); });
+      g.wait();
+    }
+    BOOST_TEST(count.load() == 400);
+    {
+      task_group g(pool);
+      g.run([&g, &count]() {
+        boost::this_thread::sleep_for(boost::chrono::milliseconds(100));
+        // forked while the joiner is blocked.
+        g.run([&count]() { count.fetch_add(1); });
+      });
+      g.wait();
+      BOOST_TEST(count.load() == 401);
+    }
+  }
+  {
+    boost::work_stealing_thread_pool pool(2);
+    try
+    {
+      task_region(pool, [&](task_region_handle_gen<boost::work_stealing_thread_pool>& trh)
+          {
+            trh.run([]() { throw std::logic_error("region"); });
+            trh.run([]() {});
+          });
+      BOOST_TEST(false);
+    }
+    catch (exception_list const& el)
+    {
+      BOOST_TEST(el.size() >= 1u);
+    }
+  }
+  {
+    // Closures submitted from outside the pool are run; the pool runs the remaining ones before it is destroyed.
+    boost::atomic<int> count(0);
+    {
+      boost::work_stealing_thread_pool pool(2);
+      for (int i = 0; i < 1000; ++i)
+      {
+        pool.submit([&count]() { count.fetch_add(1); });
+      }
+    }
+    BOOST_TEST(count.load() == 1000);
+  }
+  return boost::report_errors();
+}
+#else
+int main()
+{
+  return boost::report_errors();
+}
+#endif
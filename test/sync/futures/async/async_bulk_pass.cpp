@@ -0,0 +1,146 @@
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/future.hpp>
+
+// template <class Executor, class F>
+//     future<vector<R>> async_bulk(Executor& ex, std::size_t n, F&& f);
+// template <class Executor, class RandomAccessIterator, class F>
+//     future<vector<R>> async_bulk(Executor& ex, RandomAccessIterator first, RandomAccessIterator last, F&& f);
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_PROVIDES_EXECUTORS
+
+#include <boost/thread/future.hpp>
+#include <boost/thread/executors/basic_thread_pool.hpp>
+#include <boost/thread/executors/loop_executor.hpp>
+#include <boost/atomic.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <stdexcept>
+#include <vector>
+
+struct twice
+{
+  int operator()(std::size_t i) const
+  {
+    return 2 * int(i);
+  }
+};
+
+struct is_odd
+{
+  bool operator()(std::size_t i) const
+  {
+    return i % 2 == 1;
+  }
+};
+
+struct counter
+{
+  boost::atomic<std::size_t>* calls;
+  void operator()(std::size_t) const
+  {
+    calls->fetch_add(1);
+  }
+};
+
+struct fail_at
+{
+  std::size_t index;
+  int operator()(std::size_t i) const
+  {
+    if (i == index) throw std::logic_error("bulk");
+    return 0;
+  }
+};
+
+int square(int x)
+{
+  return x * x;
+}
+
+int main()
+{
+  {
+    boost::basic_thread_pool pool(4);
+    const std::size_t n = 10000;
+    boost::future<boost::csbl::vector<int> > f = boost::async_bulk(pool, n, twice());
+    boost::csbl::vector<int> r = f.get();
+    BOOST_TEST(r.size() == n);
+    bool in_order = true;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      if (r[i] != 2 * int(i)) in_order = false;
+    }
+    BOOST_TEST(in_order);
+  }
+  {
+    // The jobs write adjacent results concurrently, which must not share a word as in a vector<bool>.
+    boost::basic_thread_pool pool(8);
+    const std::size_t n = 100000;
+    for (int k = 0; k < 10; ++k)
+    {
+      boost::future<boost::csbl::vector<bool> > f = boost::async_bulk(pool, n, is_odd());
+      boost::csbl::vector<bool> r = f.get();
+      BOOST_TEST(r.size() == n);
+      bool in_order = true;
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        if (r[i] != (i % 2 == 1)) in_order = false;
+      }
+      BOOST_TEST(in_order);
+    }
+  }
+  {
+    boost::basic_thread_pool pool(4);
+    boost::atomic<std::size_t> calls(0);
+    counter c = {&calls};
+    boost::future<void> f = boost::async_bulk(pool, 1000, c);
+    f.get();
+    BOOST_TEST(calls.load() == 1000u);
+  }
+  {
+    boost::basic_thread_pool pool(2);
+    fail_at g = {57};
+    boost::future<boost::csbl::vector<int> > f = boost::async_bulk(pool, 100, g);
+    try
+    {
+      f.get();
+      BOOST_TEST(false);
+    }
+    catch (std::logic_error&)
+    {
+    }
+  }
+  {
+    // Nothing to do: the future is ready and nothing is submitted.
+    boost::loop_executor ex;
+    boost::future<boost::csbl::vector<int> > f = boost::async_bulk(ex, 0, twice());
+    BOOST_TEST(f.is_ready());
+    BOOST_TEST(! ex.try_executing_one());
+    BOOST_TEST(f.get().empty());
+  }
+  {
+    // A single thread of execution runs all the indices.
+    boost::loop_executor ex;
+    boost::future<boost::csbl::vector<int> > f = boost::async_bulk(ex, 100, twice());
+    BOOST_TEST(ex.try_executing_one());
+    BOOST_TEST(f.is_ready());
+    BOOST_TEST(f.get()[99] == 198);
+    while (ex.try_executing_one())
+    {
+    }
+  }
+  {
+    boost::basic_thread_pool pool(3);
+    std::vector<int> v;
+    for (int i = 0; i < 50; ++i) v.push_back(i);
+    boost::csbl::vector<int> r = boost::async_bulk(pool, v.begin(), v.end(), &square).get();
+    BOOST_TEST(r.size() == v.size());
+    BOOST_TEST(r[7] == 49);
+    BOOST_TEST(r[49] == 49 * 49);
+  }
+  return boost::report_errors();
+}
@@ -0,0 +1,167 @@
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/future.hpp>
+
+// future<R> async(launch policy, stop_token const& st, F&&, ArgTypes&&...);
+// future<R> future<R>::then(stop_token const& st, F&&);
+// future<R> future<R>::then(launch policy, stop_token const& st, F&&);
+// future<R> shared_future<R>::then(stop_token const& st, F&&);
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_PROVIDES_EXECUTORS
+
+#include <boost/thread/future.hpp>
+#include <boost/thread/stop_token.hpp>
+#include <boost/thread/executors/loop_executor.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+int calls = 0;
+
+int answer()
+{
+  ++calls;
+  return 42;
+}
+
+int add(int x, int y)
+{
+  ++calls;
+  return x + y;
+}
+
+int twice(boost::future<int> f)
+{
+  ++calls;
+  return 2 * f.get();
+}
+
+int twice_shared(boost::shared_future<int> f)
+{
+  ++calls;
+  return 2 * f.get();
+}
+
+template <typename Future>
+bool is_cancelled(Future& f)
+{
+  try
+  {
+    f.get();
+  }
+  catch (boost::task_cancelled&)
+  {
+    return true;
+  }
+  catch (...)
+  {
+  }
+  return false;
+}
+
+int main()
+{
+  {
+    boost::stop_source src;
+    boost::stop_token tok = src.get_token();
+    src.request_stop();
+    calls = 0;
+    boost::future<int> f = boost::async(boost::launch::async, tok, &answer);
+    BOOST_TEST(is_cancelled(f));
+    BOOST_TEST(calls == 0);
+  }
+  {
+    boost::stop_source src;
+    boost::stop_token tok = src.get_token();
+    boost::future<int> f = boost::async(boost::launch::async, tok, &add, 40, 2);
+    BOOST_TEST(f.get() == 42);
+  }
+  {
+    // A deferred task is skipped if the stop is requested before it is waited for.
+    boost::stop_source src;
+    calls = 0;
+    boost::future<int> f = boost::async(boost::launch::deferred, src.get_token(), &answer);
+    src.request_stop();
+    BOOST_TEST(is_cancelled(f));
+    BOOST_TEST(calls == 0);
+  }
+  {
+    boost::stop_source src;
+    boost::future<int> f = boost::async(boost::launch::deferred, src.get_token(), &answer);
+    BOOST_TEST(f.get() == 42);
+    src.request_stop();
+  }
+  {
+    // A continuation not yet launched is never run.
+    boost::stop_source src;
+    boost::stop_token tok = src.get_token();
+    boost::promise<int> p;
+    calls = 0;
+    boost::future<int> f = p.get_future().then(tok, &twice);
+    src.request_stop();
+    BOOST_TEST(f.is_ready());
+    p.set_value(21);
+    BOOST_TEST(is_cancelled(f));
+    BOOST_TEST(calls == 0);
+  }
+  {
+    boost::stop_source src;
+    boost::promise<int> p;
+    boost::future<int> f = p.get_future().then(boost::launch::async, src.get_token(), &twice);
+    p.set_value(21);
+    BOOST_TEST(f.get() == 42);
+  }
+  {
+    boost::stop_source src;
+    boost::promise<int> p;
+    calls = 0;
+    boost::future<int> f = p.get_future().then(boost::launch::deferred, src.get_token(), &twice);
+    p.set_value(21);
+    src.request_stop();
+    BOOST_TEST(is_cancelled(f));
+    BOOST_TEST(calls == 0);
+  }
+  {
+    // The continuation of a ready future is not run once the stop has been requested.
+    boost::stop_source src;
+    src.request_stop();
+    calls = 0;
+    boost::future<int> f = boost::make_ready_future(21).then(boost::launch::sync, src.get_token(), &twice);
+    BOOST_TEST(is_cancelled(f));
+    BOOST_TEST(calls == 0);
+  }
+  {
+    boost::stop_source src;
+    boost::future<int> f = boost::make_ready_future(21).then(src.get_token(), &twice);
+    BOOST_TEST(f.get() == 42);
+  }
+  {
+    boost::stop_source src;
+    boost::stop_token tok = src.get_token();
+    boost::promise<int> p;
+    boost::shared_future<int> sf = p.get_future().share();
+    calls = 0;
+    boost::future<int> f1 = sf.then(tok, &twice_shared);
+    boost::future<int> f2 = sf.then(boost::launch::async, boost::stop_token(), &twice_shared);
+    src.request_stop();
+    p.set_value(21);
+    BOOST_TEST(is_cancelled(f1));
+    BOOST_TEST(f2.get() == 42);
+    BOOST_TEST(calls == 1);
+  }
+  {
+    // An lvalue token selects the stop_token overloads, not the executor ones.
+    boost::loop_executor ex;
+    boost::stop_source src;
+    boost::stop_token tok = src.get_token();
+    boost::future<int> f = boost::async(ex, tok, &answer);
+    boost::future<int> g = f.then(ex, tok, &twice);
+    while (! g.is_ready() && ex.try_executing_one())
+    {
+    }
+    BOOST_TEST(g.get() == 84);
+  }
+  return boost::report_errors();
+}
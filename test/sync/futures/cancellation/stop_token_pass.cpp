@@ -0,0 +1,172 @@
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/future.hpp>
+
+// future<R> async(Executor& ex, stop_token const& st, F&&, ArgTypes&&...);
+// future<R> future<R>::then(Executor& ex, stop_token const& st, F&&);
+// void packaged_task<R>::set_stop_token(stop_token const& st);
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_PROVIDES_EXECUTORS
+
+#include <boost/thread/future.hpp>
+#include <boost/thread/stop_token.hpp>
+#include <boost/thread/executors/basic_thread_pool.hpp>
+#include <boost/thread/executors/loop_executor.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+struct counter
+{
+  int* value;
+  explicit counter(int& v) : value(&v) {}
+  void operator()() { ++*value; }
+};
+
+int answer()
+{
+  return 42;
+}
+
+int twice(boost::future<int> f)
+{
+  return 2 * f.get();
+}
+
+int twice_shared(boost::shared_future<int> f)
+{
+  return 2 * f.get();
+}
+
+template <typename Future>
+bool is_cancelled(Future& f)
+{
+  try
+  {
+    f.get();
+  }
+  catch (boost::task_cancelled&)
+  {
+    return true;
+  }
+  catch (...)
+  {
+  }
+  return false;
+}
+
+int main()
+{
+  {
+    boost::stop_source src;
+    boost::stop_token tok = src.get_token();
+    BOOST_TEST(tok.stop_possible());
+    BOOST_TEST(! tok.stop_requested());
+    int calls = 0;
+    {
+      boost::stop_callback<counter> cb(tok, counter(calls));
+      BOOST_TEST(src.request_stop());
+      BOOST_TEST(! src.request_stop());
+      BOOST_TEST(calls == 1);
+    }
+    BOOST_TEST(tok.stop_requested());
+    boost::stop_callback<counter> late(tok, counter(calls));
+    BOOST_TEST(calls == 2);
+  }
+  {
+    boost::stop_token tok;
+    {
+      boost::stop_source src;
+      tok = src.get_token();
+      BOOST_TEST(tok.stop_possible());
+    }
+    BOOST_TEST(! tok.stop_possible());
+    BOOST_TEST(! boost::stop_token().stop_possible());
+  }
+  {
+    // A queued task is skipped and its future completes with task_cancelled.
+    boost::loop_executor ex;
+    boost::stop_source src;
+    boost::future<int> f = boost::async(ex, src.get_token(), &answer);
+    BOOST_TEST(! f.is_ready());
+    src.request_stop();
+    BOOST_TEST(f.is_ready());
+    BOOST_TEST(ex.try_executing_one());
+    BOOST_TEST(is_cancelled(f));
+  }
+  {
+    // Nothing is submitted once the stop has been requested.
+    boost::loop_executor ex;
+    boost::stop_source src;
+    src.request_stop();
+    boost::future<int> f = boost::async(ex, src.get_token(), &answer);
+    BOOST_TEST(! ex.try_executing_one());
+    BOOST_TEST(is_cancelled(f));
+  }
+  {
+    boost::loop_executor ex;
+    boost::stop_source src;
+    boost::future<int> f = boost::async(ex, src.get_token(), &answer);
+    BOOST_TEST(ex.try_executing_one());
+    src.request_stop();
+    BOOST_TEST(f.get() == 42);
+  }
+  {
+    // A continuation not yet launched is never scheduled.
+    boost::loop_executor ex;
+    boost::stop_source src;
+    boost::promise<int> p;
+    boost::future<int> f = p.get_future().then(ex, src.get_token(), &twice);
+    src.request_stop();
+    BOOST_TEST(f.is_ready());
+    p.set_value(21);
+    BOOST_TEST(! ex.try_executing_one());
+    BOOST_TEST(is_cancelled(f));
+  }
+  {
+    // The whole chain is cancelled, including the continuations already queued.
+    boost::loop_executor ex;
+    boost::stop_source src;
+    boost::promise<int> p;
+    boost::future<int> f = p.get_future().then(ex, src.get_token(), &twice)
+                                         .then(ex, src.get_token(), &twice);
+    p.set_value(21);
+    src.request_stop();
+    while (ex.try_executing_one())
+    {
+    }
+    BOOST_TEST(is_cancelled(f));
+  }
+  {
+    boost::basic_thread_pool pool(2);
+    boost::stop_source src;
+    boost::promise<int> p;
+    boost::shared_future<int> sf = p.get_future().share();
+    boost::future<int> f = sf.then(pool, src.get_token(), &twice_shared);
+    p.set_value(21);
+    BOOST_TEST(f.get() == 42);
+    src.request_stop();
+  }
+  {
+    boost::stop_source src;
+    boost::packaged_task<int()> task(&answer);
+    task.set_stop_token(src.get_token());
+    boost::future<int> f = task.get_future();
+    src.request_stop();
+    BOOST_TEST(f.is_ready());
+    task();
+    BOOST_TEST(is_cancelled(f));
+  }
+  {
+    boost::stop_source src;
+    boost::packaged_task<int()> task(&answer);
+    task.set_stop_token(src.get_token());
+    boost::future<int> f = task.get_future();
+    task();
+    src.request_stop();
+    BOOST_TEST(f.get() == 42);
+  }
+  return boost::report_errors();
+}
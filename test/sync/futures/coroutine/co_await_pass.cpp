@@ -0,0 +1,160 @@
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/futures/coroutine.hpp>
+
+// co_await future<R>, co_await shared_future<R>, co_await schedule(ex), task<T>
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_PROVIDES_EXECUTORS
+
+#include <boost/thread/futures/coroutine.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#if defined BOOST_THREAD_PROVIDES_COROUTINES
+
+#include <boost/thread/executors/basic_thread_pool.hpp>
+#include <boost/thread/thread.hpp>
+#include <stdexcept>
+#include <string>
+
+boost::task<int> await_future(boost::future<int> f)
+{
+  co_return 2 * co_await std::move(f);
+}
+
+boost::task<int> await_shared_future(boost::shared_future<int> f)
+{
+  int x = co_await f;
+  int y = co_await f;
+  co_return x + y;
+}
+
+boost::task<void> await_exceptional_future(boost::future<void> f, std::string& what)
+{
+  try
+  {
+    co_await std::move(f);
+  }
+  catch (std::logic_error& e)
+  {
+    what = e.what();
+  }
+}
+
+boost::task<boost::thread::id> resume_on(boost::basic_thread_pool& pool)
+{
+  co_await boost::schedule(pool);
+  co_return boost::this_thread::get_id();
+}
+
+boost::task<int> value(int v, bool& started)
+{
+  started = true;
+  co_return v;
+}
+
+boost::task<int> sum(int a, int b, bool& started)
+{
+  int x = co_await value(a, started);
+  int y = co_await value(b, started);
+  co_return x + y;
+}
+
+boost::task<int> thrower()
+{
+  throw std::logic_error("task");
+  co_return 0;
+}
+
+boost::task<std::string> catcher()
+{
+  try
+  {
+    co_await thrower();
+  }
+  catch (std::logic_error& e)
+  {
+    co_return e.what();
+  }
+  co_return "";
+}
+
+int main()
+{
+  {
+    boost::promise<int> p;
+    boost::future<int> f = await_future(p.get_future()).start();
+    BOOST_TEST(! f.is_ready());
+    boost::thread t([&p]() { p.set_value(21); });
+    BOOST_TEST(f.get() == 42);
+    t.join();
+  }
+  {
+    BOOST_TEST(await_future(boost::make_ready_future(4)).start().get() == 8);
+  }
+  {
+    boost::future<int> deferred = boost::async(boost::launch::deferred, []() { return 5; });
+    BOOST_TEST(await_future(std::move(deferred)).start().get() == 10);
+  }
+  {
+    boost::promise<int> p;
+    boost::future<int> f = await_shared_future(p.get_future().share()).start();
+    p.set_value(3);
+    BOOST_TEST(f.get() == 6);
+  }
+  {
+    boost::promise<void> p;
+    std::string what;
+    boost::future<void> f = await_exceptional_future(p.get_future(), what).start();
+    p.set_exception(std::logic_error("future"));
+    f.get();
+    BOOST_TEST(what == "future");
+  }
+  {
+    boost::basic_thread_pool pool(1);
+    boost::thread::id worker = boost::async(pool, []() { return boost::this_thread::get_id(); }).get();
+    BOOST_TEST(resume_on(pool).start().get() == worker);
+  }
+  {
+    bool started = false;
+    boost::task<int> t = sum(1, 2, started);
+    BOOST_TEST(! started);
+    BOOST_TEST(t.valid());
+    boost::future<int> f = t.start();
+    BOOST_TEST(! t.valid());
+    BOOST_TEST(started);
+    BOOST_TEST(f.get() == 3);
+  }
+  {
+    BOOST_TEST(catcher().start().get() == "task");
+    try
+    {
+      thrower().start().get();
+      BOOST_TEST(false);
+    }
+    catch (std::exception&)
+    {
+    }
+  }
+  {
+    bool started = false;
+    boost::future<boost::csbl::tuple<boost::future<int>, boost::future<int> > > all =
+        boost::when_all(value(1, started).start(), sum(2, 3, started).start());
+    boost::csbl::tuple<boost::future<int>, boost::future<int> > r = all.get();
+    BOOST_TEST(boost::csbl::get<0>(r).get() == 1);
+    BOOST_TEST(boost::csbl::get<1>(r).get() == 5);
+  }
+  return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+  return boost::report_errors();
+}
+
+#endif
@@ -0,0 +1,114 @@
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/future.hpp>
+
+// class future<R>
+
+// R future::get();
+
+// A worker of basic_thread_pool waiting for a future runs the closures queued on its pool instead of blocking.
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_PROVIDES_EXECUTORS
+#define BOOST_THREAD_PROVIDES_HELP_WHILE_WAITING
+
+#include <boost/thread/future.hpp>
+#include <boost/thread/executors/basic_thread_pool.hpp>
+#include <boost/atomic.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+
+#if defined BOOST_THREAD_PROVIDES_HELP_WHILE_WAITING
+
+int fib(boost::basic_thread_pool& pool, int n)
+{
+  if (n < 2) return n;
+  boost::future<int> a = boost::async(pool, &fib, boost::ref(pool), n - 1);
+  boost::future<int> b = boost::async(pool, &fib, boost::ref(pool), n - 2);
+  return a.get() + b.get();
+}
+
+struct record
+{
+  std::vector<int>* order;
+  int id;
+  void operator()() const
+  {
+    order->push_back(id);
+  }
+};
+
+int main()
+{
+  {
+    // Nested parallelism deeper than the pool width.
+    boost::basic_thread_pool pool(1);
+    BOOST_TEST(boost::async(pool, &fib, boost::ref(pool), 12).get() == 144);
+  }
+  {
+    boost::basic_thread_pool pool(2);
+    BOOST_TEST(boost::async(pool, &fib, boost::ref(pool), 15).get() == 610);
+  }
+  {
+    // The task producing the awaited future is run before the closures queued ahead of it.
+    std::vector<int> order;
+    {
+      boost::basic_thread_pool pool(1);
+      boost::future<void> f = boost::async(pool, [&pool, &order]() {
+        for (int i = 1; i <= 3; ++i)
+        {
+          record r = {&order, i};
+          pool.submit(r);
+        }
+        record producer = {&order, 0};
+        boost::async(pool, producer).get();
+      });
+      f.get();
+    }
+    BOOST_TEST(! order.empty());
+    BOOST_TEST(order[0] == 0);
+  }
+  {
+    boost::basic_thread_pool pool(1);
+    boost::future<int> f = boost::async(pool, [&pool]() {
+      boost::csbl::vector<int> r = boost::async_bulk(pool, 100, [](std::size_t i) { return int(i); }).get();
+      return r[99];
+    });
+    BOOST_TEST(f.get() == 99);
+  }
+  {
+    // A waiting worker with nothing to run is woken up by a closure queued meanwhile, which makes its future ready
+    // while the other worker is still busy.
+    boost::basic_thread_pool pool(2);
+    boost::promise<void> p;
+    boost::promise<void> started;
+    boost::atomic<bool> busy(true);
+    boost::future<void> submitting = boost::async(pool, [&pool, &p, &started, &busy]() {
+      started.set_value();
+      boost::this_thread::sleep_for(boost::chrono::milliseconds(100));
+      pool.submit([&p]() { p.set_value(); });
+      boost::this_thread::sleep_for(boost::chrono::milliseconds(1000));
+      busy.store(false);
+    });
+    started.get_future().get();
+    boost::future<bool> waiting = boost::async(pool, [&p, &busy]() {
+      p.get_future().get();
+      return busy.load();
+    });
+    BOOST_TEST(waiting.get());
+    submitting.get();
+  }
+  return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+  return boost::report_errors();
+}
+
+#endif
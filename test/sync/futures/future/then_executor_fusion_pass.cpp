@@ -0,0 +1,167 @@
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/future.hpp>
+
+// class future<R>
+
+// template<typename Ex, typename F>
+// auto then(Ex&, F&& func) -> future<decltype(func(*this))>;
+
+// A continuation launched by a job of the same executor is run by that job.
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_PROVIDES_EXECUTORS
+#define BOOST_THREAD_PROVIDES_CONTINUATION_FUSION
+
+#include <boost/thread/future.hpp>
+#include <boost/thread/executors/basic_thread_pool.hpp>
+#include <boost/thread/executors/loop_executor.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+
+class counting_executor
+{
+  boost::loop_executor& ex_;
+
+public:
+  typedef boost::executors::work work;
+
+  unsigned submits;
+
+  explicit counting_executor(boost::loop_executor& ex) : ex_(ex), submits(0) {}
+
+  void close() { ex_.close(); }
+  bool closed() { return ex_.closed(); }
+  void submit(BOOST_THREAD_RV_REF(work) closure)
+  {
+    ++submits;
+    ex_.submit(boost::move(closure));
+  }
+  template <typename Closure>
+  void submit(BOOST_THREAD_FWD_REF(Closure) closure)
+  {
+    work w((boost::forward<Closure>(closure)));
+    submit(boost::move(w));
+  }
+  bool try_executing_one() { return ex_.try_executing_one(); }
+  void run_queued_closures()
+  {
+    while (ex_.try_executing_one())
+    {
+    }
+  }
+};
+
+int inc(boost::future<int> f)
+{
+  return f.get() + 1;
+}
+
+int main()
+{
+  {
+    boost::loop_executor loop;
+    counting_executor ex(loop);
+    boost::promise<int> p;
+    boost::future<int> f = p.get_future().then(ex, &inc).then(ex, &inc).then(ex, &inc).then(ex, &inc);
+    p.set_value(0);
+    ex.run_queued_closures();
+    BOOST_TEST(f.get() == 4);
+#if defined BOOST_THREAD_PROVIDES_CONTINUATION_FUSION
+    BOOST_TEST(ex.submits == 1u);
+#else
+    BOOST_TEST(ex.submits == 4u);
+#endif
+  }
+  {
+    boost::loop_executor loop;
+    counting_executor ex(loop);
+    boost::future<int> f = boost::async(ex, []() { return 0; }).then(ex, &inc).then(ex, &inc);
+    ex.run_queued_closures();
+    BOOST_TEST(f.get() == 2);
+#if defined BOOST_THREAD_PROVIDES_CONTINUATION_FUSION
+    BOOST_TEST(ex.submits == 1u);
+#else
+    BOOST_TEST(ex.submits == 3u);
+#endif
+  }
+  {
+    // The budget bounds the number of stages run by a single job.
+    const unsigned N = 3 * (BOOST_THREAD_CONTINUATION_FUSION_BUDGET + 1);
+    boost::loop_executor loop;
+    counting_executor ex(loop);
+    boost::promise<int> p;
+    boost::future<int> f = p.get_future();
+    for (unsigned i = 0; i < N; ++i)
+    {
+      f = f.then(ex, &inc);
+    }
+    p.set_value(0);
+    ex.run_queued_closures();
+    BOOST_TEST(f.get() == int(N));
+#if defined BOOST_THREAD_PROVIDES_CONTINUATION_FUSION
+    BOOST_TEST(ex.submits == 3u);
+#else
+    BOOST_TEST(ex.submits == N);
+#endif
+  }
+  {
+    // Continuations targeting another executor are submitted.
+    boost::loop_executor loop1;
+    boost::loop_executor loop2;
+    counting_executor ex1(loop1);
+    counting_executor ex2(loop2);
+    boost::promise<int> p;
+    boost::future<int> f = p.get_future().then(ex1, &inc).then(ex2, &inc).then(ex1, &inc);
+    p.set_value(0);
+    ex1.run_queued_closures();
+    ex2.run_queued_closures();
+    ex1.run_queued_closures();
+    BOOST_TEST(f.get() == 3);
+    BOOST_TEST(ex1.submits == 2u);
+    BOOST_TEST(ex2.submits == 1u);
+  }
+  {
+    // A job waiting for a continuation it has kept aside runs it first instead of blocking.
+    boost::loop_executor loop;
+    counting_executor ex(loop);
+    boost::future<int> f = boost::async(ex, [&ex]() {
+      boost::promise<int> p;
+      boost::future<int> f2 = p.get_future().then(ex, &inc);
+      p.set_value(1);
+      return f2.get();
+    });
+    ex.run_queued_closures();
+    BOOST_TEST(f.get() == 2);
+    BOOST_TEST(ex.submits == 1u);
+  }
+  {
+    // The same when the future waited for depends on the continuation kept aside.
+    boost::basic_thread_pool pool(4);
+    boost::future<int> f = boost::async(pool, [&pool]() {
+      boost::promise<int> p;
+      boost::future<int> f2 = p.get_future().then(pool, &inc);
+      p.set_value(1);
+      boost::future<int> f3 = f2.then(pool, &inc);
+      BOOST_TEST(f3.wait_for(boost::chrono::seconds(10)) == boost::future_status::ready);
+      return f3.get();
+    });
+    BOOST_TEST(f.get() == 3);
+  }
+  {
+    boost::basic_thread_pool pool(4);
+    std::vector<boost::future<int> > pipelines;
+    for (int i = 0; i < 100; ++i)
+    {
+      pipelines.push_back(boost::async(pool, [i]() { return i; }).then(pool, &inc).then(pool, &inc).then(pool, &inc));
+    }
+    for (int i = 0; i < 100; ++i)
+    {
+      BOOST_TEST(pipelines[i].get() == i + 3);
+    }
+  }
+  return boost::report_errors();
+}
@@ -0,0 +1,181 @@
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/future.hpp>
+
+// A future made ready by make_ready_future() or make_exceptional_future() holds its result itself.
+// then() runs the continuation at once, or submits it directly to the executor.
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_PROVIDES_EXECUTORS
+
+#include <boost/thread/future.hpp>
+#include <boost/thread/stop_token.hpp>
+#include <boost/thread/executors/loop_executor.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/declval.hpp>
+#include <stdexcept>
+#include <string>
+
+struct big
+{
+  char data[256];
+  int value;
+
+  explicit big(int v) : value(v) {}
+};
+
+// A shared_future is a shared pointer to its shared state, whatever its value type, and the result of a ready future
+// takes at most two more words.
+BOOST_STATIC_ASSERT(sizeof(boost::shared_future<big>) == sizeof(boost::shared_ptr<void>));
+BOOST_STATIC_ASSERT(sizeof(boost::future<big>) <= sizeof(boost::shared_ptr<void>) + 2 * sizeof(void*));
+BOOST_STATIC_ASSERT(sizeof(boost::future<int>) <= sizeof(boost::shared_ptr<void>) + 2 * sizeof(void*));
+#if ! defined BOOST_NO_CXX11_NOEXCEPT
+BOOST_STATIC_ASSERT(noexcept(boost::shared_future<big>(boost::declval<boost::future<big> >())));
+BOOST_STATIC_ASSERT(noexcept(boost::future<big>(boost::declval<boost::future<big> >())));
+#endif
+
+int inc(boost::future<int> f)
+{
+  return f.get() + 1;
+}
+
+boost::thread::id caller(boost::future<void> f)
+{
+  f.get();
+  return boost::this_thread::get_id();
+}
+
+int thrower(boost::future<int>)
+{
+  throw std::logic_error("continuation");
+}
+
+boost::future<int> ready_twice(boost::future<int> f)
+{
+  return boost::make_ready_future(2 * f.get());
+}
+
+template <typename Future>
+bool has_logic_error(Future& f)
+{
+  try
+  {
+    f.get();
+  }
+  catch (std::logic_error&)
+  {
+    return true;
+  }
+  catch (...)
+  {
+  }
+  return false;
+}
+
+int main()
+{
+  {
+    boost::future<int> f = boost::make_ready_future(1);
+    BOOST_TEST(f.valid());
+    BOOST_TEST(f.is_ready());
+    BOOST_TEST(f.has_value());
+    BOOST_TEST(! f.has_exception());
+    BOOST_TEST(f.wait_for(boost::chrono::seconds(0)) == boost::future_status::ready);
+    boost::future<int> g = boost::move(f);
+    BOOST_TEST(! f.valid());
+    BOOST_TEST(g.get() == 1);
+  }
+  {
+    // Values larger than a pointer are allocated, and moved with the future.
+    boost::future<big> f = boost::make_ready_future(big(7));
+    boost::future<big> g;
+    g.swap(f);
+    BOOST_TEST(! f.valid());
+    BOOST_TEST(g.is_ready());
+    f = boost::move(g);
+    BOOST_TEST(f.get().value == 7);
+    boost::future<std::string> s = boost::make_ready_future(std::string(100, 'x'));
+    boost::future<std::string> t = boost::make_exceptional_future<std::string>(std::logic_error("ready"));
+    s.swap(t);
+    BOOST_TEST(has_logic_error(s));
+    BOOST_TEST(t.get() == std::string(100, 'x'));
+    boost::future<void> v = boost::make_exceptional_future<void>(std::logic_error("ready"));
+    boost::future<void> w = boost::move(v);
+    BOOST_TEST(w.has_exception());
+    BOOST_TEST(has_logic_error(w));
+  }
+  {
+    // The continuation has run by the time then() returns, on the calling thread.
+    boost::future<int> f = boost::make_ready_future(1).then(&inc).then(&inc);
+    BOOST_TEST(f.is_ready());
+    BOOST_TEST(f.get() == 3);
+    boost::future<boost::thread::id> id = boost::make_ready_future().then(&caller);
+    BOOST_TEST(id.is_ready());
+    BOOST_TEST(id.get() == boost::this_thread::get_id());
+  }
+  {
+    boost::future<int> f = boost::make_exceptional_future<int>(std::logic_error("ready")).then(&inc);
+    BOOST_TEST(f.has_exception());
+    BOOST_TEST(has_logic_error(f));
+    boost::future<int> g = boost::make_ready_future(1).then(&thrower);
+    BOOST_TEST(g.has_exception());
+    BOOST_TEST(has_logic_error(g));
+  }
+  {
+    // An explicit launch policy is honoured.
+    boost::future<int> f = boost::make_ready_future(1).then(boost::launch::async, &inc);
+    BOOST_TEST(f.get() == 2);
+    boost::future<int> g = boost::make_ready_future(1).then(boost::launch::deferred, &inc);
+    BOOST_TEST(g.get() == 2);
+  }
+  {
+    boost::loop_executor ex;
+    boost::future<int> f = boost::make_ready_future(1).then(ex, &inc);
+    BOOST_TEST(! f.is_ready());
+    BOOST_TEST(ex.try_executing_one());
+    BOOST_TEST(f.get() == 2);
+
+    boost::stop_source src;
+    src.request_stop();
+    boost::future<int> g = boost::make_ready_future(1).then(ex, src.get_token(), &inc);
+    BOOST_TEST(! ex.try_executing_one());
+    BOOST_TEST(g.has_exception());
+  }
+  {
+    // Sharing the future gives it a shared state, visible from every copy.
+    boost::shared_future<int> sf = boost::make_ready_future(4).share();
+    boost::shared_future<int> copy = sf;
+    BOOST_TEST(sf.get() == 4);
+    BOOST_TEST(copy.get() == 4);
+    boost::shared_future<int> esf = boost::make_exceptional_future<int>(std::logic_error("shared"));
+    BOOST_TEST(has_logic_error(esf));
+    boost::shared_future<big> bsf = boost::make_ready_future(big(8));
+    BOOST_TEST(bsf.get().value == 8);
+  }
+  {
+    int i = 0;
+    boost::future<int&> f = boost::make_ready_future<int&>(i);
+    BOOST_TEST(&f.get() == &i);
+  }
+  {
+    boost::future<int> f = boost::make_ready_future(boost::make_ready_future(3)).unwrap();
+    BOOST_TEST(f.get() == 3);
+    boost::promise<int> p;
+    boost::future<int> g = p.get_future().then(&ready_twice).unwrap();
+    p.set_value(5);
+    BOOST_TEST(g.get() == 10);
+  }
+  {
+    boost::promise<int> p;
+    boost::future<int> pending = p.get_future();
+    boost::future<int> ready = boost::make_ready_future(1);
+    BOOST_TEST(boost::wait_for_any(pending, ready) == 1u);
+    BOOST_TEST(ready.get() == 1);
+  }
+  return boost::report_errors();
+}
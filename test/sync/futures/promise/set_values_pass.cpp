@@ -0,0 +1,183 @@
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/future.hpp>
+
+// class promise_batch;
+
+// template <class PromiseIterator, class InputIterator>
+// InputIterator set_values(PromiseIterator first, PromiseIterator last, InputIterator values);
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_PROVIDES_EXECUTORS
+
+#include <boost/thread/future.hpp>
+#include <boost/thread/executors/basic_thread_pool.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+struct recording_executor
+{
+  typedef boost::executors::work work;
+
+  unsigned submit_calls;
+  unsigned submit_bulk_calls;
+  unsigned closures;
+
+  recording_executor() : submit_calls(0), submit_bulk_calls(0), closures(0) {}
+
+  void close() {}
+  bool closed() { return false; }
+  void submit(BOOST_THREAD_RV_REF(work) closure)
+  {
+    ++submit_calls;
+    ++closures;
+    closure();
+  }
+  template <typename Closure>
+  void submit(BOOST_THREAD_FWD_REF(Closure) closure)
+  {
+    work w((boost::forward<Closure>(closure)));
+    submit(boost::move(w));
+  }
+  bool try_executing_one() { return false; }
+};
+
+void submit_bulk(recording_executor& ex, recording_executor::work* first, recording_executor::work* last)
+{
+  ++ex.submit_bulk_calls;
+  for (; first != last; ++first)
+  {
+    ++ex.closures;
+    (*first)();
+  }
+}
+
+int twice(boost::future<int> f)
+{
+  return 2 * f.get();
+}
+
+int main()
+{
+  const int N = 100;
+  {
+    std::vector<boost::promise<int> > promises(N);
+    std::vector<boost::future<int> > futures;
+    std::vector<int> values;
+    for (int i = 0; i < N; ++i)
+    {
+      futures.push_back(promises[i].get_future());
+      values.push_back(i);
+    }
+    BOOST_TEST(boost::set_values(promises.begin(), promises.end(), values.begin()) == values.end());
+    for (int i = 0; i < N; ++i)
+    {
+      BOOST_TEST(futures[i].is_ready());
+      BOOST_TEST(futures[i].get() == i);
+    }
+  }
+  {
+    recording_executor ex;
+    std::vector<boost::promise<int> > promises(N);
+    std::vector<boost::future<int> > continuations;
+    std::vector<int> values;
+    for (int i = 0; i < N; ++i)
+    {
+      continuations.push_back(promises[i].get_future().then(ex, &twice));
+      values.push_back(i);
+    }
+    boost::set_values(promises.begin(), promises.end(), values.begin());
+    BOOST_TEST(ex.submit_calls == 0u);
+    BOOST_TEST(ex.submit_bulk_calls == 1u);
+    BOOST_TEST(ex.closures == unsigned(N));
+    for (int i = 0; i < N; ++i)
+    {
+      BOOST_TEST(continuations[i].get() == 2 * i);
+    }
+  }
+  {
+    recording_executor ex;
+    boost::promise<int> p1;
+    boost::promise<int> p2;
+    boost::promise<void> p3;
+    boost::future<int> f1 = p1.get_future().then(ex, &twice);
+    boost::future<int> f2 = p2.get_future().then(ex, &twice);
+    boost::future<void> f3 = p3.get_future();
+    {
+      boost::promise_batch batch;
+      batch.set_value(p1, 21);
+      batch.set_exception(p2, std::logic_error("3"));
+      batch.set_value(p3);
+      BOOST_TEST(f3.is_ready());
+      BOOST_TEST(ex.closures == 0u);
+      try
+      {
+        batch.set_value(p1, 1);
+        BOOST_TEST(false);
+      }
+      catch (boost::future_error& e)
+      {
+        BOOST_TEST(e.code() == boost::system::make_error_code(boost::future_errc::promise_already_satisfied));
+      }
+    }
+    BOOST_TEST(ex.submit_bulk_calls == 1u);
+    BOOST_TEST(ex.closures == 2u);
+    BOOST_TEST(f1.get() == 42);
+    try
+    {
+      f2.get();
+      BOOST_TEST(false);
+    }
+    catch (std::logic_error& e)
+    {
+      BOOST_TEST(std::string(e.what()) == "3");
+    }
+  }
+  {
+    // the continuations bound to a closed pool are rejected, the other ones are launched.
+    boost::basic_thread_pool closed_pool(1);
+    closed_pool.close();
+    recording_executor ex;
+    boost::promise<int> p1;
+    boost::promise<int> p2;
+    boost::future<int> f1 = p1.get_future().then(closed_pool, &twice);
+    boost::future<int> f2 = p2.get_future().then(ex, &twice);
+    boost::promise_batch batch;
+    batch.set_value(p1, 1);
+    batch.set_value(p2, 2);
+    try
+    {
+      batch.flush();
+      BOOST_TEST(false);
+    }
+    catch (boost::sync_queue_is_closed&)
+    {
+    }
+    BOOST_TEST(ex.closures == 1u);
+    BOOST_TEST(f2.get() == 4);
+    BOOST_TEST(f1.is_ready());
+    BOOST_TEST(f1.has_exception());
+  }
+  {
+    boost::basic_thread_pool pool(4);
+    std::vector<boost::promise<int> > promises(N);
+    std::vector<boost::future<int> > continuations;
+    std::vector<int> values;
+    for (int i = 0; i < N; ++i)
+    {
+      continuations.push_back(promises[i].get_future().then(pool, &twice));
+      values.push_back(i);
+    }
+    boost::set_values(promises.begin(), promises.end(), values.begin());
+    for (int i = 0; i < N; ++i)
+    {
+      BOOST_TEST(continuations[i].get() == 2 * i);
+    }
+  }
+  return boost::report_errors();
+}
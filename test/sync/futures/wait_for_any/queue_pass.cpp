@@ -0,0 +1,113 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/future.hpp>
+
+// template <typename Iterator>
+// Iterator wait_for_any(Iterator begin, Iterator end);
+//
+// template <typename Iterator>
+// class wait_for_any_queue;
+
+#define BOOST_THREAD_VERSION 4
+
+#include <boost/thread/future.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+
+void set_value(boost::promise<unsigned>* p, unsigned v)
+{
+  p->set_value(v);
+}
+
+void set_int_value(boost::promise<int>* p, int v)
+{
+  p->set_value(v);
+}
+
+int main()
+{
+  { // the range overload returns the future that became ready
+    const unsigned n = 1000;
+    std::vector<boost::promise<int> > ps(n);
+    std::vector<boost::future<int> > fs;
+    for (unsigned i = 0; i < n; ++i) fs.push_back(ps[i].get_future());
+
+    boost::thread t(&set_int_value, &ps[731], 731);
+    std::vector<boost::future<int> >::iterator it = boost::wait_for_any(fs.begin(), fs.end());
+    t.join();
+    BOOST_TEST(it - fs.begin() == 731);
+    BOOST_TEST(it->get() == 731);
+  }
+  { // the lowest ready index wins when several are already ready
+    std::vector<boost::promise<int> > ps(5);
+    std::vector<boost::shared_future<int> > fs;
+    for (unsigned i = 0; i < ps.size(); ++i) fs.push_back(ps[i].get_future().share());
+    ps[3].set_value(3);
+    ps[1].set_value(1);
+    BOOST_TEST(boost::wait_for_any(fs.begin(), fs.end()) - fs.begin() == 1);
+  }
+  { // the variadic overload
+    boost::promise<int> p1;
+    boost::promise<double> p2;
+    boost::future<int> f1 = p1.get_future();
+    boost::shared_future<double> f2 = p2.get_future().share();
+    p2.set_value(1.5);
+    BOOST_TEST(boost::wait_for_any(f1, f2) == 1u);
+  }
+  { // the queue returns the futures in completion order
+    const unsigned n = 64;
+    std::vector<boost::promise<unsigned> > ps(n);
+    std::vector<boost::future<unsigned> > fs;
+    for (unsigned i = 0; i < n; ++i) fs.push_back(ps[i].get_future());
+
+    typedef boost::wait_for_any_queue<std::vector<boost::future<unsigned> >::iterator> queue_type;
+    queue_type q(fs.begin(), fs.end());
+    BOOST_TEST(q.pending() == n);
+    for (unsigned i = 0; i < n; ++i)
+    {
+      unsigned k = (i * 7) % n;
+      ps[k].set_value(k);
+      std::vector<boost::future<unsigned> >::iterator it = q.wait_next();
+      BOOST_TEST(it != fs.end());
+      BOOST_TEST(it->get() == k);
+    }
+    BOOST_TEST(q.empty());
+    BOOST_TEST(q.wait_next() == fs.end());
+  }
+  { // the queue drains futures completed from other threads
+    const unsigned n = 256;
+    std::vector<boost::promise<unsigned> > ps(n);
+    std::vector<boost::shared_future<unsigned> > fs;
+    for (unsigned i = 0; i < n; ++i) fs.push_back(ps[i].get_future().share());
+
+    boost::wait_for_any_queue<std::vector<boost::shared_future<unsigned> >::iterator> q(fs.begin(), fs.end());
+    boost::thread_group g;
+    for (unsigned i = 0; i < n; ++i)
+      g.create_thread(boost::bind(&set_value, &ps[i], i));
+    std::vector<bool> seen(n, false);
+    while (! q.empty())
+    {
+      std::vector<boost::shared_future<unsigned> >::iterator it = q.wait_next();
+      BOOST_TEST(it->get() == unsigned(it - fs.begin()));
+      BOOST_TEST(! seen[it->get()]);
+      seen[it->get()] = true;
+    }
+    g.join_all();
+  }
+  { // destroying the queue before the futures are ready unregisters it
+    boost::promise<int> p;
+    std::vector<boost::future<int> > fs;
+    fs.push_back(p.get_future());
+    {
+      boost::wait_for_any_queue<std::vector<boost::future<int> >::iterator> q(fs.begin(), fs.end());
+      BOOST_TEST(q.pending() == 1u);
+    }
+    p.set_value(1);
+    BOOST_TEST(fs[0].get() == 1);
+  }
+
+  return boost::report_errors();
+}
+
@@ -0,0 +1,94 @@
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/adaptive_mutex.hpp>
+
+// class adaptive_mutex;
+
+// adaptive_mutex used with the lock types and under oversubscription.
+
+#define BOOST_THREAD_VERSION 4
+
+#include <boost/thread/adaptive_mutex.hpp>
+#include <boost/thread/lock_types.hpp>
+#include <boost/thread/lock_guard.hpp>
+#include <boost/thread/strict_lock.hpp>
+#include <boost/thread/lock_algorithms.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+boost::adaptive_mutex g_mutex;
+long g_counter = 0;
+
+void increment(boost::adaptive_mutex* m, long* counter, int n)
+{
+  for (int i = 0; i < n; ++i)
+  {
+    boost::lock_guard<boost::adaptive_mutex> lk(*m);
+    ++*counter;
+  }
+}
+
+int main()
+{
+  {
+    boost::unique_lock<boost::adaptive_mutex> lk(g_mutex);
+    BOOST_TEST(lk.owns_lock());
+    BOOST_TEST(! g_mutex.try_lock());
+    lk.unlock();
+    BOOST_TEST(lk.try_lock());
+    lk.unlock();
+    BOOST_TEST(lk.try_lock_for(boost::chrono::milliseconds(10)));
+  }
+  {
+    boost::unique_lock<boost::adaptive_mutex> lk(g_mutex, boost::defer_lock);
+    BOOST_TEST(! lk.owns_lock());
+    BOOST_TEST(lk.try_lock_until(boost::chrono::steady_clock::now() + boost::chrono::milliseconds(10)));
+  }
+  {
+    boost::unique_lock<boost::adaptive_mutex> lk(g_mutex, boost::try_to_lock);
+    BOOST_TEST(lk.owns_lock());
+    boost::unique_lock<boost::adaptive_mutex> lk2(g_mutex, boost::chrono::milliseconds(10));
+    BOOST_TEST(! lk2.owns_lock());
+  }
+  {
+    boost::strict_lock<boost::adaptive_mutex> lk(g_mutex);
+    BOOST_TEST(lk.owns_lock(&g_mutex));
+    BOOST_TEST(! g_mutex.try_lock());
+  }
+  {
+    g_mutex.lock();
+    boost::unique_lock<boost::adaptive_mutex> lk(g_mutex, boost::adopt_lock);
+    BOOST_TEST(lk.owns_lock());
+  }
+  {
+    boost::adaptive_mutex m2;
+    boost::lock(g_mutex, m2);
+    BOOST_TEST(! g_mutex.try_lock());
+    BOOST_TEST(! m2.try_lock());
+    g_mutex.unlock();
+    m2.unlock();
+  }
+  {
+    // more threads than cores, spinning and parking
+    unsigned const n = 4 * (std::max)(boost::thread::hardware_concurrency(), 1u);
+    boost::thread_group threads;
+    for (unsigned i = 0; i < n; ++i) threads.create_thread(boost::bind(&increment, &g_mutex, &g_counter, 5000));
+    threads.join_all();
+    BOOST_TEST_EQ(g_counter, long(n) * 5000);
+  }
+  {
+    // without spinning
+    boost::adaptive_mutex m(0);
+    BOOST_TEST_EQ(m.max_spin(), 0u);
+    long counter = 0;
+    boost::thread_group threads;
+    for (unsigned i = 0; i < 4; ++i) threads.create_thread(boost::bind(&increment, &m, &counter, 5000));
+    threads.join_all();
+    BOOST_TEST_EQ(counter, 20000);
+  }
+
+  return boost::report_errors();
+}
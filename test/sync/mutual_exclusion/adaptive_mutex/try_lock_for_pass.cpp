@@ -0,0 +1,91 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// Copyright (C) 2011 Vicente J. Botet Escriba
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/adaptive_mutex.hpp>
+
+// class adaptive_mutex;
+
+// template <class Rep, class Period>
+//     bool try_lock_for(const chrono::duration<Rep, Period>& rel_time);
+
+#include <boost/thread/adaptive_mutex.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "../../../timming.hpp"
+
+#if defined BOOST_THREAD_USES_CHRONO
+
+boost::adaptive_mutex g_mutex;
+
+typedef boost::chrono::high_resolution_clock Clock;
+typedef Clock::time_point time_point;
+typedef Clock::duration duration;
+typedef boost::chrono::milliseconds ms;
+typedef boost::chrono::nanoseconds ns;
+time_point g_t0;
+time_point g_t1;
+
+const ms max_diff(BOOST_THREAD_TEST_TIME_MS);
+
+void f1()
+{
+  g_t0 = Clock::now();
+  BOOST_TEST(g_mutex.try_lock_for(ms(750)) == true);
+  g_t1 = Clock::now();
+  g_mutex.unlock();
+}
+
+void f2()
+{
+  g_t0 = Clock::now();
+  BOOST_TEST(g_mutex.try_lock_for(ms(250)) == false);
+  g_t1 = Clock::now();
+  ns d = g_t1 - g_t0 - ms(250);
+  BOOST_THREAD_TEST_IT(d, ns(max_diff));
+}
+
+int main()
+{
+  {
+    g_mutex.lock();
+    boost::thread t(f1);
+    time_point t2 = Clock::now();
+    boost::this_thread::sleep_for(ms(250));
+    time_point t3 = Clock::now();
+    g_mutex.unlock();
+    t.join();
+
+    ns sleep_time = t3 - t2;
+    ns d_ns = g_t1 - g_t0 - sleep_time;
+    ms d_ms = boost::chrono::duration_cast<boost::chrono::milliseconds>(d_ns);
+    // BOOST_TEST_GE(d_ms.count(), 0);
+    BOOST_THREAD_TEST_IT(d_ms, max_diff);
+    BOOST_THREAD_TEST_IT(d_ns, ns(max_diff));
+  }
+  {
+    g_mutex.lock();
+    boost::thread t(f2);
+    boost::this_thread::sleep_for(ms(750));
+    g_mutex.unlock();
+    t.join();
+  }
+
+  return boost::report_errors();
+}
+
+#else
+#error "Test not applicable: BOOST_THREAD_USES_CHRONO not defined for this platform as not supported"
+#endif
+
@@ -0,0 +1,110 @@
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/flat_combining_mutex.hpp>
+
+// class flat_combining_mutex;
+
+// template <typename F> typename result_of<F()>::type combine(F&);
+
+#define BOOST_THREAD_VERSION 4
+
+#include <boost/thread/flat_combining_mutex.hpp>
+#include <boost/thread/lock_guard.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <stdexcept>
+
+struct increment
+{
+  typedef long result_type;
+  long* counter;
+  explicit increment(long* counter) : counter(counter) {}
+  long operator()()
+  {
+    return ++*counter;
+  }
+};
+
+struct no_result
+{
+  typedef void result_type;
+  int* count;
+  explicit no_result(int* count) : count(count) {}
+  void operator()()
+  {
+    ++*count;
+  }
+};
+
+struct thrower
+{
+  typedef int result_type;
+  int operator()()
+  {
+    throw std::runtime_error("thrower");
+  }
+};
+
+void increments(boost::flat_combining_mutex* m, long* counter, long* sum, int n)
+{
+  increment f(counter);
+  for (int i = 0; i < n; ++i) *sum += m->combine(f);
+}
+
+void test_contention(unsigned max_spin)
+{
+  boost::flat_combining_mutex m(max_spin);
+  long counter = 0;
+  // more threads than cores, combining and blocking
+  unsigned const n = 4 * (std::max)(boost::thread::hardware_concurrency(), 1u);
+  std::vector<long> sums(n, 0);
+  boost::thread_group threads;
+  for (unsigned i = 0; i < n; ++i) threads.create_thread(boost::bind(&increments, &m, &counter, &sums[i], 2000));
+  threads.join_all();
+  BOOST_TEST_EQ(counter, long(n) * 2000);
+  // each call has got its own result.
+  long sum = 0;
+  for (unsigned i = 0; i < n; ++i) sum += sums[i];
+  long const total = long(n) * 2000;
+  BOOST_TEST_EQ(sum, total * (total + 1) / 2);
+}
+
+int main()
+{
+  {
+    boost::flat_combining_mutex m;
+    long counter = 0;
+    increment f(&counter);
+    BOOST_TEST_EQ(m.combine(f), 1);
+    BOOST_TEST_EQ(m.combine(f), 2);
+    int count = 0;
+    no_result g(&count);
+    m.combine(g);
+    BOOST_TEST_EQ(count, 1);
+    thrower t;
+    BOOST_TEST_THROWS(m.combine(t), std::runtime_error);
+    // the mutex is unlocked after an exception.
+    BOOST_TEST(m.try_lock());
+    m.unlock();
+  }
+  {
+    // an operation published while the mutex is locked is executed once it is unlocked.
+    boost::flat_combining_mutex m;
+    long counter = 0;
+    long sum = 0;
+    m.lock();
+    boost::thread t(boost::bind(&increments, &m, &counter, &sum, 1));
+    boost::this_thread::sleep_for(boost::chrono::milliseconds(50));
+    BOOST_TEST_EQ(counter, 0);
+    m.unlock();
+    t.join();
+    BOOST_TEST_EQ(counter, 1);
+  }
+  test_contention(BOOST_THREAD_FLAT_COMBINING_MUTEX_MAX_SPIN);
+  test_contention(0);
+
+  return boost::report_errors();
+}
@@ -0,0 +1,32 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// Copyright (C) 2011 Vicente J. Botet Escriba
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/flat_combining_mutex.hpp>
+
+// class flat_combining_mutex;
+
+// flat_combining_mutex(const flat_combining_mutex&) = delete;
+
+#include <boost/thread/flat_combining_mutex.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+int main()
+{
+  boost::flat_combining_mutex m0;
+  boost::flat_combining_mutex m1(m0);
+  (void)m1;
+}
+
+#include "../../../remove_error_code_unused_warning.hpp"
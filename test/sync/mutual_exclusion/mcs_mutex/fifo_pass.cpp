@@ -0,0 +1,87 @@
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/mcs_mutex.hpp>
+
+// class mcs_mutex;
+
+// the waiting threads get the mutex in the order they have called lock(), and the mutex works with the lock types.
+
+#define BOOST_THREAD_VERSION 4
+
+#include <boost/thread/mcs_mutex.hpp>
+#include <boost/thread/lock_types.hpp>
+#include <boost/thread/lock_guard.hpp>
+#include <boost/thread/lock_algorithms.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+
+void record(boost::mcs_mutex* m, std::vector<int>* order, int i)
+{
+  boost::lock_guard<boost::mcs_mutex> lk(*m);
+  order->push_back(i);
+}
+
+void increment(boost::mcs_mutex* m, long* counter, int n)
+{
+  for (int i = 0; i < n; ++i)
+  {
+    boost::unique_lock<boost::mcs_mutex> lk(*m);
+    ++*counter;
+  }
+}
+
+void test_fifo(unsigned max_spin)
+{
+  boost::mcs_mutex m(max_spin);
+  std::vector<int> order;
+  boost::thread_group threads;
+  m.lock();
+  for (int i = 0; i < 5; ++i)
+  {
+    threads.create_thread(boost::bind(&record, &m, &order, i));
+    // lets the thread queue itself
+    boost::this_thread::sleep_for(boost::chrono::milliseconds(50));
+  }
+  m.unlock();
+  threads.join_all();
+  BOOST_TEST_EQ(order.size(), 5u);
+  for (std::size_t i = 0; i < order.size(); ++i) BOOST_TEST_EQ(order[i], int(i));
+}
+
+void test_counter(unsigned max_spin)
+{
+  boost::mcs_mutex m(max_spin);
+  long counter = 0;
+  // more threads than cores, spinning and parking
+  unsigned const n = 4 * (std::max)(boost::thread::hardware_concurrency(), 1u);
+  boost::thread_group threads;
+  for (unsigned i = 0; i < n; ++i) threads.create_thread(boost::bind(&increment, &m, &counter, 2000));
+  threads.join_all();
+  BOOST_TEST_EQ(counter, long(n) * 2000);
+  BOOST_TEST(m.try_lock());
+  m.unlock();
+}
+
+int main()
+{
+  test_fifo(BOOST_THREAD_MCS_MUTEX_MAX_SPIN);
+  test_fifo(0);
+  test_counter(BOOST_THREAD_MCS_MUTEX_MAX_SPIN);
+  test_counter(0);
+  {
+    boost::mcs_mutex m1, m2;
+    boost::lock(m1, m2);
+    BOOST_TEST(! m1.try_lock());
+    BOOST_TEST(! m2.try_lock());
+    m1.unlock();
+    m2.unlock();
+    boost::unique_lock<boost::mcs_mutex> lk(m1, boost::try_to_lock);
+    BOOST_TEST(lk.owns_lock());
+  }
+
+  return boost::report_errors();
+}
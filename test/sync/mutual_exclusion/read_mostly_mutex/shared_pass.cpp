@@ -0,0 +1,90 @@
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/read_mostly_mutex.hpp>
+
+// class read_mostly_mutex;
+
+// void lock_shared();
+// bool try_lock_shared();
+// void unlock_shared();
+
+#define BOOST_THREAD_VERSION 4
+
+#include <boost/thread/read_mostly_mutex.hpp>
+#include <boost/thread/shared_lock_guard.hpp>
+#include <boost/thread/synchronized_value.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+boost::read_mostly_mutex g_mutex(4);
+long g_a = 0;
+long g_b = 0;
+boost::atomic<bool> g_inconsistent(false);
+
+void reader()
+{
+  for (int i = 0; i < 5000; ++i)
+  {
+    boost::shared_lock<boost::read_mostly_mutex> lk(g_mutex);
+    if (g_a != g_b) g_inconsistent = true;
+  }
+}
+
+void writer()
+{
+  for (int i = 0; i < 200; ++i)
+  {
+    boost::unique_lock<boost::read_mostly_mutex> lk(g_mutex);
+    ++g_a;
+    boost::this_thread::yield();
+    ++g_b;
+  }
+}
+
+int main()
+{
+  {
+    BOOST_TEST_EQ(g_mutex.slot_count(), 4u);
+    boost::read_mostly_mutex m(3);
+    BOOST_TEST_EQ(m.slot_count(), 4u);
+  }
+  {
+    boost::read_mostly_mutex m;
+    m.lock_shared();
+    BOOST_TEST(m.try_lock_shared());
+    BOOST_TEST(! m.try_lock());
+    m.unlock_shared();
+    BOOST_TEST(! m.try_lock());
+    m.unlock_shared();
+    BOOST_TEST(m.try_lock());
+    BOOST_TEST(! m.try_lock_shared());
+    m.unlock();
+  }
+  {
+    boost::read_mostly_mutex m;
+    {
+      boost::shared_lock_guard<boost::read_mostly_mutex> lk(m);
+      BOOST_TEST(! m.try_lock());
+    }
+    BOOST_TEST(m.try_lock());
+    m.unlock();
+  }
+  {
+    boost::synchronized_value<int, boost::read_mostly_mutex> v(1);
+    *v.synchronize() += 1;
+    BOOST_TEST_EQ(v.get(), 2);
+  }
+  {
+    boost::thread_group threads;
+    for (int i = 0; i < 4; ++i) threads.create_thread(&reader);
+    for (int i = 0; i < 2; ++i) threads.create_thread(&writer);
+    threads.join_all();
+    BOOST_TEST(! g_inconsistent);
+    BOOST_TEST_EQ(g_a, 400);
+    BOOST_TEST_EQ(g_b, 400);
+  }
+  return boost::report_errors();
+}
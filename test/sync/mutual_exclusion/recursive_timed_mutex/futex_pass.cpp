@@ -0,0 +1,90 @@
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/recursive_mutex.hpp>
+
+// class recursive_timed_mutex;
+
+// template <class Clock, class Duration>
+//     bool try_lock_until(const chrono::time_point<Clock, Duration>& abs_time);
+
+// The owner of a recursive_timed_mutex locks it again through try_lock_until() without waiting, even if its deadline
+// has expired, and the other threads get it only once each level of ownership has been released.
+
+#include <boost/thread/recursive_mutex.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "../../../timming.hpp"
+
+#if defined BOOST_THREAD_USES_CHRONO
+
+boost::recursive_timed_mutex g_mutex;
+
+typedef boost::chrono::milliseconds ms;
+typedef boost::chrono::nanoseconds ns;
+
+const ms max_diff(BOOST_THREAD_TEST_TIME_MS);
+
+template <class Clock>
+void reenter()
+{
+  typename Clock::time_point const t0 = Clock::now();
+  BOOST_TEST(g_mutex.try_lock_until(t0 + ms(250)));
+  BOOST_TEST(g_mutex.try_lock_until(t0 + ms(250)));
+  // the deadline has expired, but the mutex is owned by this thread.
+  BOOST_TEST(g_mutex.try_lock_until(t0 - ms(1000)));
+  BOOST_THREAD_TEST_IT(ns(Clock::now() - t0), ns(max_diff));
+}
+
+bool g_locked = false;
+
+template <class Clock>
+void other(ms timeout)
+{
+  g_locked = g_mutex.try_lock_until(Clock::now() + timeout);
+  if (g_locked) g_mutex.unlock();
+}
+
+template <class Clock>
+void test()
+{
+  reenter<Clock>();
+  // owned three times: the other threads time out until the three levels have been released.
+  {
+    boost::thread t(other<Clock>, ms(250));
+    t.join();
+    BOOST_TEST(! g_locked);
+  }
+  g_mutex.unlock();
+  g_mutex.unlock();
+  {
+    boost::thread t(other<Clock>, ms(250));
+    t.join();
+    BOOST_TEST(! g_locked);
+  }
+  {
+    boost::thread t(other<Clock>, ms(5000));
+    boost::this_thread::sleep_for(ms(250));
+    typename Clock::time_point const t2 = Clock::now();
+    g_mutex.unlock();
+    t.join();
+    BOOST_TEST(g_locked);
+    BOOST_THREAD_TEST_IT(ns(Clock::now() - t2), ns(max_diff));
+  }
+  BOOST_TEST(g_mutex.try_lock());
+  g_mutex.unlock();
+}
+
+int main()
+{
+  test<boost::chrono::steady_clock>();
+  test<boost::chrono::system_clock>();
+
+  return boost::report_errors();
+}
+
+#else
+#error "Test not applicable: BOOST_THREAD_USES_CHRONO not defined for this platform as not supported"
+#endif
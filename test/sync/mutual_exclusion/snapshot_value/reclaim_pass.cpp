@@ -0,0 +1,100 @@
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/snapshot_value.hpp>
+
+// class snapshot_value<T>
+
+// the snapshots are consistent while they are used and are reclaimed once released.
+
+#define BOOST_THREAD_VERSION 4
+
+#include <boost/thread/snapshot_value.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/atomic.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+boost::atomic<int> alive(0);
+
+struct version
+{
+  long v[16];
+  version() { for (int i = 0; i < 16; ++i) v[i] = 0; ++alive; }
+  version(version const& other) { for (int i = 0; i < 16; ++i) v[i] = other.v[i]; ++alive; }
+  ~version() { for (int i = 0; i < 16; ++i) v[i] = -1; --alive; }
+};
+
+struct next
+{
+  void operator()(version& x) const
+  {
+    for (int i = 0; i < 16; ++i) ++x.v[i];
+  }
+};
+
+boost::atomic<bool> done(false);
+
+void read(boost::snapshot_value<version>* sv, long* errors)
+{
+  long last = 0;
+  while (! done)
+  {
+    boost::snapshot_ptr<version> s = sv->synchronize();
+    long const first = s->v[0];
+    if (first < last) ++*errors;
+    for (int k = 0; k < 3; ++k)
+    {
+      boost::this_thread::yield();
+      // a snapshot in use is never modified nor destroyed.
+      for (int i = 0; i < 16; ++i)
+        if (s->v[i] != first) ++*errors;
+    }
+    last = first;
+  }
+}
+
+void write(boost::snapshot_value<version>* sv, int n)
+{
+  for (int i = 0; i < n; ++i) sv->update(next());
+}
+
+int main()
+{
+  {
+    boost::snapshot_value<version> v;
+    long errors[4] = { 0, 0, 0, 0 };
+    boost::thread_group readers;
+    for (int i = 0; i < 4; ++i) readers.create_thread(boost::bind(&read, &v, &errors[i]));
+    boost::thread_group writers;
+    for (int i = 0; i < 2; ++i) writers.create_thread(boost::bind(&write, &v, 500));
+    writers.join_all();
+    done = true;
+    readers.join_all();
+    BOOST_TEST_EQ(errors[0] + errors[1] + errors[2] + errors[3], 0);
+    BOOST_TEST_EQ(v->v[15], 1000);
+    // the previous snapshots are no more used.
+    v.reclaim();
+    BOOST_TEST_EQ(alive.load(), 1);
+  }
+  {
+    boost::snapshot_value<version> v;
+    {
+      boost::snapshot_ptr<version> s = v.synchronize();
+      v.update(next());
+      v.update(next());
+      // the snapshot held is not reclaimed, nor the next one which could have been loaded in the same epoch.
+      BOOST_TEST_EQ(alive.load(), 3);
+      BOOST_TEST_EQ(s->v[0], 0);
+    }
+    // the snapshots are reclaimed by the next update once released.
+    v.update(next());
+    BOOST_TEST_EQ(alive.load(), 1);
+    BOOST_TEST_EQ(v->v[0], 3);
+  }
+  BOOST_TEST_EQ(alive.load(), 0);
+
+  return boost::report_errors();
+}
@@ -0,0 +1,110 @@
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/snapshot_value.hpp>
+
+// class snapshot_value<T>
+
+// snapshot_ptr<T> synchronize() const;
+// snapshot_ptr<T> operator->() const;
+// template <typename F> result_of<F(T const&)>::type operator()(F) const;
+// template <typename F> void update(F);
+// snapshot_value& operator=(T const&);
+
+#include <boost/config.hpp>
+#if ! defined  BOOST_NO_CXX11_DECLTYPE
+#define BOOST_RESULT_OF_USE_DECLTYPE
+#endif
+
+#define BOOST_THREAD_VERSION 4
+
+#include <boost/thread/snapshot_value.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+#include <map>
+#include <string>
+#include <stdexcept>
+
+typedef std::map<std::string, int> table;
+
+struct add
+{
+  std::string k;
+  int v;
+  add(std::string const& k, int v) : k(k), v(v) {}
+  void operator()(table& t) const
+  {
+    t[k] = v;
+  }
+};
+
+struct size_of
+{
+  typedef std::size_t result_type;
+  std::size_t operator()(table const& t) const
+  {
+    return t.size();
+  }
+};
+
+void fail(table& t)
+{
+  t["x"] = 0;
+  throw std::runtime_error("fail");
+}
+
+int main()
+{
+  {
+    boost::snapshot_value<table> v;
+    BOOST_TEST(v->empty());
+    v.update(add("a", 1));
+    BOOST_TEST_EQ(v->size(), 1u);
+    BOOST_TEST_EQ(v.get().find("a")->second, 1);
+    BOOST_TEST_EQ(v(size_of()), 1u);
+  }
+  {
+    table t;
+    t["a"] = 1;
+    boost::snapshot_value<table> v(t);
+    boost::snapshot_ptr<table> s = v.synchronize();
+    // the snapshot doesn't change when a new value is published.
+    v.update(add("b", 2));
+    BOOST_TEST_EQ(s->size(), 1u);
+    BOOST_TEST_EQ((*s).find("a")->second, 1);
+    boost::snapshot_ptr<table> s2 = v.synchronize();
+    BOOST_TEST_EQ(s2->size(), 2u);
+    BOOST_TEST(&*s != &*s2);
+  }
+  {
+    boost::snapshot_value<table> v;
+    table t;
+    t["c"] = 3;
+    v = t;
+    BOOST_TEST_EQ(v->size(), 1u);
+    try
+    {
+      v.update(&fail);
+      BOOST_TEST(false);
+    }
+    catch (std::runtime_error&)
+    {
+    }
+    // nothing is published if the update throws.
+    BOOST_TEST_EQ(v->size(), 1u);
+    BOOST_TEST(v->find("x") == v->end());
+  }
+  {
+    boost::snapshot_value<int> v(1);
+    BOOST_TEST_EQ(v.get(), 1);
+    v = 2;
+    BOOST_TEST_EQ(*v.synchronize(), 2);
+#if ! defined(BOOST_NO_CXX11_EXPLICIT_CONVERSION_OPERATORS)
+    BOOST_TEST_EQ(static_cast<int>(v), 2);
+#endif
+  }
+
+  return boost::report_errors();
+}
@@ -0,0 +1,125 @@
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/striped_lockable.hpp>
+
+// template <typename Mutex, std::size_t N> class striped_lockable;
+
+// lock_set_type lock_all_for(Keys const&...);
+// shared_lock_set_type lock_all_shared_for(Keys const&...);
+// lock_set_type lock_range_for(InputIterator, InputIterator);
+// lock_set_type lock_all();
+// shared_lock_set_type lock_all_shared();
+
+#define BOOST_THREAD_VERSION 4
+
+#include <boost/thread/striped_lockable.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/shared_mutex.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+
+typedef boost::striped_lockable<boost::mutex, 8> stripes_type;
+
+const int accounts = 32;
+long balance[accounts];
+
+// transfers between accounts locked in opposite orders by the threads.
+void transfer(stripes_type* stripes, int from, int n)
+{
+  for (int i = 0; i < n; ++i)
+  {
+    int const a = (from + i) % accounts;
+    int const b = (from + 3 * i + 1) % accounts;
+    stripes_type::lock_set_type lk = stripes->lock_all_for(a, b);
+    --balance[a];
+    ++balance[b];
+  }
+}
+
+int main()
+{
+  {
+    stripes_type stripes;
+    int k1 = 1;
+    int k2 = 2;
+    while (stripes.index_of(k2) == stripes.index_of(k1)) ++k2;
+    {
+      stripes_type::lock_set_type lk = stripes.lock_all_for(k1, k2, k1);
+      // the stripe of k1 is locked once.
+      BOOST_TEST_EQ(lk.size(), 2u);
+      BOOST_TEST(lk.owns_lock_for(k1));
+      BOOST_TEST(lk.owns_lock_for(k2));
+      BOOST_TEST(! stripes.mutex_for(k1).try_lock());
+      BOOST_TEST(! stripes.mutex_for(k2).try_lock());
+      stripes_type::lock_set_type lk2 = boost::move(lk);
+      BOOST_TEST_EQ(lk.size(), 0u);
+      BOOST_TEST_EQ(lk2.size(), 2u);
+    }
+    BOOST_TEST(stripes.mutex_for(k1).try_lock());
+    stripes.mutex_for(k1).unlock();
+    {
+      std::vector<int> keys;
+      for (int k = 0; k < 100; ++k) keys.push_back(k);
+      stripes_type::lock_set_type lk = stripes.lock_range_for(keys.begin(), keys.end());
+      BOOST_TEST(lk.size() <= 8u);
+      for (int k = 0; k < 100; ++k) BOOST_TEST(lk.owns_lock_for(k));
+      lk.unlock();
+      BOOST_TEST_EQ(lk.size(), 0u);
+      BOOST_TEST(stripes.mutex_for(k2).try_lock());
+      stripes.mutex_for(k2).unlock();
+    }
+    {
+      stripes_type::lock_set_type lk = stripes.lock_all();
+      BOOST_TEST_EQ(lk.size(), 8u);
+      for (std::size_t i = 0; i < 8; ++i) BOOST_TEST(! stripes.stripe(i).try_lock());
+    }
+  }
+  {
+    boost::striped_lockable<boost::shared_mutex, 8> stripes;
+    typedef boost::striped_lockable<boost::shared_mutex, 8>::shared_lock_set_type shared_set;
+    shared_set lk1 = stripes.lock_all_shared_for(1, 2);
+    shared_set lk2 = stripes.lock_all_shared_for(2, 1);
+    BOOST_TEST(lk1.owns_lock_for(1));
+    BOOST_TEST(lk2.owns_lock_for(2));
+    BOOST_TEST(! stripes.mutex_for(1).try_lock());
+    lk1.unlock();
+    lk2.unlock();
+    BOOST_TEST(stripes.mutex_for(1).try_lock());
+    stripes.mutex_for(1).unlock();
+    {
+      shared_set all1 = stripes.lock_all_shared();
+      shared_set all2 = stripes.lock_all_shared();
+      BOOST_TEST_EQ(all1.size(), 8u);
+      BOOST_TEST_EQ(all2.size(), 8u);
+      for (std::size_t i = 0; i < 8; ++i) BOOST_TEST(! stripes.stripe(i).try_lock());
+      for (std::size_t i = 0; i < 8; ++i) BOOST_TEST(stripes.stripe(i).try_lock_shared());
+      for (std::size_t i = 0; i < 8; ++i) stripes.stripe(i).unlock_shared();
+    }
+    BOOST_TEST(stripes.stripe(7).try_lock());
+    stripes.stripe(7).unlock();
+  }
+  {
+    // each stripe starts a cache line of its own.
+    stripes_type stripes;
+    for (std::size_t i = 0; i < 8; ++i)
+    {
+      BOOST_TEST_EQ(reinterpret_cast<std::size_t>(&stripes.stripe(i)) % 64, 0u);
+    }
+  }
+  {
+    stripes_type stripes;
+    for (int i = 0; i < accounts; ++i) balance[i] = 100;
+    boost::thread_group threads;
+    for (int i = 0; i < 8; ++i) threads.create_thread(boost::bind(&transfer, &stripes, i * 5, 5000));
+    threads.join_all();
+    long total = 0;
+    for (int i = 0; i < accounts; ++i) total += balance[i];
+    BOOST_TEST_EQ(total, 100 * accounts);
+  }
+
+  return boost::report_errors();
+}
@@ -0,0 +1,65 @@
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/striped_lockable.hpp>
+
+// template <typename Mutex, std::size_t N> class striped_lockable;
+
+// unique_lock<Mutex> lock_for(Key const&);
+// shared_lock<Mutex> lock_shared_for(Key const&);
+
+#define BOOST_THREAD_VERSION 4
+
+#include <boost/thread/striped_lockable.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/shared_mutex.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+
+int main()
+{
+  {
+    typedef boost::striped_lockable<boost::mutex, 16> stripes_type;
+    stripes_type stripes;
+    BOOST_TEST_EQ(stripes_type::size(), 16u);
+    // each stripe is on its own cache line.
+    BOOST_TEST(sizeof(stripes_type) >= 16 * 64);
+    BOOST_TEST((char*)&stripes.stripe(1) - (char*)&stripes.stripe(0) >= 64);
+    for (int k = 0; k < 1000; ++k)
+    {
+      BOOST_TEST(stripes.index_of(k) < 16u);
+      BOOST_TEST_EQ(stripes.index_of(k), stripes.index_of(k));
+    }
+    // keys spaced by a power of 2 are spread on the stripes.
+    std::size_t used[16] = { 0 };
+    for (int k = 0; k < 1024; k += 64) ++used[stripes.index_of(k)];
+    int n = 0;
+    for (int i = 0; i < 16; ++i) n += used[i] != 0;
+    BOOST_TEST(n > 4);
+
+    {
+      boost::unique_lock<boost::mutex> lk = stripes.lock_for(std::string("key"));
+      BOOST_TEST(lk.owns_lock());
+      BOOST_TEST(lk.mutex() == &stripes.mutex_for(std::string("key")));
+      BOOST_TEST(! stripes.mutex_for(std::string("key")).try_lock());
+    }
+    BOOST_TEST(stripes.mutex_for(std::string("key")).try_lock());
+    stripes.mutex_for(std::string("key")).unlock();
+  }
+  {
+    boost::striped_lockable<boost::shared_mutex, 8> stripes;
+    boost::shared_lock<boost::shared_mutex> lk1 = stripes.lock_shared_for(42);
+    boost::shared_lock<boost::shared_mutex> lk2 = stripes.lock_shared_for(42);
+    BOOST_TEST(lk1.owns_lock());
+    BOOST_TEST(lk2.owns_lock());
+    BOOST_TEST(! stripes.mutex_for(42).try_lock());
+    lk1.unlock();
+    lk2.unlock();
+    boost::unique_lock<boost::shared_mutex> lk3 = stripes.lock_for(42);
+    BOOST_TEST(! stripes.mutex_for(42).try_lock_shared());
+  }
+
+  return boost::report_errors();
+}
@@ -0,0 +1,113 @@
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/synchronized_value.hpp>
+
+// class synchronized_value<T,flat_combining_mutex>
+
+//    template <typename F>
+//    inline typename boost::result_of<F(value_type&)>::type
+//    operator()(BOOST_THREAD_RV_REF(F) fct);
+//    template <typename F>
+//    inline typename boost::result_of<F(value_type const&)>::type
+//    operator()(BOOST_THREAD_RV_REF(F) fct) const;
+
+#include <boost/config.hpp>
+#if ! defined  BOOST_NO_CXX11_DECLTYPE
+#define BOOST_RESULT_OF_USE_DECLTYPE
+#endif
+
+#define BOOST_THREAD_VERSION 4
+
+#include <boost/thread/synchronized_value.hpp>
+#include <boost/thread/flat_combining_mutex.hpp>
+#include <boost/thread/thread.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+#include <map>
+#if ! defined BOOST_NO_CXX11_SMART_PTR
+#include <memory>
+#endif
+
+typedef std::map<int, int> histogram;
+
+struct add
+{
+  typedef int result_type;
+  int key;
+  explicit add(int key) : key(key) {}
+  int operator()(histogram& h) const
+  {
+    return ++h[key];
+  }
+};
+
+struct total
+{
+  typedef int result_type;
+  int operator()(histogram const& h) const
+  {
+    int n = 0;
+    for (histogram::const_iterator it = h.begin(); it != h.end(); ++it) n += it->second;
+    return n;
+  }
+};
+
+int twice(int& i)
+{
+  return i *= 2;
+}
+
+#if ! defined BOOST_NO_CXX11_SMART_PTR
+// the result is moved out of the request executed by the combiner.
+struct take
+{
+  typedef std::unique_ptr<int> result_type;
+  std::unique_ptr<int> operator()(int& i) const
+  {
+    return std::unique_ptr<int>(new int(i));
+  }
+};
+#endif
+
+void fill(boost::synchronized_value<histogram, boost::flat_combining_mutex>* sv, int n)
+{
+  for (int i = 0; i < n; ++i) (*sv)(add(i % 10));
+}
+
+int main()
+{
+  BOOST_STATIC_ASSERT((boost::detail::synchronized_value_combines_calls<boost::flat_combining_mutex>::value));
+  BOOST_STATIC_ASSERT((! boost::detail::synchronized_value_combines_calls<boost::mutex>::value));
+  {
+    boost::synchronized_value<int, boost::flat_combining_mutex> v(1);
+    BOOST_TEST_EQ(v(&twice), 2);
+    BOOST_TEST_EQ(v.get(), 2);
+    *v.synchronize() += 1;
+    BOOST_TEST_EQ(v.get(), 3);
+#if ! defined BOOST_NO_CXX11_SMART_PTR
+    std::unique_ptr<int> p = v(take());
+    BOOST_TEST(p && *p == 3);
+#endif
+  }
+  {
+    boost::synchronized_value<histogram, boost::flat_combining_mutex> v;
+    BOOST_TEST_EQ(v(add(1)), 1);
+    BOOST_TEST_EQ(v(add(1)), 2);
+    boost::synchronized_value<histogram, boost::flat_combining_mutex> const& cv = v;
+    BOOST_TEST_EQ(cv(total()), 2);
+  }
+  {
+    boost::synchronized_value<histogram, boost::flat_combining_mutex> v;
+    boost::thread_group threads;
+    for (int i = 0; i < 8; ++i) threads.create_thread(boost::bind(&fill, &v, 1000));
+    threads.join_all();
+    BOOST_TEST_EQ(v(total()), 8000);
+    BOOST_TEST_EQ(v->size(), 10u);
+    BOOST_TEST_EQ(v->find(3)->second, 800);
+  }
+
+  return boost::report_errors();
+}
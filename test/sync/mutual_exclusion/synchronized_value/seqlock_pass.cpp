@@ -0,0 +1,133 @@
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/synchronized_value.hpp>
+
+// class synchronized_value<T,seqlock>
+
+// T get() const;
+// relational operators
+
+#define BOOST_THREAD_VERSION 4
+
+#include <boost/thread/synchronized_value.hpp>
+#include <boost/thread/seqlock.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/atomic.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+
+// copied with memcpy.
+struct block
+{
+  long v[8];
+};
+block make_block(long i)
+{
+  block b;
+  for (int j = 0; j < 8; ++j) b.v[j] = i;
+  return b;
+}
+bool operator==(block const& x, block const& y)
+{
+  return x.v[0] == y.v[0];
+}
+bool operator<(block const& x, block const& y)
+{
+  return x.v[0] < y.v[0];
+}
+
+boost::atomic<bool> done(false);
+
+void write_blocks(boost::synchronized_value<block, boost::seqlock>* sv, long n)
+{
+  for (long i = 1; i <= n; ++i)
+  {
+    boost::strict_lock_ptr<block, boost::seqlock> p = sv->synchronize();
+    for (int j = 0; j < 8; ++j)
+    {
+      p->v[j] = i;
+      boost::this_thread::yield();
+    }
+  }
+  done = true;
+}
+
+void read_blocks(boost::synchronized_value<block, boost::seqlock>* sv, long* torn)
+{
+  long last = 0;
+  while (! done)
+  {
+    block const b = sv->get();
+    for (int j = 1; j < 8; ++j)
+      if (b.v[j] != b.v[0]) ++*torn;
+    // the values read don't go back in time.
+    if (b.v[0] < last) ++*torn;
+    last = b.v[0];
+  }
+}
+
+int main()
+{
+  BOOST_STATIC_ASSERT((boost::detail::synchronized_value_reads_optimistically<int, boost::seqlock>::value));
+  BOOST_STATIC_ASSERT((boost::detail::synchronized_value_reads_optimistically<block, boost::seqlock>::value));
+  BOOST_STATIC_ASSERT((! boost::detail::synchronized_value_reads_optimistically<std::string, boost::seqlock>::value));
+  BOOST_STATIC_ASSERT((! boost::detail::synchronized_value_reads_optimistically<int, boost::mutex>::value));
+  {
+    boost::synchronized_value<int, boost::seqlock> v(1);
+    BOOST_TEST(v.get() == 1);
+    v = 2;
+    BOOST_TEST(v.get() == 2);
+    *v.synchronize() += 1;
+    BOOST_TEST(v.get() == 3);
+    BOOST_TEST(v == 3);
+    BOOST_TEST(v != 1);
+    BOOST_TEST(v < 4);
+    BOOST_TEST(v <= 3);
+    BOOST_TEST(v > 2);
+    BOOST_TEST(v >= 3);
+    BOOST_TEST(3 == v);
+    boost::synchronized_value<int, boost::seqlock> w(4);
+    BOOST_TEST(v < w);
+    BOOST_TEST(w > v);
+    BOOST_TEST(v <= w);
+    BOOST_TEST(w >= v);
+    BOOST_TEST(v != w);
+    BOOST_TEST(v == v);
+    w = v;
+    BOOST_TEST(v == w);
+  }
+  {
+    // not trivially copyable: the mutex is locked.
+    boost::synchronized_value<std::string, boost::seqlock> v(std::string("a"));
+    BOOST_TEST(v.get() == "a");
+    v->append("b");
+    BOOST_TEST(v == std::string("ab"));
+  }
+  {
+    boost::seqlock m;
+    unsigned const s = m.read_begin();
+    BOOST_TEST(! m.read_retry(s));
+    m.lock();
+    BOOST_TEST(! m.try_lock());
+    m.unlock();
+    BOOST_TEST(m.read_retry(s));
+    BOOST_TEST(m.try_lock());
+    m.unlock();
+  }
+  {
+    boost::synchronized_value<block, boost::seqlock> v(make_block(0));
+    long torn[3] = { 0, 0, 0 };
+    boost::thread_group threads;
+    for (int i = 0; i < 3; ++i) threads.create_thread(boost::bind(&read_blocks, &v, &torn[i]));
+    write_blocks(&v, 2000);
+    threads.join_all();
+    BOOST_TEST_EQ(torn[0] + torn[1] + torn[2], 0);
+    BOOST_TEST(v == make_block(2000));
+  }
+
+  return boost::report_errors();
+}
@@ -0,0 +1,96 @@
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/mutex.hpp>
+
+// class timed_mutex;
+
+// template <class Duration>
+//     bool try_lock_until(const chrono::time_point<chrono::system_clock, Duration>& abs_time);
+
+// On Linux, the timed_mutex is a futex word: 0 if unlocked, 1 if locked, 2 if locked and some threads can be waiting.
+
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "../../../timming.hpp"
+
+#if defined BOOST_THREAD_USES_CHRONO
+
+boost::timed_mutex g_mutex;
+
+typedef boost::chrono::system_clock Clock;
+typedef Clock::time_point time_point;
+typedef boost::chrono::milliseconds ms;
+typedef boost::chrono::nanoseconds ns;
+
+const ms max_diff(BOOST_THREAD_TEST_TIME_MS);
+
+bool g_locked = false;
+time_point g_t1;
+
+void until_system_time(time_point t)
+{
+  g_locked = g_mutex.try_lock_until(t);
+  g_t1 = Clock::now();
+  if (g_locked) g_mutex.unlock();
+}
+
+int main()
+{
+  {
+    // the deadline on the system clock expires while the mutex is locked.
+    g_mutex.lock();
+    time_point const t0 = Clock::now();
+    boost::thread t(until_system_time, t0 + ms(250));
+    t.join();
+    BOOST_TEST(! g_locked);
+    ns d = g_t1 - t0 - ms(250);
+    BOOST_TEST(d >= ns(0));
+    BOOST_THREAD_TEST_IT(d, ns(max_diff));
+#if defined BOOST_THREAD_TIMED_MUTEX_USES_FUTEX
+    // the waiter has left the state to 2, so that the unlock wakes up a thread even if none is waiting.
+    BOOST_TEST_EQ(g_mutex.native_handle()->load(), 2u);
+#endif
+    g_mutex.unlock();
+#if defined BOOST_THREAD_TIMED_MUTEX_USES_FUTEX
+    BOOST_TEST_EQ(g_mutex.native_handle()->load(), 0u);
+#endif
+    BOOST_TEST(g_mutex.try_lock());
+#if defined BOOST_THREAD_TIMED_MUTEX_USES_FUTEX
+    BOOST_TEST_EQ(g_mutex.native_handle()->load(), 1u);
+#endif
+    g_mutex.unlock();
+  }
+  {
+    // the mutex is unlocked before the deadline on the system clock.
+    g_mutex.lock();
+    time_point const t0 = Clock::now();
+    boost::thread t(until_system_time, t0 + ms(5000));
+    boost::this_thread::sleep_for(ms(250));
+    time_point const t2 = Clock::now();
+    g_mutex.unlock();
+    t.join();
+    BOOST_TEST(g_locked);
+    ns d = g_t1 - t2;
+    BOOST_THREAD_TEST_IT(d, ns(max_diff));
+  }
+  {
+    // a deadline already expired doesn't wait.
+    g_mutex.lock();
+    time_point const t0 = Clock::now();
+    boost::thread t(until_system_time, t0 - ms(1000));
+    t.join();
+    BOOST_TEST(! g_locked);
+    BOOST_THREAD_TEST_IT(ns(g_t1 - t0), ns(max_diff));
+    g_mutex.unlock();
+  }
+
+  return boost::report_errors();
+}
+
+#else
+#error "Test not applicable: BOOST_THREAD_USES_CHRONO not defined for this platform as not supported"
+#endif
@@ -0,0 +1,188 @@
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/config.hpp>
+#if ! defined  BOOST_NO_CXX11_DECLTYPE
+#define BOOST_RESULT_OF_USE_DECLTYPE
+#endif
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_PROVIDES_EXECUTORS
+
+#include <boost/thread/executors/bounded_thread_pool.hpp>
+#include <boost/thread/future.hpp>
+#include <boost/thread/latch.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/lock_guard.hpp>
+#include <vector>
+
+#include <boost/core/lightweight_test.hpp>
+
+struct wait_gate
+{
+  boost::latch* gate;
+
+  void operator()() const
+  {
+    gate->wait();
+  }
+};
+
+struct record
+{
+  boost::mutex* mtx;
+  std::vector<int>* ran;
+  int id;
+  boost::thread::id* thread_id;
+
+  void operator()() const
+  {
+    boost::lock_guard<boost::mutex> lk(*mtx);
+    ran->push_back(id);
+    if (thread_id) *thread_id = boost::this_thread::get_id();
+  }
+};
+
+struct open_gate
+{
+  boost::latch* gate;
+
+  void operator()() const
+  {
+    boost::this_thread::sleep_for(boost::chrono::milliseconds(50));
+    gate->count_down();
+  }
+};
+
+// Blocks the single worker of the pool, then fills its queue with the closures 0 and 1.
+void fill(boost::bounded_thread_pool& pool, boost::latch& gate, boost::mutex& mtx, std::vector<int>& ran)
+{
+  wait_gate blocker = {&gate};
+  pool.submit(blocker);
+  // wait until the worker has pulled the blocker.
+  while (pool.size() != 0) boost::this_thread::yield();
+  for (int i = 0; i < 2; ++i)
+  {
+    record r = {&mtx, &ran, i, 0};
+    BOOST_TEST(pool.try_submit(r) == boost::queue_op_status::success);
+  }
+  BOOST_TEST_EQ(pool.size(), 2u);
+}
+
+void test_reject()
+{
+  boost::latch gate(1);
+  boost::mutex mtx;
+  std::vector<int> ran;
+  {
+    boost::bounded_thread_pool pool(2, boost::overflow_policy::reject, 1);
+    BOOST_TEST(pool.policy() == boost::overflow_policy::reject);
+    BOOST_TEST_EQ(pool.capacity(), 2u);
+    fill(pool, gate, mtx, ran);
+    record r = {&mtx, &ran, 2, 0};
+    BOOST_TEST(pool.try_submit(r) == boost::queue_op_status::full);
+    try
+    {
+      pool.submit(r);
+      BOOST_TEST(false);
+    }
+    catch (boost::sync_queue_is_full&)
+    {
+    }
+    gate.count_down();
+  }
+  BOOST_TEST_EQ(ran.size(), 2u);
+}
+
+void test_caller_runs()
+{
+  boost::latch gate(1);
+  boost::mutex mtx;
+  std::vector<int> ran;
+  boost::thread::id runner;
+  {
+    boost::bounded_thread_pool pool(2, boost::overflow_policy::caller_runs, 1);
+    fill(pool, gate, mtx, ran);
+    record r = {&mtx, &ran, 2, &runner};
+    BOOST_TEST(pool.try_submit(r) == boost::queue_op_status::success);
+    // The closure has been run by the submitter before the queued ones.
+    BOOST_TEST(runner == boost::this_thread::get_id());
+    BOOST_TEST_EQ(ran.size(), 1u);
+    gate.count_down();
+  }
+  BOOST_TEST_EQ(ran.size(), 3u);
+  BOOST_TEST_EQ(ran[0], 2);
+}
+
+void test_drop_oldest()
+{
+  boost::latch gate(1);
+  boost::mutex mtx;
+  std::vector<int> ran;
+  {
+    boost::bounded_thread_pool pool(2, boost::overflow_policy::drop_oldest, 1);
+    fill(pool, gate, mtx, ran);
+    record r = {&mtx, &ran, 2, 0};
+    BOOST_TEST(pool.try_submit(r) == boost::queue_op_status::success);
+    BOOST_TEST_EQ(pool.size(), 2u);
+    gate.count_down();
+  }
+  BOOST_TEST_EQ(ran.size(), 2u);
+  BOOST_TEST_EQ(ran[0], 1);
+  BOOST_TEST_EQ(ran[1], 2);
+}
+
+void test_block()
+{
+  boost::latch gate(1);
+  boost::mutex mtx;
+  std::vector<int> ran;
+  {
+    boost::bounded_thread_pool pool(2, boost::overflow_policy::block, 1);
+    fill(pool, gate, mtx, ran);
+    // The submitter is blocked until the gate is opened by another thread.
+    open_gate opener = {&gate};
+    boost::thread th(opener);
+    record r = {&mtx, &ran, 2, 0};
+    pool.submit(r);
+    th.join();
+  }
+  BOOST_TEST_EQ(ran.size(), 3u);
+  BOOST_TEST_EQ(ran[2], 2);
+}
+
+int twice(int x)
+{
+  return 2 * x;
+}
+
+void test_closed()
+{
+  boost::bounded_thread_pool pool(4);
+  boost::future<int> f = boost::async(pool, &twice, 21);
+  BOOST_TEST_EQ(f.get(), 42);
+  pool.close();
+  BOOST_TEST(pool.closed());
+  BOOST_TEST(pool.try_submit(&test_closed) == boost::queue_op_status::closed);
+  try
+  {
+    pool.submit(&test_closed);
+    BOOST_TEST(false);
+  }
+  catch (boost::sync_queue_is_closed&)
+  {
+  }
+}
+
+int main()
+{
+  test_reject();
+  test_caller_runs();
+  test_drop_oldest();
+  test_block();
+  test_closed();
+  return boost::report_errors();
+}
@@ -0,0 +1,112 @@
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/config.hpp>
+#if ! defined  BOOST_NO_CXX11_DECLTYPE
+#define BOOST_RESULT_OF_USE_DECLTYPE
+#endif
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_PROVIDES_EXECUTORS
+
+#include <boost/thread/executors/cached_thread_executor.hpp>
+#include <boost/thread/future.hpp>
+#include <boost/thread/latch.hpp>
+#include <boost/atomic.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+using boost::chrono::milliseconds;
+
+boost::thread::id get_id()
+{
+  return boost::this_thread::get_id();
+}
+
+struct rendezvous
+{
+  boost::latch* all_started;
+
+  void operator()() const
+  {
+    // Only completes if the closures run at the same time.
+    all_started->count_down_and_wait();
+  }
+};
+
+// Waits until the threads that have run a closure are parked or have exited.
+void wait_parked(boost::cached_thread_executor& ex, std::size_t n)
+{
+  while (ex.num_idle_threads() != n) boost::this_thread::yield();
+}
+
+void test_reuse()
+{
+  boost::cached_thread_executor ex;
+  boost::thread::id first = boost::async(ex, &get_id).get();
+  wait_parked(ex, 1);
+  for (int i = 0; i < 100; ++i)
+  {
+    BOOST_TEST(boost::async(ex, &get_id).get() == first);
+    wait_parked(ex, 1);
+  }
+  BOOST_TEST_EQ(ex.num_threads(), 1u);
+}
+
+void test_no_queueing()
+{
+  boost::latch all_started(4);
+  {
+    boost::cached_thread_executor ex;
+    for (int i = 0; i < 4; ++i)
+    {
+      rendezvous r = {&all_started};
+      ex.submit(r);
+    }
+    wait_parked(ex, 4);
+    BOOST_TEST_EQ(ex.num_threads(), 4u);
+  }
+  BOOST_TEST(all_started.try_wait());
+}
+
+void test_idle_timeout()
+{
+  boost::cached_thread_executor ex(milliseconds(10));
+  boost::async(ex, &get_id).get();
+  while (ex.num_threads() != 0) boost::this_thread::sleep_for(milliseconds(1));
+  BOOST_TEST_EQ(ex.num_idle_threads(), 0u);
+  // The exited thread is joined and a new one is created.
+  boost::async(ex, &get_id).get();
+  BOOST_TEST(ex.num_threads() <= 1u);
+}
+
+void nothing()
+{
+}
+
+void test_closed()
+{
+  boost::cached_thread_executor ex;
+  ex.close();
+  BOOST_TEST(ex.closed());
+  try
+  {
+    ex.submit(&nothing);
+    BOOST_TEST(false);
+  }
+  catch (boost::sync_queue_is_closed&)
+  {
+  }
+}
+
+int main()
+{
+  test_reuse();
+  test_no_queueing();
+  test_idle_timeout();
+  test_closed();
+  return boost::report_errors();
+}
@@ -0,0 +1,207 @@
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/config.hpp>
+#if ! defined  BOOST_NO_CXX11_DECLTYPE
+#define BOOST_RESULT_OF_USE_DECLTYPE
+#endif
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_PROVIDES_EXECUTORS
+
+#include <boost/thread/executors/deadline_thread_pool.hpp>
+#include <boost/thread/future.hpp>
+#include <boost/thread/latch.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/lock_guard.hpp>
+#include <boost/atomic.hpp>
+#include <vector>
+
+#include <boost/core/lightweight_test.hpp>
+
+using boost::chrono::milliseconds;
+using boost::chrono::seconds;
+typedef boost::deadline_thread_pool::clock clock_type;
+
+const unsigned critical = 0;
+const unsigned background = 1;
+
+boost::csbl::vector<boost::qos_class> two_classes(unsigned background_cap = 0)
+{
+  boost::csbl::vector<boost::qos_class> classes;
+  classes.push_back(boost::qos_class(milliseconds(10)));
+  classes.push_back(boost::qos_class(seconds(1), background_cap));
+  return classes;
+}
+
+struct wait_gate
+{
+  boost::latch* gate;
+
+  void operator()() const
+  {
+    gate->wait();
+  }
+};
+
+struct record
+{
+  boost::mutex* mtx;
+  std::vector<int>* ran;
+  int id;
+
+  void operator()() const
+  {
+    boost::lock_guard<boost::mutex> lk(*mtx);
+    ran->push_back(id);
+  }
+};
+
+// Blocks the single worker of the pool until the gate is opened.
+void block(boost::deadline_thread_pool& pool, boost::latch& gate)
+{
+  wait_gate blocker = {&gate};
+  pool.submit(critical, blocker);
+  while (pool.stats(critical).running == 0) boost::this_thread::yield();
+}
+
+void test_earliest_deadline_first()
+{
+  boost::latch gate(1);
+  boost::mutex mtx;
+  std::vector<int> ran;
+  {
+    boost::deadline_thread_pool pool(two_classes(), 1);
+    BOOST_TEST_EQ(pool.num_classes(), 2u);
+    block(pool, gate);
+    for (int i = 0; i < 3; ++i)
+    {
+      record r = {&mtx, &ran, i};
+      pool.submit(background, r);
+    }
+    record r = {&mtx, &ran, 10};
+    pool.submit(critical, r);
+    record late = {&mtx, &ran, 20};
+    pool.submit_before(background, late, clock_type::now() + milliseconds(1));
+    gate.count_down();
+  }
+  BOOST_TEST_EQ(ran.size(), 5u);
+  BOOST_TEST_EQ(ran[0], 20);
+  BOOST_TEST_EQ(ran[1], 10);
+  BOOST_TEST_EQ(ran[2], 0);
+  BOOST_TEST_EQ(ran[4], 2);
+}
+
+void test_no_starvation()
+{
+  boost::latch gate(1);
+  boost::mutex mtx;
+  std::vector<int> ran;
+  {
+    boost::csbl::vector<boost::qos_class> classes;
+    classes.push_back(boost::qos_class(milliseconds(100)));
+    classes.push_back(boost::qos_class(milliseconds(20)));
+    boost::deadline_thread_pool pool(classes, 1);
+    block(pool, gate);
+    record old = {&mtx, &ran, 0};
+    pool.submit(background, old);
+    boost::this_thread::sleep_for(milliseconds(30));
+    // The deadline of the background closure is now earlier than the one of the new latency-critical closure.
+    record r = {&mtx, &ran, 1};
+    pool.submit(critical, r);
+    gate.count_down();
+  }
+  BOOST_TEST_EQ(ran.size(), 2u);
+  BOOST_TEST_EQ(ran[0], 0);
+}
+
+struct track_concurrency
+{
+  boost::atomic<int>* running;
+  boost::atomic<int>* max_running;
+
+  void operator()() const
+  {
+    int r = running->fetch_add(1) + 1;
+    int m = max_running->load();
+    while (r > m && ! max_running->compare_exchange_weak(m, r)) {}
+    boost::this_thread::sleep_for(milliseconds(1));
+    running->fetch_sub(1);
+  }
+};
+
+void test_concurrency_cap()
+{
+  boost::atomic<int> running(0);
+  boost::atomic<int> max_running(0);
+  boost::deadline_thread_pool pool(two_classes(1), 3);
+  for (int i = 0; i < 20; ++i)
+  {
+    track_concurrency t = {&running, &max_running};
+    pool.submit(background, t);
+  }
+  while (pool.stats(background).completed != 20) boost::this_thread::sleep_for(milliseconds(1));
+  BOOST_TEST_EQ(max_running.load(), 1);
+}
+
+void nothing()
+{
+}
+
+int twice(int x)
+{
+  return 2 * x;
+}
+
+void test_stats()
+{
+  boost::latch gate(1);
+  boost::deadline_thread_pool pool(two_classes(), 1);
+  block(pool, gate);
+  pool.submit(background, &nothing);
+  boost::qos_stats s = pool.stats(background);
+  BOOST_TEST_EQ(s.submitted, 1u);
+  BOOST_TEST_EQ(s.queued, 1u);
+  BOOST_TEST_EQ(s.completed, 0u);
+  // Only the closure of the class 0 misses its deadline.
+  boost::this_thread::sleep_for(milliseconds(20));
+  gate.count_down();
+  boost::future<int> f = boost::async(pool, &twice, 21);
+  BOOST_TEST_EQ(f.get(), 42);
+  while (pool.stats(background).completed != 1) boost::this_thread::yield();
+  boost::qos_stats c = pool.stats(critical);
+  BOOST_TEST(c.missed_deadlines >= 1u);
+  BOOST_TEST(c.completed >= 1u);
+  s = pool.stats(background);
+  BOOST_TEST_EQ(s.missed_deadlines, 0u);
+  BOOST_TEST(s.max_wait >= milliseconds(20));
+  BOOST_TEST(s.total_wait >= s.max_wait);
+}
+
+void test_closed()
+{
+  boost::deadline_thread_pool pool(two_classes(), 1);
+  pool.close();
+  BOOST_TEST(pool.closed());
+  try
+  {
+    pool.submit(critical, &nothing);
+    BOOST_TEST(false);
+  }
+  catch (boost::sync_queue_is_closed&)
+  {
+  }
+}
+
+int main()
+{
+  test_earliest_deadline_first();
+  test_no_starvation();
+  test_concurrency_cap();
+  test_stats();
+  test_closed();
+  return boost::report_errors();
+}
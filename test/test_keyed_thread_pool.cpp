@@ -0,0 +1,138 @@
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/config.hpp>
+#if ! defined  BOOST_NO_CXX11_DECLTYPE
+#define BOOST_RESULT_OF_USE_DECLTYPE
+#endif
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_PROVIDES_EXECUTORS
+
+#include <boost/thread/executors/keyed_thread_pool.hpp>
+#include <boost/thread/future.hpp>
+#include <boost/atomic.hpp>
+#include <string>
+#include <vector>
+
+#include <boost/core/lightweight_test.hpp>
+
+const int keys = 8;
+const int events = 1000;
+
+struct account
+{
+  std::vector<int> events;
+  boost::thread::id owner;
+  bool same_owner;
+
+  account() : same_owner(true) {}
+};
+
+struct post_event
+{
+  account* acc;
+  int event;
+
+  void operator()() const
+  {
+    // Only the worker of the partition of the key touches the account.
+    if (acc->events.empty()) acc->owner = boost::this_thread::get_id();
+    else if (acc->owner != boost::this_thread::get_id()) acc->same_owner = false;
+    acc->events.push_back(event);
+  }
+};
+
+struct increment
+{
+  boost::atomic<int>* count;
+
+  void operator()() const
+  {
+    count->fetch_add(1);
+  }
+};
+
+int twice(int x)
+{
+  return 2 * x;
+}
+
+void test_per_key_order()
+{
+  std::vector<account> accounts(keys);
+  {
+    boost::keyed_thread_pool pool(3);
+    for (int e = 0; e < events; ++e)
+    {
+      for (int k = 0; k < keys; ++k)
+      {
+        post_event closure = {&accounts[k], e};
+        pool.submit(k, closure);
+      }
+    }
+  }
+  for (int k = 0; k < keys; ++k)
+  {
+    BOOST_TEST(accounts[k].same_owner);
+    BOOST_TEST_EQ(accounts[k].events.size(), std::size_t(events));
+    bool in_order = true;
+    for (int e = 0; e < events; ++e)
+    {
+      if (accounts[k].events[e] != e) in_order = false;
+    }
+    BOOST_TEST(in_order);
+  }
+}
+
+void test_partition()
+{
+  boost::keyed_thread_pool pool(4);
+  BOOST_TEST_EQ(pool.num_threads(), 4u);
+  BOOST_TEST_EQ(pool.partition(std::string("account")), pool.partition(std::string("account")));
+  BOOST_TEST(pool.partition(12345) < 4u);
+  BOOST_TEST(! pool.try_executing_one());
+}
+
+void test_unkeyed()
+{
+  boost::atomic<int> count(0);
+  {
+    boost::keyed_thread_pool pool(2);
+    for (int i = 0; i < 100; ++i)
+    {
+      increment closure = {&count};
+      pool.submit(closure);
+    }
+    boost::future<int> f = boost::async(pool, &twice, 21);
+    BOOST_TEST_EQ(f.get(), 42);
+  }
+  BOOST_TEST_EQ(count.load(), 100);
+}
+
+void test_closed()
+{
+  boost::keyed_thread_pool pool(2);
+  pool.close();
+  BOOST_TEST(pool.closed());
+  try
+  {
+    pool.submit(1, &test_partition);
+    BOOST_TEST(false);
+  }
+  catch (boost::sync_queue_is_closed&)
+  {
+  }
+}
+
+int main()
+{
+  test_per_key_order();
+  test_partition();
+  test_unkeyed();
+  test_closed();
+  return boost::report_errors();
+}
@@ -0,0 +1,174 @@
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/config.hpp>
+#if ! defined  BOOST_NO_CXX11_DECLTYPE
+#define BOOST_RESULT_OF_USE_DECLTYPE
+#endif
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_PROVIDES_EXECUTORS
+
+#include <boost/thread/executors/mailbox_executor.hpp>
+#include <boost/thread/executors/basic_thread_pool.hpp>
+#include <boost/thread/executors/loop_executor.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/future.hpp>
+#include <boost/atomic.hpp>
+#include <vector>
+
+#include <boost/core/lightweight_test.hpp>
+
+typedef boost::mailbox_executor<boost::basic_thread_pool> mailbox;
+
+const int sessions = 100;
+const int producers = 4;
+const int messages = 200;
+
+struct session
+{
+  std::vector<int> last;
+  boost::atomic<int> running;
+  bool overlapped;
+  bool in_order;
+
+  session() : last(producers, -1), running(0), overlapped(false), in_order(true) {}
+};
+
+struct deliver
+{
+  session* s;
+  int producer;
+  int message;
+
+  void operator()() const
+  {
+    if (s->running.fetch_add(1) != 0) s->overlapped = true;
+    if (s->last[producer] != message - 1) s->in_order = false;
+    s->last[producer] = message;
+    s->running.fetch_sub(1);
+  }
+};
+
+struct producer
+{
+  std::vector<session>* states;
+  std::vector<mailbox*>* boxes;
+  int id;
+
+  void operator()() const
+  {
+    for (int m = 0; m < messages; ++m)
+    {
+      for (int s = 0; s < sessions; ++s)
+      {
+        deliver closure = {&(*states)[s], id, m};
+        (*boxes)[s]->submit(closure);
+      }
+    }
+  }
+};
+
+int twice(int x)
+{
+  return 2 * x;
+}
+
+void test_serialized()
+{
+  std::vector<session> states(sessions);
+  boost::basic_thread_pool pool(3);
+  {
+    std::vector<mailbox*> boxes;
+    for (int s = 0; s < sessions; ++s) boxes.push_back(new mailbox(pool, 16));
+    boost::thread_group group;
+    for (int p = 0; p < producers; ++p)
+    {
+      producer closure = {&states, &boxes, p};
+      group.create_thread(closure);
+    }
+    group.join_all();
+    // The destructors wait for the closures of each mailbox.
+    for (int s = 0; s < sessions; ++s) delete boxes[s];
+  }
+  for (int s = 0; s < sessions; ++s)
+  {
+    BOOST_TEST(! states[s].overlapped);
+    BOOST_TEST(states[s].in_order);
+    BOOST_TEST_EQ(states[s].last[0], messages - 1);
+    BOOST_TEST_EQ(states[s].last[producers - 1], messages - 1);
+  }
+}
+
+void test_idle()
+{
+  boost::basic_thread_pool pool(1);
+  mailbox box(pool);
+  // An idle mailbox takes a few words.
+  BOOST_TEST(sizeof(mailbox) <= 8 * sizeof(void*));
+  BOOST_TEST(box.empty());
+  boost::future<int> f = boost::async(box, &twice, 21);
+  BOOST_TEST_EQ(f.get(), 42);
+  box.close();
+  BOOST_TEST(box.closed());
+  try
+  {
+    box.submit(&test_idle);
+    BOOST_TEST(false);
+  }
+  catch (boost::sync_queue_is_closed&)
+  {
+  }
+}
+
+boost::atomic<int> runs(0);
+
+void count_run()
+{
+  ++runs;
+}
+
+void test_closed_underlying_executor()
+{
+  {
+    // The job draining the mailbox can't be submitted: the closure is discarded and the mailbox can be destroyed.
+    boost::basic_thread_pool pool(1);
+    pool.close();
+    mailbox box(pool);
+    try
+    {
+      box.submit(&count_run);
+      BOOST_TEST(false);
+    }
+    catch (boost::sync_queue_is_closed&)
+    {
+    }
+    BOOST_TEST(box.empty());
+  }
+  {
+    // The job draining the mailbox can't submit itself again: the closures left are discarded.
+    boost::loop_executor ex;
+    boost::mailbox_executor<boost::loop_executor> box(ex, 1);
+    runs = 0;
+    box.submit(&count_run);
+    box.submit(&count_run);
+    box.submit(&count_run);
+    ex.close();
+    BOOST_TEST(ex.try_executing_one());
+    BOOST_TEST_EQ(runs, 1);
+    BOOST_TEST(box.empty());
+    BOOST_TEST(! ex.try_executing_one());
+  }
+  BOOST_TEST_EQ(runs, 1);
+}
+
+int main()
+{
+  test_serialized();
+  test_idle();
+  test_closed_underlying_executor();
+  return boost::report_errors();
+}
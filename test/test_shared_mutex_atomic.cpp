@@ -0,0 +1,157 @@
+// Copyright (C) 2026 The Boost.Thread Contributors
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_ATOMIC_SHARED_MUTEX
+#define BOOST_THREAD_PROVIDES_SHARED_MUTEX_UPWARDS_CONVERSIONS
+
+#include <boost/thread/shared_mutex.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/lock_types.hpp>
+#include <boost/atomic.hpp>
+
+#include <boost/detail/lightweight_test.hpp>
+
+boost::shared_mutex m;
+long a = 0;
+long b = 0;
+boost::atomic<bool> inconsistent(false);
+
+void reader()
+{
+  for (int i = 0; i < 2000; ++i)
+  {
+    boost::shared_lock<boost::shared_mutex> lk(m);
+    if (a != b) inconsistent = true;
+  }
+}
+
+void writer()
+{
+  for (int i = 0; i < 500; ++i)
+  {
+    boost::unique_lock<boost::shared_mutex> lk(m);
+    ++a;
+    boost::this_thread::yield();
+    ++b;
+  }
+}
+
+void upgrader()
+{
+  for (int i = 0; i < 500; ++i)
+  {
+    m.lock_upgrade();
+    if (a != b) inconsistent = true;
+    m.unlock_upgrade_and_lock();
+    ++a;
+    ++b;
+    m.unlock_and_lock_upgrade();
+    m.unlock_upgrade_and_lock_shared();
+    if (a != b) inconsistent = true;
+    m.unlock_shared();
+  }
+}
+
+void test_readers_writers_upgraders()
+{
+  boost::thread_group threads;
+  for (int i = 0; i < 4; ++i) threads.create_thread(&reader);
+  for (int i = 0; i < 2; ++i) threads.create_thread(&writer);
+  for (int i = 0; i < 2; ++i) threads.create_thread(&upgrader);
+  threads.join_all();
+  BOOST_TEST(! inconsistent);
+  BOOST_TEST_EQ(a, 2000);
+  BOOST_TEST_EQ(b, 2000);
+  BOOST_TEST(m.try_lock());
+  m.unlock();
+}
+
+void lock_and_unlock(boost::shared_mutex* mtx, boost::atomic<bool>* locked)
+{
+  mtx->lock();
+  *locked = true;
+  mtx->unlock();
+}
+
+void test_waiting_writer_blocks_new_readers()
+{
+  boost::shared_mutex mtx;
+  boost::atomic<bool> locked(false);
+  mtx.lock_shared();
+  boost::thread th(&lock_and_unlock, &mtx, &locked);
+  boost::this_thread::sleep_for(boost::chrono::milliseconds(100));
+  BOOST_TEST(! locked);
+  BOOST_TEST(! mtx.try_lock_shared());
+  BOOST_TEST(! mtx.try_lock_upgrade());
+  mtx.unlock_shared();
+  th.join();
+  BOOST_TEST(locked);
+  BOOST_TEST(mtx.try_lock_shared());
+  mtx.unlock_shared();
+}
+
+void test_timed_out_writer_unblocks_readers()
+{
+  boost::shared_mutex mtx;
+  mtx.lock_shared();
+  BOOST_TEST(! mtx.try_lock_for(boost::chrono::milliseconds(50)));
+  BOOST_TEST(mtx.try_lock_shared());
+  mtx.unlock_shared();
+  BOOST_TEST(! mtx.try_lock_until(boost::chrono::system_clock::now() + boost::chrono::milliseconds(50)));
+  BOOST_TEST(mtx.try_lock_upgrade());
+  mtx.unlock_upgrade();
+  mtx.unlock_shared();
+  BOOST_TEST(mtx.try_lock());
+  mtx.unlock();
+}
+
+void unlock_shared_after(boost::shared_mutex* mtx, boost::chrono::milliseconds d)
+{
+  boost::this_thread::sleep_for(d);
+  mtx->unlock_shared();
+}
+
+void test_upgrade_to_exclusive()
+{
+  boost::shared_mutex mtx;
+  mtx.lock_upgrade();
+  mtx.lock_shared();
+  BOOST_TEST(! mtx.try_unlock_upgrade_and_lock());
+  BOOST_TEST(! mtx.try_unlock_upgrade_and_lock_for(boost::chrono::milliseconds(20)));
+  boost::thread th(&unlock_shared_after, &mtx, boost::chrono::milliseconds(50));
+  BOOST_TEST(mtx.try_unlock_upgrade_and_lock_for(boost::chrono::seconds(10)));
+  th.join();
+  BOOST_TEST(! mtx.try_lock_shared());
+  mtx.unlock();
+}
+
+void test_shared_to_exclusive()
+{
+  boost::shared_mutex mtx;
+  mtx.lock_shared();
+  mtx.lock_shared();
+  BOOST_TEST(! mtx.try_unlock_shared_and_lock());
+  BOOST_TEST(mtx.try_unlock_shared_and_lock_upgrade());
+  BOOST_TEST(! mtx.try_lock_upgrade());
+  mtx.unlock_upgrade_and_lock_shared();
+  boost::thread th(&unlock_shared_after, &mtx, boost::chrono::milliseconds(50));
+  BOOST_TEST(mtx.try_unlock_shared_and_lock_for(boost::chrono::seconds(10)));
+  th.join();
+  mtx.unlock_and_lock_shared();
+  BOOST_TEST(mtx.try_lock_shared());
+  mtx.unlock_shared();
+  mtx.unlock_shared();
+}
+
+int main()
+{
+  test_readers_writers_upgraders();
+  test_waiting_writer_blocks_new_readers();
+  test_timed_out_writer_unblocks_readers();
+  test_upgrade_to_exclusive();
+  test_shared_to_exclusive();
+  return boost::report_errors();
+}